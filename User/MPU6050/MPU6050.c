@@ -3,11 +3,18 @@
 #include "stdio.h"
 #include "eMPL/inv_mpu.h"
 #include "eMPL/inv_mpu_dmp_motion_driver.h"
+#include "log.h"
+#include "cmd.h"
+#include "dwt.h"
+#include "imu_block.h"
+#include <string.h>
 
-u8 MPU_Init(void)
+static void MPU_Cmd_Init(void);
+
+// Ĵʽ:λٶȼư̶ʽFIFO
+static u8 MPU_Config(void)
 {
 	u8 res;
-	MPU6050_IIC_Init();								   // ʼIIC
 	MPU_Write_Byte(MPU_ADDR, MPU_PWR_MGMT1_REG, 0X80); // λMPU6050
 	delay_ms(100);
 	MPU_Write_Byte(MPU_ADDR, MPU_PWR_MGMT1_REG, 0X00); // MPU6050
@@ -24,12 +31,24 @@ u8 MPU_Init(void)
 	{
 		MPU_Write_Byte(MPU_ADDR, MPU_PWR_MGMT1_REG, 0X01); // CLKSEL,PLL XΪο
 		MPU_Write_Byte(MPU_ADDR, MPU_PWR_MGMT2_REG, 0X00); // ٶǶ
-		MPU_Set_Rate(50);								   // òΪ50Hz
+		MPU_Fifo_Start(MPU_FIFO_RATE);					   // ٶȼư̶ʽFIFO
+#if MPU_USE_INT
+		MPU_Int_Init();									   // ݾжϻѶȡ
+#endif
 	}
 	else
 		return 1;
 	return 0;
 }
+
+u8 MPU_Init(void)
+{
+	MPU6050_IIC_Init(); // ʼIIC
+	if (MPU_Config())
+		return 1;
+	MPU_Cmd_Init();
+	return 0;
+}
 // MPU6050Ǵ̷Χ
 // fsr:0,250dps;1,500dps;2,1000dps;3,2000dps
 // ֵ:0,óɹ
@@ -89,11 +108,10 @@ short MPU_Get_Temperature(void)
 {
 	u8 buf[2];
 	short raw;
-	float temp;
 	MPU_Read_Bytes(MPU_ADDR, MPU_TEMP_OUTH_REG, 2, buf);
 	raw = ((u16)buf[0] << 8) | buf[1];
-	temp = 36.53 + ((double)raw) / 340;
-	return temp * 100;
+	// 36.53 + raw/340,100:raw*100/340 = raw*5/17,ø
+	return 3653 + (long)raw * 5 / 17;
 }
 // õֵ(ԭʼֵ)
 // gx,gy,gz:x,y,zԭʼ()
@@ -130,6 +148,398 @@ u8 MPU_Get_Accelerometer(short *ax, short *ay, short *az)
 	;
 }
 
+// FIFO״̬
+static u32 fifo_period_us;		// (us),0ʾFIFOδ
+static u32 fifo_t_ms;			// һʱ
+static u32 fifo_t_us;			// ʱĲ1ms
+static u8 fifo_dmp;				// FIFODMPдİ,λFIFOҪDMPһλ
+static MPU_Accel_Sample fifo_latest;
+static u8 fifo_has_latest;
+
+// ݾж
+void (*mpu_data_hook)(void) = 0;
+static volatile u32 mpu_int_ms;		// һݾʱ
+static volatile u16 mpu_int_pending;	// ϴζȡݾ
+
+// λ:ֻжȡд,ʹԴ±,±ɵȡģ
+#if MPU_RING_SIZE * 6 < MPU_FIFO_SIZE
+#error "MPU_RING_SIZE must hold a full FIFO"
+#endif
+static MPU_Accel_Sample mpu_ring[MPU_RING_SIZE];
+static u16 mpu_ring_head;
+
+// FIFO¿ʼʱ,һһں
+static void MPU_Fifo_Reset(void)
+{
+	if (fifo_dmp)
+		mpu_reset_fifo();
+	else
+	{
+		MPU_Write_Byte(MPU_ADDR, MPU_USER_CTRL_REG, 0X04); // λFIFO
+		MPU_Write_Byte(MPU_ADDR, MPU_USER_CTRL_REG, 0X40); // ʹFIFO
+	}
+	mpu_int_pending = 0;
+	fifo_t_ms = get_systick() + fifo_period_us / 1000;
+	fifo_t_us = fifo_period_us % 1000;
+}
+
+// ٶȼư̶дFIFO
+// rate:4~1000(Hz),ʵʲΪ1000/(1000/rate)
+// ֵ:0,óɹ
+//     ,ʧ
+u8 MPU_Fifo_Start(u16 rate)
+{
+	u8 res;
+	if (rate > 1000)
+		rate = 1000;
+	if (rate < 4)
+		rate = 4;
+	res = MPU_Set_Rate(rate);
+	res |= MPU_Write_Byte(MPU_ADDR, MPU_FIFO_EN_REG, 0X08); // ֻѼٶȼдFIFO
+	fifo_period_us = (1000 / rate) * 1000;					 // SMPLRT_DIVȡһ
+	fifo_dmp = 0;
+	fifo_has_latest = 0;
+	MPU_Fifo_Reset();
+	return res;
+}
+
+// DMPƬϼƲ:DMP̼,򿪼Ʋ,dmp_get_pedometer_step_count_wrap
+// raw_accel:1,DMPͬʱMPU_FIFO_RATEԭʼٶдFIFO,ʽMPU_Fifo_Startͬ,
+//             MPU_Fifo_Readճ,ݾжϸDMP
+//           0,FIFO,رж,MCUֻżһβ
+// ֵ:0,ɹ
+//     ,ʧ,ѻָΪMPU_Fifo_StartļĴʽ
+u8 MPU_Dmp_Pedometer_Start(u8 raw_accel)
+{
+	static const signed char orient[9] = {1, 0, 0,
+										  0, 1, 0,
+										  0, 0, 1};
+	u8 res = 0;
+
+	fifo_period_us = 0; // ڼ䲻FIFO
+	if (mpu_init())
+		res = 1;
+	else if (mpu_set_sensors(INV_XYZ_GYRO | INV_XYZ_ACCEL))
+		res = 2;
+	else if (mpu_configure_fifo(INV_XYZ_ACCEL))
+		res = 3;
+	else if (mpu_set_sample_rate(DEFAULT_MPU_HZ))
+		res = 4;
+	else if (dmp_load_motion_driver_firmware())
+		res = 5;
+	else if (dmp_set_orientation(inv_orientation_matrix_to_scalar(orient)))
+		res = 6;
+	else if (dmp_enable_feature(DMP_FEATURE_PEDOMETER | (raw_accel ? DMP_FEATURE_SEND_RAW_ACCEL : 0)))
+		res = 7;
+	else if (dmp_set_fifo_rate(MPU_FIFO_RATE))
+		res = 8;
+	else if (dmp_set_interrupt_mode(DMP_INT_CONTINUOUS))
+		res = 9;
+	else if (mpu_set_dmp_state(1))
+		res = 10;
+	if (res)
+	{
+		LOG_E("DMP pedometer init failed: %u\r\n", res);
+		MPU_Config();
+		return res;
+	}
+	if (!raw_accel)
+	{
+		MPU_Write_Byte(MPU_ADDR, MPU_INT_EN_REG, 0X00); // FIFOû,INTMCU
+		return 0;
+	}
+	fifo_period_us = 1000000 / MPU_FIFO_RATE; // DMP̶200Hz,Ƶ
+	fifo_dmp = 1;
+	fifo_has_latest = 0;
+	MPU_Fifo_Reset();
+	return 0;
+}
+
+// ʱ,(now-2, now]
+// ʱƫʱֵܵnow֮,ƫʱԽԽ,Χƽ
+static void MPU_Fifo_Sync(u32 now, u16 avail)
+{
+	u32 last = fifo_t_ms + (fifo_t_us + (u32)(avail - 1) * fifo_period_us) / 1000;
+	s32 err = (s32)(now - last);
+	if (err < 0 || err >= (s32)(2 * fifo_period_us / 1000))
+		fifo_t_ms += err;
+}
+
+// FIFOļٶ,FIFOݼĴһ
+// buf:,max:(MPU_FIFO_BURST_MAXʱMPU_FIFO_BURST_MAX)
+// ֵ:,maxʱFIFOܻ
+u16 MPU_Fifo_Read(MPU_Accel_Sample *buf, u16 max)
+{
+	u8 data[MPU_FIFO_BURST_MAX * 6];
+	u8 cnt[2];
+	u16 count, avail, n, i;
+
+	if (fifo_period_us == 0)
+		return 0;
+	if (MPU_Read_Bytes(MPU_ADDR, MPU_FIFO_CNTH_REG, 2, cnt))
+		return 0;
+	count = ((u16)cnt[0] << 8) | cnt[1];
+	// ʱ170(1020ֽ),дһֻдý4ֽ,ͣ1024,
+	// Լ1024;1020ֽû,ճ
+	if (count >= MPU_FIFO_SIZE)
+	{
+		// Ǿ,10246ı,ݲٰ,ֻ
+		LOG_W("MPU FIFO overflow, %u bytes\r\n", count);
+		MPU_Fifo_Reset();
+		return 0;
+	}
+	avail = count / 6;
+	if (avail == 0)
+		return 0;
+	// ȡжʱ:֮avail,ֻжʱһ
+	// жûӻûʱ˻õǰʱ
+	if (MPU_USE_INT && mpu_int_pending)
+		MPU_Fifo_Sync(mpu_int_ms, avail);
+	else
+		MPU_Fifo_Sync(get_systick(), avail);
+
+	n = avail;
+	if (n > max)
+		n = max;
+	if (n > MPU_FIFO_BURST_MAX)
+		n = MPU_FIFO_BURST_MAX;
+	if (MPU_Read_Bytes(MPU_ADDR, MPU_FIFO_RW_REG, n * 6, data))
+		return 0;
+
+	for (i = 0; i < n; i++)
+	{
+		buf[i].t_ms = fifo_t_ms;
+		buf[i].ax = ((u16)data[i * 6] << 8) | data[i * 6 + 1];
+		buf[i].ay = ((u16)data[i * 6 + 2] << 8) | data[i * 6 + 3];
+		buf[i].az = ((u16)data[i * 6 + 4] << 8) | data[i * 6 + 5];
+		fifo_t_us += fifo_period_us;
+		fifo_t_ms += fifo_t_us / 1000;
+		fifo_t_us %= 1000;
+	}
+	fifo_latest = buf[n - 1];
+	fifo_has_latest = 1;
+	return n;
+}
+
+// һδFIFO,I2C
+// ֵ:0,ɹ
+//     1,ûж
+u8 MPU_Fifo_Latest(MPU_Accel_Sample *s)
+{
+	if (!fifo_has_latest)
+		return 1;
+	*s = fifo_latest;
+	return 0;
+}
+
+// INTŽӵEXTI,ݾж
+// ÿдFIFOʱINTһ50usĵ͵ƽ
+void MPU_Int_Init(void)
+{
+	GPIO_InitTypeDef GPIO_InitStructure;
+	EXTI_InitTypeDef EXTI_InitStructure;
+	NVIC_InitTypeDef NVIC_InitStructure;
+
+	RCC_AHB1PeriphClockCmd(MPU_INT_GPIO_CLK, ENABLE);
+	RCC_APB2PeriphClockCmd(RCC_APB2Periph_SYSCFG, ENABLE);
+
+	GPIO_InitStructure.GPIO_Pin = MPU_INT_PIN;
+	GPIO_InitStructure.GPIO_Mode = GPIO_Mode_IN;
+	GPIO_InitStructure.GPIO_PuPd = GPIO_PuPd_UP;
+	GPIO_InitStructure.GPIO_Speed = GPIO_Speed_2MHz;
+	GPIO_Init(MPU_INT_GPIO, &GPIO_InitStructure);
+
+	SYSCFG_EXTILineConfig(MPU_INT_PORT_SRC, MPU_INT_PIN_SRC);
+	EXTI_ClearITPendingBit(MPU_INT_EXTI_LINE);
+	EXTI_InitStructure.EXTI_Line = MPU_INT_EXTI_LINE;
+	EXTI_InitStructure.EXTI_Mode = EXTI_Mode_Interrupt;
+	EXTI_InitStructure.EXTI_Trigger = EXTI_Trigger_Falling; // INT͵ƽЧ
+	EXTI_InitStructure.EXTI_LineCmd = ENABLE;
+	EXTI_Init(&EXTI_InitStructure);
+
+	NVIC_InitStructure.NVIC_IRQChannel = MPU_INT_IRQn;
+	NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = 2;
+	NVIC_InitStructure.NVIC_IRQChannelSubPriority = 3;
+	NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
+	NVIC_Init(&NVIC_InitStructure);
+
+	MPU_Write_Byte(MPU_ADDR, MPU_INTBP_CFG_REG, 0X80); // ͵ƽЧ,,50us
+	MPU_Write_Byte(MPU_ADDR, MPU_INT_EN_REG, 0X01);	   // ݾж
+}
+
+// ݾж:ֻ¼ʱʹ,ܹһٻѶȡ
+void MPU_INT_IRQHandler(void)
+{
+	if (EXTI_GetITStatus(MPU_INT_EXTI_LINE) != RESET)
+	{
+		EXTI_ClearITPendingBit(MPU_INT_EXTI_LINE);
+		mpu_int_ms = get_systick();
+		if (++mpu_int_pending >= MPU_INT_BATCH && mpu_data_hook)
+			mpu_data_hook();
+	}
+}
+
+// FIFOȫλ,ɶȡ
+// ÿζĩβΪֹ,ֱдﲻٿ
+// һһFIFO,ȻС,ʹÿζȡѻȡվͲᶪ
+// ֵ:
+u16 MPU_Fifo_Poll(void)
+{
+	u16 seen = mpu_int_pending;
+	u16 total = 0;
+	u16 space, n;
+
+	do
+	{
+		space = MPU_RING_SIZE - (mpu_ring_head & (MPU_RING_SIZE - 1));
+		n = MPU_Fifo_Read(&mpu_ring[mpu_ring_head & (MPU_RING_SIZE - 1)], space);
+		mpu_ring_head += n;
+		total += n;
+	} while (n && n == (space < MPU_FIFO_BURST_MAX ? space : MPU_FIFO_BURST_MAX));
+	// ֻʼʱĴ,ȡڼж¼ӵһ;FIFOλʱѾ
+	__disable_irq();
+	mpu_int_pending = mpu_int_pending > seen ? mpu_int_pending - seen : 0;
+	__enable_irq();
+	return total;
+}
+
+// д±,µʹߴ￪ʼ
+u16 MPU_Ring_Head(void)
+{
+	return mpu_ring_head;
+}
+
+// ӻ
+// tail:ʹԼĶ±,󳬹ʱǵ
+// ֵ:
+u16 MPU_Ring_Read(u16 *tail, MPU_Accel_Sample *buf, u16 max)
+{
+	u16 n = 0;
+
+	if ((u16)(mpu_ring_head - *tail) > MPU_RING_SIZE)
+		*tail = mpu_ring_head - MPU_RING_SIZE;
+	while (*tail != mpu_ring_head && n < max)
+	{
+		buf[n++] = mpu_ring[*tail & (MPU_RING_SIZE - 1)];
+		(*tail)++;
+	}
+	return n;
+}
+
+// λϱ:򿪺ѻÿٶȥ(Ǻ̬0)
+static u8 niming_on;
+static u16 niming_tail;
+
+void MPU_Niming_Poll(void)
+{
+	MPU_Accel_Sample s;
+
+	if (!niming_on)
+		return;
+	while (MPU_Ring_Read(&niming_tail, &s, 1))
+		MPU_ReportImu(s.ax, s.ay, s.az, 0, 0, 0, 0, 0, 0);
+}
+
+//  niming [on|off]
+static void cmd_niming(uint8_t argc, char *argv[])
+{
+	if (argc > 1 && strcmp(argv[1], "on") == 0)
+	{
+		niming_tail = MPU_Ring_Head();
+		niming_on = 1;
+	}
+	else if (argc > 1 && strcmp(argv[1], "off") == 0)
+		niming_on = 0;
+	else if (argc > 1)
+	{
+		printf("usage: niming [on|off]\r\n");
+		return;
+	}
+	printf("niming: %s\r\n", niming_on ? "on" : "off");
+}
+
+// 鴦ܶԱ:û IMU_BLOCK_MAX ,ÿ鴦ÿ,
+//  _Ref 汾Ա;ÿ IMUBENCH_RUNS ȡСֵ,ȥжϵĸ
+// ھ̬,ִ,ջֻ1KB
+#define IMUBENCH_RUNS	8
+
+static int16_t bench_x[IMU_BLOCK_MAX], bench_y[IMU_BLOCK_MAX], bench_z[IMU_BLOCK_MAX];
+static int16_t bench_out[IMU_BLOCK_MAX];
+static u32 bench_sq[IMU_BLOCK_MAX];
+static Imu_Fir bench_fir;
+
+static const char *const bench_names[] = {"sumsq", "minmax", "energy", "fir8"};
+
+static u32 imubench_run(u8 kernel, u8 ref)
+{
+	u32 best = 0xFFFFFFFF, start, cycles;
+	int16_t lo, hi;
+	u8 i;
+
+	for (i = 0; i < IMUBENCH_RUNS; i++)
+	{
+		start = DWT_Cycles();
+		switch (kernel)
+		{
+		case 0:
+			(ref ? Imu_Block_SumSq_Ref : Imu_Block_SumSq)(bench_x, bench_y, bench_z, bench_sq, IMU_BLOCK_MAX);
+			break;
+		case 1:
+			(ref ? Imu_Block_MinMax_Ref : Imu_Block_MinMax)(bench_z, IMU_BLOCK_MAX, &lo, &hi);
+			break;
+		case 2:
+			(ref ? Imu_Block_Energy_Ref : Imu_Block_Energy)(bench_z, IMU_BLOCK_MAX);
+			break;
+		default:
+			(ref ? Imu_Fir_Process_Ref : Imu_Fir_Process)(&bench_fir, bench_z, bench_out, IMU_BLOCK_MAX);
+			break;
+		}
+		cycles = DWT_Elapsed(start);
+		if (cycles < best)
+			best = cycles;
+	}
+	return best;
+}
+
+//  imubench
+static void cmd_imubench(uint8_t argc, char *argv[])
+{
+	static const int16_t lp[8] = {1024, 3072, 5120, 7168, 7168, 5120, 3072, 1024};	// 8ͨ,1
+	u32 ref, blk;
+	u16 i, k;
+
+	(void)argc;
+	(void)argv;
+	for (i = 0; i < IMU_BLOCK_MAX; i++)
+	{
+		k = (mpu_ring_head - IMU_BLOCK_MAX + i) & (MPU_RING_SIZE - 1);
+		bench_x[i] = mpu_ring[k].ax;
+		bench_y[i] = mpu_ring[k].ay;
+		bench_z[i] = mpu_ring[k].az;
+	}
+	Imu_Fir_Init(&bench_fir, lp, 8);
+
+	printf("imu block, %s, %d samples, cycles per block:\r\n", IMU_BLOCK_SIMD ? "SIMD" : "scalar", IMU_BLOCK_MAX);
+	printf("kernel       ref   block\r\n");
+	for (i = 0; i < sizeof(bench_names) / sizeof(bench_names[0]); i++)
+	{
+		ref = imubench_run(i, 1);
+		blk = imubench_run(i, 0);
+		printf("%-8s %7lu %7lu  %lu.%02lux\r\n", bench_names[i], (unsigned long)ref, (unsigned long)blk,
+			   (unsigned long)(ref / blk), (unsigned long)(ref * 100 / blk % 100));
+	}
+}
+
+static const Cmd mpu_cmds[] = {
+	{"niming", cmd_niming, "niming [on|off] - Stream accel samples to the Niming host tool"},
+	{"imubench", cmd_imubench, "imubench - Cycles per IMU block, SIMD vs per-sample"},
+};
+
+static void MPU_Cmd_Init(void)
+{
+	Cmd_Register(mpu_cmds, CMD_COUNT(mpu_cmds));
+}
+
 //ݸλ(V2.6汾)
 //fun:. 0XA0~0XAF
 //data:ݻ,28ֽ!!
@@ -81,17 +81,27 @@
 //#define MPU_WRITE   0XD0
 
 /************************************ЩҪ㲹ȫ************************************** */
+#include "hard_i2c.h"
 #include "soft_i2c.h"
 #include "debug.h"
 #include "delay.h"
-#define log_i 	printf	//ӡϢ
-#define log_e  	printf	//ӡϢ
+#include "uart_dma.h"
+#define log_i 	uart_printf	//ӡϢ,ߴDMA,printf
+#define log_e  	uart_printf	//ӡϢ
 #define delay_ms   delay_ms
+#if USE_HARD_I2C	// OLEDPB8/PB9OLEDͬһI2C
+#define MPU6050_IIC_Init() 									Hard_I2C_Init()
+#define MPU_Write_Byte(dev_addr, reg_addr, data) 			Hard_I2C_Write_Byte(dev_addr, reg_addr, data)
+#define MPU_Write_Bytes(dev_addr, reg_addr, len, pdata) 	Hard_I2C_Write_Bytes(dev_addr, reg_addr, len, pdata)
+#define MPU_Read_Byte(dev_addr, reg_addr, pdata) 			Hard_I2C_Read_Byte_From_Reg(dev_addr, reg_addr, pdata)
+#define MPU_Read_Bytes(dev_addr, reg_addr, len, pdata) 		Hard_I2C_Read_Bytes_From_Reg(dev_addr, reg_addr, len, pdata)
+#else
 #define MPU6050_IIC_Init() 									Soft_I2C_Init()
 #define MPU_Write_Byte(dev_addr, reg_addr, data) 			Soft_I2C_Write_Byte(dev_addr, reg_addr, data)
 #define MPU_Write_Bytes(dev_addr, reg_addr, len, pdata) 	Soft_I2C_Write_Bytes(dev_addr, reg_addr, len, pdata)
 #define MPU_Read_Byte(dev_addr, reg_addr, pdata) 			Soft_I2C_Read_Byte_From_Reg(dev_addr, reg_addr, pdata)
 #define MPU_Read_Bytes(dev_addr, reg_addr, len, pdata) 		Soft_I2C_Read_Bytes_From_Reg(dev_addr, reg_addr, len, pdata)
+#endif
 #define MUP_uart_send_bytes(buf, len) 						Usart1_send_bytes(buf, len)
 /****************************************end********************************************** */
 
@@ -108,6 +118,59 @@ u8 MPU_Get_Gyroscope(short *gx,short *gy,short *gz);
 u8 MPU_Get_Accelerometer(short *ax,short *ay,short *az);
 void MPU_ReportImu(short aacx,short aacy,short aacz,short gyrox,short gyroy,short gyroz,short roll,short pitch,short yaw);
 
+// ٶȼFIFO̶ʰѼٶдƬFIFO(1024ֽ,Լ170)
+// ѭпʱһI2Cѻܵȫȡߡɴ֤ѭӰ죻
+// ÿʱɲ㣬 get_systick() У׼ʱӵƫۻ
+#ifndef MPU_FIFO_RATE
+#define MPU_FIFO_RATE			100		//FIFO(Hz),ȡ1000Լ,50~100
+#endif
+#define MPU_FIFO_SIZE			1024	//ƬFIFOֽ
+#define MPU_FIFO_BURST_MAX		32		//MPU_Fifo_Readһ
+
+typedef struct
+{
+	u32 t_ms;			//ʱ,get_systick()ʱ
+	short ax, ay, az;	//ԭʼ
+} MPU_Accel_Sample;
+
+u8 MPU_Fifo_Start(u16 rate);
+u16 MPU_Fifo_Read(MPU_Accel_Sample *buf, u16 max);
+u8 MPU_Fifo_Latest(MPU_Accel_Sample *s);
+u8 MPU_Dmp_Pedometer_Start(u8 raw_accel);
+
+// ݾжϣINTŽEXTIжֻʱ䡢ܹ MPU_INT_BATCH  mpu_data_hook
+// Ѷȡ(жI2COLEDDMAˢҲ)ȡ MPU_Fifo_Poll()
+// FIFOλƲλϱȸԴһ±ӻȡӰ졣
+#ifndef MPU_USE_INT
+#define MPU_USE_INT				1		//1:INTŽӵEXTI,ݾжϻѶȡ;0:MPU_POLL_MSѯ
+#endif
+#define MPU_INT_BATCH			10		//ܹôһζȡ
+#if MPU_USE_INT
+#define MPU_POLL_MS				500		//ȡĶ(ms),ҪFIFOдʱ(100HzʱԼ1.7s)̵ö,Ҳ
+#else
+#define MPU_POLL_MS				100		//ȡѯ(ms)
+#endif
+#define MPU_RING_SIZE			256		//λ(),2,СFIFOܴ(1024/6=170),һζȡḲûȡߵ
+
+//INT:PC1 -> EXTI1,͵ƽЧ50us,½ش
+#define MPU_INT_GPIO			GPIOC
+#define MPU_INT_GPIO_CLK		RCC_AHB1Periph_GPIOC
+#define MPU_INT_PIN				GPIO_Pin_1
+#define MPU_INT_PORT_SRC		EXTI_PortSourceGPIOC
+#define MPU_INT_PIN_SRC			EXTI_PinSource1
+#define MPU_INT_EXTI_LINE		EXTI_Line1
+#define MPU_INT_IRQn			EXTI1_IRQn
+#define MPU_INT_IRQHandler		EXTI1_IRQHandler
+
+extern void (*mpu_data_hook)(void);		//ܹʱж,Ѷȡ
+
+void MPU_Int_Init(void);
+u16 MPU_Fifo_Poll(void);
+u16 MPU_Ring_Head(void);
+u16 MPU_Ring_Read(u16 *tail, MPU_Accel_Sample *buf, u16 max);
+void MPU_Niming_Poll(void);
+void MPU_INT_IRQHandler(void);
+
 // DMPƲܺ
 // mpu_dmp_init() - ʼDMPܣ֧̬㣨ŷǣ˶
 // mpu_dmp_init_pedometer() - רڼƲܵDMPʼֻüƲԭʼ
@@ -2855,7 +2855,7 @@ unsigned short inv_row_2_scale(const signed char *row)
 //?????,?????.
 void mget_ms(unsigned long *time)
 {
-
+	*time = get_systick();	// DMP ʱϵͳʱ
 }
 //mpu6050,dmp?????
 //?????:0,????
@@ -39,9 +39,10 @@
 //#include "msp430.h"
 //#include "msp430_clock.h"
 #define delay_ms    delay_ms
+#include "uart_dma.h"
 #define get_ms      mget_ms
-#define log_i 		printf
-#define log_e  		printf
+#define log_i 		uart_printf
+#define log_e  		uart_printf
 
 #elif defined EMPL_TARGET_MSP430
 #include "msp430.h"
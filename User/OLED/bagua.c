@@ -1,4 +1,7 @@
 #include "bagua.h"
+#include "oled.h"
+#include "oled_assets.h"
+#include "delay.h"
 
 // 八卦旋转动画帧数据（8帧，每帧128x64像素，共1024字节）
 // 采用黑白二值图像，0表示黑色，1表示白色
@@ -213,4 +216,31 @@ const unsigned char bagua_frames[BAGUA_FRAME_COUNT][1024] = {
     
     // 帧2-7：继续旋转（90度、135度、180度、225度、270度、315度）
     // 这里为了简化省略了具体数据，实际应用需要计算每个旋转角度的像素
-};
\ No newline at end of file
+};
+
+// 播放八卦旋转动画
+// frame_delay: 每帧间隔(ms)
+// cycles: 循环次数
+// 第0帧完整画出，之后每帧只叠加与上一帧的差分
+void Show_Bagua_Animation(uint16_t frame_delay, uint8_t cycles)
+{
+    uint8_t c, i;
+    OLED_Anim_Show(0, 0, &anim_bagua, 0, 1);
+    OLED_Refresh();
+    for (c = 0; c < cycles; c++)
+    {
+        for (i = 1; i <= BAGUA_FRAME_COUNT; i++)
+        {
+            delay_ms(frame_delay);
+            OLED_Anim_Next(0, 0, &anim_bagua, i % BAGUA_FRAME_COUNT);
+            OLED_Refresh();
+        }
+    }
+}
+
+// 显示八卦动画的某一帧
+void Show_Bagua_Static(uint8_t frame_index)
+{
+    OLED_Anim_Show(0, 0, &anim_bagua, frame_index % BAGUA_FRAME_COUNT, 1);
+    OLED_Refresh();
+}
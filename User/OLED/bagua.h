@@ -1,6 +1,8 @@
 #ifndef __BAGUA_H
 #define __BAGUA_H
 
+#include "stm32f4xx.h"
+
 // 八卦动画帧数量
 #define BAGUA_FRAME_COUNT 8
 
@@ -9,10 +11,11 @@
 #define BAGUA_HEIGHT 64
 
 // 外部变量声明
+// 原始帧数据只作为 tools/gen_assets.py 的输入，程序里使用压缩后的 anim_bagua(oled_assets.h)
 extern const unsigned char bagua_frames[BAGUA_FRAME_COUNT][1024];
 
 // 动画函数声明
-void Show_Bagua_Animation(uint16_t delay_ms, uint8_t cycles);
+void Show_Bagua_Animation(uint16_t frame_delay, uint8_t cycles);
 void Show_Bagua_Static(uint8_t frame_index);
 
 #endif
\ No newline at end of file
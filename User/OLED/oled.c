@@ -1,10 +1,19 @@
 #include "oled.h"
 #include "stdlib.h"
+#include "string.h"
 #include "oledfont.h"
+#include "oledfont_meta.h"
+#include "oled_assets.h"
 
-static uint8_t OLED_GRAM[144][8];
-static uint8_t dirty_flag = 0;
-static uint8_t dirty_x1 = 127, dirty_y1 = 63, dirty_x2 = 0, dirty_y2 = 0;
+// Դ水ҳ [ҳ][]ÿҳ128ֽSSD1306ҳѰַķ˳һ
+static uint8_t OLED_GRAM[8][128];		// ̨壺лͼ
+static uint8_t OLED_FRONT[8][128];		// ǰ̨壺ˢʱӺ̨գDMAֻ﷢
+static uint8_t dirty_mask = 0;					// ҳλͼ
+static uint8_t dirty_x1[8], dirty_x2[8];		// ÿҳ
+
+// α仯֮ôֽھͺϲһη
+// (ҳ/еַҪһʼ+ַ+ֽ+3ֽڣԼ7ֽڵʱ)
+#define OLED_DIFF_GAP	6
 
 // һֽ
 // mode:/־ 0,ʾ;1,ʾ;
@@ -66,30 +75,195 @@ void OLED_DisPlay_Off(void)
 	OLED_WR_Byte(0xAE, OLED_CMD); // رĻ
 }
 
-// Դ浽OLED,ºʾĲú
-void OLED_Refresh(void)
+// 첽ˢ£ˢڵߵӺ̨Ƚϡǰ̨壬
+// 仯мÿҳλͼɻصҳλͼҳжΣֻǰ̨巢̨ͣ塣
+// Էϵĳˢʱһ֡ˢ֮Żһ֡Ҳ˺
+// ÿδ䣺ȷҳ/еַٷö
+static uint8_t oled_page_cols[8][16];				// ÿҳѿǰ̨û͵Уÿһλ
+static volatile uint8_t oled_page_pending = 0;		// λͼΪյҳ bit0~bit7
+static uint8_t oled_page_force = 0xFF;				// ЩҳȽֱҳ(ϵĻδ֪)
+static volatile uint8_t oled_tx_active = 0;		// ص
+static uint8_t oled_tx_stage;						// 0:ڷַ 1:ڷ
+static uint8_t oled_tx_page;						// ǰҳ
+static uint8_t oled_tx_pos = 128;					// ǰҳһҪ
+static uint8_t oled_tx_x1, oled_tx_len;			// ǰ͵ж
+static uint8_t oled_tx_cmd[3];
+
+static void OLED_Tx_Done(void);
+
+#define OLED_COL_BIT(cols, n)	((cols)[(n) >> 3] & (1 << ((n) & 7)))
+
+// ڵǰҳλͼ oled_tx_pos һΣȡЩλҵ1
+static uint8_t OLED_Find_Run(void)
 {
-	uint8_t i, n;
-	uint8_t data[128];
-	for (i = 0; i < 8; i++)
+	uint8_t *cols = oled_page_cols[oled_tx_page];
+	uint8_t n = oled_tx_pos, x1, last;
+
+	while (n < 128 && !OLED_COL_BIT(cols, n))
+		n++;
+	if (n >= 128)
+		return 0;
+
+	x1 = last = n;
+	for (n++; n < 128; n++)
+	{
+		if (OLED_COL_BIT(cols, n))
+			last = n;
+		else if (n - last > OLED_DIFF_GAP)
+			break;
+	}
+	for (n = x1; n <= last; n++)
+		cols[n >> 3] &= ~(1 << (n & 7));
+
+	oled_tx_x1 = x1;
+	oled_tx_len = last - x1 + 1;
+	oled_tx_pos = last + 1;
+	return 1;
+}
+
+// ûȥжηŻλͼһˢص
+static void OLED_Requeue_Run(void)
+{
+	uint8_t n;
+
+	for (n = oled_tx_x1; n < oled_tx_x1 + oled_tx_len; n++)
+		oled_page_cols[oled_tx_page][n >> 3] |= 1 << (n & 7);
+	oled_page_pending |= 1 << oled_tx_page;
+	oled_tx_pos = 128;
+	oled_tx_active = 0;
+}
+
+// һδ䣺ǰҳб仯ͽŷһҳȫص
+static void OLED_Tx_Next(void)
+{
+	uint8_t i;
+
+	while (!OLED_Find_Run())
+	{
+		for (i = 0; i < 8; i++)
+		{
+			if (oled_page_pending & (1 << i))
+				break;
+		}
+		if (i == 8)
+		{
+			oled_tx_active = 0;
+			return;
+		}
+		oled_page_pending &= ~(1 << i);
+		oled_tx_page = i;
+		oled_tx_pos = 0;
+	}
+
+	oled_tx_cmd[0] = 0xb0 + oled_tx_page;			// ҳַ
+	oled_tx_cmd[1] = oled_tx_x1 & 0x0f;			// еַ
+	oled_tx_cmd[2] = 0x10 | (oled_tx_x1 >> 4);		// еַ
+	oled_tx_stage = 0;
+	if (OLED_Send_Bytes_Async(0x3c, 0x00, 3, oled_tx_cmd, OLED_Tx_Done))
 	{
-		for (n = 0; n < 128; n++)
+		OLED_Requeue_Run();		// ߱ռ
+	}
+}
+
+// ɻص(ж)ŷݣݷһ
+// 򷢲ȥʱжηŻλͼһηʱڵ߾ó
+static void OLED_Tx_Done(void)
+{
+	if (OLED_Send_Error())
+	{
+		OLED_Requeue_Run();
+		return;
+	}
+	if (oled_tx_stage == 0)
+	{
+		oled_tx_stage = 1;
+		if (OLED_Send_Bytes_Async(0x3c, 0x40, oled_tx_len, &OLED_FRONT[oled_tx_page][oled_tx_x1], OLED_Tx_Done))
+			OLED_Requeue_Run();		// ߱ռ
+		return;
+	}
+	if (OLED_Send_Yield(OLED_Tx_Next))
+		return;
+	OLED_Tx_Next();
+}
+
+// һҳӺ̨յǰ̨()±仯Уʱص
+static void OLED_Queue_Page(uint8_t page, uint8_t x1, uint8_t x2)
+{
+	uint8_t cols[16] = {0};
+	uint8_t *front = OLED_FRONT[page];
+	const uint8_t *back = OLED_GRAM[page];
+	uint8_t force = oled_page_force & (1 << page);
+	uint8_t changed = 0, start, n;
+
+	if (force)
+	{
+		oled_page_force &= ~(1 << page);
+		x1 = 0;
+		x2 = 127;
+	}
+	for (n = x1; n <= x2; n++)
+	{
+		if (force || back[n] != front[n])
 		{
-			data[n] = OLED_GRAM[n][i];
+			front[n] = back[n];
+			cols[n >> 3] |= 1 << (n & 7);
+			changed = 1;
 		}
+	}
+
+	__disable_irq();
+	if (changed)
+	{
+		for (n = 0; n < 16; n++)
+			oled_page_cols[page][n] |= cols[n];
+		oled_page_pending |= 1 << page;
+	}
+	// û±仯ҲҪ֮ǰæŻȥжﲹ
+	start = oled_page_pending && !oled_tx_active;
+	if (start)
+		oled_tx_active = 1;
+	__enable_irq();
+
+	if (start)
+	{
+		OLED_Tx_Next();
+	}
+}
+
+// Ƿҳûз
+uint8_t OLED_Is_Busy(void)
+{
+	return oled_tx_active;
+}
+
+// ̨(8ҳx128Уҳ)ֻڽ
+const uint8_t *OLED_Get_GRAM(void)
+{
+	return &OLED_GRAM[0][0];
+}
 
-		OLED_WR_Byte(0xb0 + i, OLED_CMD); // ʼַ
-		OLED_WR_Byte(0x00, OLED_CMD);	  // õʼַ
-		OLED_WR_Byte(0x10, OLED_CMD);	  // øʼַ
-		OLED_Send_Bytes(0x3c, 0x40, 128, data);
+// ȴŶӵҳ
+void OLED_Wait_Idle(void)
+{
+	while (oled_tx_active)
+		;
+}
+
+// Դ浽OLED,ºʾĲú
+// Ƚϲյǰ̨أֻ̨б仯
+void OLED_Refresh(void)
+{
+	uint8_t i;
+	for (i = 0; i < 8; i++)
+	{
+		OLED_Queue_Page(i, 0, 127);
 	}
 }
 
 // ֲˢºֻˢָ (x1,y1)  (x2,y2)
 void OLED_Refresh_Area(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2)
 {
-	uint8_t i, n, start_page, end_page, start_col, end_col;
-	uint8_t data[128];
+	uint8_t i;
 	
 	// 
 	if (x1 > x2) { uint8_t temp = x1; x1 = x2; x2 = temp; }
@@ -101,38 +275,19 @@ void OLED_Refresh_Area(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2)
 	if (y1 >= 64) y1 = 63;
 	if (y2 >= 64) y2 = 63;
 	
-	// ҳ淶Χÿҳ8У
-	start_page = y1 / 8;
-	end_page = y2 / 8;
-	
-	// зΧ
-	start_col = x1;
-	end_col = x2;
-	
-	// ˢָ
-	for (i = start_page; i <= end_page; i++)
-	{
-		// ҳַ
-		OLED_WR_Byte(0xb0 + i, OLED_CMD);
-		
-		// ֻˢָзΧ
-		for (n = start_col; n <= end_col; n++)
-		{
-			data[n - start_col] = OLED_GRAM[n][i];
-		}
-		
-		// еַ
-		OLED_WR_Byte(start_col & 0x0f, OLED_CMD);        // еַ
-		OLED_WR_Byte(0x10 | (start_col >> 4), OLED_CMD); // еַ
-		
-		// 
-		OLED_Send_Bytes(0x3c, 0x40, end_col - start_col + 1, data);
+	// ҳŶӣÿҳ8У
+	for (i = y1 / 8; i <= y2 / 8; i++)
+	{
+		OLED_Queue_Page(i, x1, x2);
 	}
 }
 
 // Զֲˢ
+// ҳ¼䣬ͬеĸĶụǣ
 void OLED_Set_Dirty_Area(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2)
 {
+	uint8_t i;
+
 	// 
 	if (x1 > x2) { uint8_t temp = x1; x1 = x2; x2 = temp; }
 	if (y1 > y2) { uint8_t temp = y1; y1 = y2; y2 = temp; }
@@ -143,38 +298,40 @@ void OLED_Set_Dirty_Area(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2)
 	if (y1 >= 64) y1 = 63;
 	if (y2 >= 64) y2 = 63;
 	
-	// 
-	if (!dirty_flag) {
-		dirty_x1 = x1; dirty_y1 = y1; dirty_x2 = x2; dirty_y2 = y2;
-		dirty_flag = 1;
-	} else {
-		if (x1 < dirty_x1) dirty_x1 = x1;
-		if (y1 < dirty_y1) dirty_y1 = y1;
-		if (x2 > dirty_x2) dirty_x2 = x2;
-		if (y2 > dirty_y2) dirty_y2 = y2;
+	// ϲÿҳ
+	for (i = y1 / 8; i <= y2 / 8; i++)
+	{
+		if (dirty_mask & (1 << i))
+		{
+			if (x1 < dirty_x1[i]) dirty_x1[i] = x1;
+			if (x2 > dirty_x2[i]) dirty_x2[i] = x2;
+		}
+		else
+		{
+			dirty_x1[i] = x1;
+			dirty_x2[i] = x2;
+			dirty_mask |= 1 << i;
+		}
 	}
 }
 
 // ˢ
 void OLED_Refresh_Dirty(void)
 {
-	if (dirty_flag) {
-		OLED_Refresh_Area(dirty_x1, dirty_y1, dirty_x2, dirty_y2);
-		dirty_flag = 0;
-		dirty_x1 = 127; dirty_y1 = 63; dirty_x2 = 0; dirty_y2 = 0;
-	}
-}
-// 
-void OLED_Clear(void)
-{
-	uint8_t i, n;
+	uint8_t i;
 	for (i = 0; i < 8; i++)
 	{
-		for (n = 0; n < 128; n++)
+		if (dirty_mask & (1 << i))
 		{
-			OLED_GRAM[n][i] = 0; // 
+			OLED_Queue_Page(i, dirty_x1[i], dirty_x2[i]);
 		}
 	}
+	dirty_mask = 0;
+}
+// 
+void OLED_Clear(void)
+{
+	memset(OLED_GRAM, 0, sizeof(OLED_GRAM)); // 
 	OLED_Refresh(); // ʾ
 }
 
@@ -185,18 +342,119 @@ void OLED_Clear(void)
 void OLED_DrawPoint(uint8_t x, uint8_t y, uint8_t t)
 {
 	uint8_t i, m, n;
+	if (x >= 128 || y >= 64)
+		return; // ĻĵֱӶ
 	i = y / 8;
 	m = y % 8;
 	n = 1 << m;
 	if (t)
 	{
-		OLED_GRAM[x][i] |= n;
+		OLED_GRAM[i][x] |= n;
 	}
 	else
 	{
-		OLED_GRAM[x][i] = ~OLED_GRAM[x][i];
-		OLED_GRAM[x][i] |= n;
-		OLED_GRAM[x][i] = ~OLED_GRAM[x][i];
+		OLED_GRAM[i][x] &= ~n;
+	}
+}
+
+// ѰҳеĵֱдԴ(ֿ⡢ͼƬָʽ)
+// x,y:Ͻ
+// w:(ÿҳֽ)
+// pages:ռҳÿҳ8
+// bmp:ݣǵ0ҳֽڣǵ1ҳ...
+// stride:Դÿҳֽӿнȡһʱw
+// mode:0,ɫʾ;1,ʾ
+// y8ʱÿֽд룻ҳλϲ
+static void OLED_Blit_Ex(uint8_t x, uint8_t y, uint8_t w, uint8_t pages, const uint8_t *bmp, uint8_t stride, uint8_t mode)
+{
+	uint8_t i, n, b, cols;
+	uint8_t page = y / 8, shift = y % 8;
+	uint8_t inv = mode ? 0x00 : 0xFF;
+	uint8_t keep = 0xFF >> (8 - shift); // һҳбĵλ(shift=0 ʱʹ)
+	uint8_t *row, *next;
+	if (x >= 128 || page >= 8)
+		return;
+	cols = (w > 128 - x) ? 128 - x : w; // ұߵж
+	for (n = 0; n < pages && page < 8; n++, page++, bmp += stride)
+	{
+		row = &OLED_GRAM[page][x];
+		if (shift == 0)
+		{
+			for (i = 0; i < cols; i++)
+			{
+				row[i] = bmp[i] ^ inv;
+			}
+		}
+		else
+		{
+			next = (page < 7) ? &OLED_GRAM[page + 1][x] : 0;
+			for (i = 0; i < cols; i++)
+			{
+				b = bmp[i] ^ inv;
+				row[i] = (row[i] & keep) | (uint8_t)(b << shift);
+				if (next)
+				{
+					next[i] = (next[i] & ~keep) | (b >> (8 - shift));
+				}
+			}
+		}
+	}
+}
+
+void OLED_Blit(uint8_t x, uint8_t y, uint8_t w, uint8_t pages, const uint8_t *bmp, uint8_t mode)
+{
+	OLED_Blit_Ex(x, y, w, pages, bmp, w, mode);
+}
+
+// ѵԴϣڶ֣֡Ϊ0ֱֽ
+// ʾģʽ޹أɫһֺ֡Ƿɫһ֡
+void OLED_Blit_Xor(uint8_t x, uint8_t y, uint8_t w, uint8_t pages, const uint8_t *bmp)
+{
+	uint8_t i, n, b, cols;
+	uint8_t page = y / 8, shift = y % 8;
+	if (x >= 128 || page >= 8)
+		return;
+	cols = (w > 128 - x) ? 128 - x : w;
+	for (n = 0; n < pages && page < 8; n++, page++, bmp += w)
+	{
+		for (i = 0; i < cols; i++)
+		{
+			b = bmp[i];
+			if (!b)
+				continue;
+			OLED_GRAM[page][x + i] ^= (uint8_t)(b << shift);
+			if (shift && page < 7)
+				OLED_GRAM[page + 1][x + i] ^= b >> (8 - shift);
+		}
+	}
+}
+
+// 򣬰ҳֽڴ
+// x1,y1,x2,y2:ϽǺ½()
+// t:1  0,
+void OLED_Fill(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, uint8_t t)
+{
+	uint8_t page, x, mask;
+	if (x2 > 127)
+		x2 = 127;
+	if (y2 > 63)
+		y2 = 63;
+	if (x1 > x2 || y1 > y2)
+		return;
+	for (page = y1 / 8; page <= y2 / 8; page++)
+	{
+		mask = 0xFF;
+		if (page == y1 / 8)
+			mask &= 0xFF << (y1 % 8);
+		if (page == y2 / 8)
+			mask &= 0xFF >> (7 - y2 % 8);
+		for (x = x1; x <= x2; x++)
+		{
+			if (t)
+				OLED_GRAM[page][x] |= mask;
+			else
+				OLED_GRAM[page][x] &= ~mask;
+		}
 	}
 }
 
@@ -280,6 +538,66 @@ void OLED_DrawCircle(uint8_t x, uint8_t y, uint8_t r)
 	}
 }
 
+// ֺŲ±Ϊ size1/4ûеֺΪ0
+static const OLED_Font *const oled_ascii_fonts[] = {
+	0, 0, &oled_font_0806, &oled_font_1206, &oled_font_1608, 0, &oled_font_2412};
+// 壬±Ϊ size1/8
+static const OLED_Font *const oled_hz_fonts[] = {
+	0, 0, &oled_font_hz16, &oled_font_hz24, &oled_font_hz32, 0, 0, 0, &oled_font_hz64};
+
+// ÿֺ油Ŀհ
+#define OLED_FONT_SPACING 1
+
+static const uint8_t oled_blank[8] = {0};
+
+// ֺȡȿASCII壬ֵֺ֧ŷ0
+const OLED_Font *OLED_Get_Font(uint8_t size1)
+{
+	if ((size1 & 3) || size1 / 4 >= sizeof(oled_ascii_fonts) / sizeof(oled_ascii_fonts[0]))
+		return 0;
+	return oled_ascii_fonts[size1 / 4];
+}
+
+// ַеĵ󣬲巶Χڷ0
+static const uint8_t *OLED_Glyph(const OLED_Font *font, uint8_t chr)
+{
+	uint8_t idx = chr - font->first;
+	if (chr < font->first || idx >= font->count)
+		return 0;
+	return font->bitmap + (uint16_t)idx * font->stride;
+}
+
+// ַռõˮƽ()ּ
+uint8_t OLED_Glyph_Width(const OLED_Font *font, uint8_t chr)
+{
+	uint8_t idx = chr - font->first;
+	if (chr < font->first || idx >= font->count)
+		return 0;
+	if (font->prop)
+		return font->prop[idx][1] + OLED_FONT_SPACING;
+	return font->width;
+}
+
+// ʾһַռõĿȣڵƽx
+// mode:0,ɫʾ;1,ʾ
+uint8_t OLED_Draw_Glyph(uint8_t x, uint8_t y, uint8_t chr, const OLED_Font *font, uint8_t mode)
+{
+	const uint8_t *g = OLED_Glyph(font, chr);
+	uint8_t w;
+	if (!g)
+		return 0;
+	if (!font->prop)
+	{
+		OLED_Blit_Ex(x, y, font->width, font->pages, g, font->width, mode);
+		return font->width;
+	}
+	// ֻīУٲּ
+	w = font->prop[chr - font->first][1];
+	OLED_Blit_Ex(x, y, w, font->pages, g + font->prop[chr - font->first][0], font->width, mode);
+	OLED_Blit_Ex(x + w, y, OLED_FONT_SPACING, font->pages, oled_blank, 1, mode);
+	return w + OLED_FONT_SPACING;
+}
+
 // ָλʾһַ,ַ
 // x:0~127
 // y:0~63
@@ -287,50 +605,36 @@ void OLED_DrawCircle(uint8_t x, uint8_t y, uint8_t r)
 // mode:0,ɫʾ;1,ʾ
 void OLED_ShowChar(uint8_t x, uint8_t y, uint8_t chr, uint8_t size1, uint8_t mode)
 {
-	uint8_t i, m, temp, size2, chr1;
-	uint8_t x0 = x, y0 = y;
-	if (size1 == 8)
-		size2 = 6;
-	else
-		size2 = (size1 / 8 + ((size1 % 8) ? 1 : 0)) * (size1 / 2); // õһַӦռֽ
-	chr1 = chr - ' ';											   // ƫƺֵ
-	for (i = 0; i < size2; i++)
+	const OLED_Font *font = OLED_Get_Font(size1);
+	if (font)
+		OLED_Draw_Glyph(x, y, chr, font, mode);
+}
+
+// ָʾַǷַ򳬳Ļұֹͣ
+// ַx
+uint8_t OLED_ShowString_Font(uint8_t x, uint8_t y, const uint8_t *chr, const OLED_Font *font, uint8_t mode)
+{
+	uint8_t w;
+	while (*chr && x < 128)
 	{
-		if (size1 == 8)
-		{
-			temp = asc2_0806[chr1][i];
-		} // 0806
-		else if (size1 == 12)
-		{
-			temp = asc2_1206[chr1][i];
-		} // 1206
-		else if (size1 == 16)
-		{
-			temp = asc2_1608[chr1][i];
-		} // 1608
-		else if (size1 == 24)
-		{
-			temp = asc2_2412[chr1][i];
-		} // 2412
-		else
-			return;
-		for (m = 0; m < 8; m++)
-		{
-			if (temp & 0x01)
-				OLED_DrawPoint(x, y, mode);
-			else
-				OLED_DrawPoint(x, y, !mode);
-			temp >>= 1;
-			y++;
-		}
-		x++;
-		if ((size1 != 8) && ((x - x0) == size1 / 2))
-		{
-			x = x0;
-			y0 = y0 + 8;
-		}
-		y = y0;
+		w = OLED_Draw_Glyph(x, y, *chr, font, mode);
+		if (w == 0)
+			break;
+		x += w;
+		chr++;
 	}
+	return x;
+}
+
+// ַָʾʱܿ
+uint16_t OLED_Text_Width(const uint8_t *chr, const OLED_Font *font)
+{
+	uint16_t w = 0;
+	while (*chr)
+	{
+		w += OLED_Glyph_Width(font, *chr++);
+	}
+	return w;
 }
 
 // ʾַ
@@ -340,15 +644,9 @@ void OLED_ShowChar(uint8_t x, uint8_t y, uint8_t chr, uint8_t size1, uint8_t mod
 // mode:0,ɫʾ;1,ʾ
 void OLED_ShowString(uint8_t x, uint8_t y, uint8_t *chr, uint8_t size1, uint8_t mode)
 {
-	while ((*chr >= ' ') && (*chr <= '~')) // жǲǷǷַ!
-	{
-		OLED_ShowChar(x, y, *chr, size1, mode);
-		if (size1 == 8)
-			x += 6;
-		else
-			x += size1 / 2;
-		chr++;
-	}
+	const OLED_Font *font = OLED_Get_Font(size1);
+	if (font)
+		OLED_ShowString_Font(x, y, chr, font, mode);
 }
 
 // m^n
@@ -370,20 +668,14 @@ u32 OLED_Pow(uint8_t m, uint8_t n)
 // mode:0,ɫʾ;1,ʾ
 void OLED_ShowNum(uint8_t x, uint8_t y, u32 num, uint8_t len, uint8_t size1, uint8_t mode)
 {
-	uint8_t t, temp, m = 0;
-	if (size1 == 8)
-		m = 2;
+	uint8_t t, temp;
+	const OLED_Font *font = OLED_Get_Font(size1);
+	if (!font)
+		return;
 	for (t = 0; t < len; t++)
 	{
 		temp = (num / OLED_Pow(10, len - t - 1)) % 10;
-		if (temp == 0)
-		{
-			OLED_ShowChar(x + (size1 / 2 + m) * t, y, '0', size1, mode);
-		}
-		else
-		{
-			OLED_ShowChar(x + (size1 / 2 + m) * t, y, temp + '0', size1, mode);
-		}
+		OLED_Draw_Glyph(x + font->width * t, y, temp + '0', font, mode);
 	}
 }
 
@@ -393,45 +685,20 @@ void OLED_ShowNum(uint8_t x, uint8_t y, u32 num, uint8_t len, uint8_t size1, uin
 // mode:0,ɫʾ;1,ʾ
 void OLED_ShowChinese(uint8_t x, uint8_t y, uint8_t num, uint8_t size1, uint8_t mode)
 {
-	uint8_t m, temp;
-	uint8_t x0 = x, y0 = y;
-	uint16_t i, size3 = (size1 / 8 + ((size1 % 8) ? 1 : 0)) * size1; // õһַӦռֽ
-	for (i = 0; i < size3; i++)
+	if ((size1 & 7) || size1 / 8 >= sizeof(oled_hz_fonts) / sizeof(oled_hz_fonts[0]) || !oled_hz_fonts[size1 / 8])
+		return;
+	OLED_Draw_Glyph(x, y, num, oled_hz_fonts[size1 / 8], mode);
+}
+
+// һУһĻtail
+static void OLED_Scroll_Left(uint8_t tail[8][16])
+{
+	uint8_t n;
+	for (n = 0; n < 8; n++)
 	{
-		if (size1 == 16)
-		{
-			temp = Hzk1[num][i];
-		} // 16*16
-		else if (size1 == 24)
-		{
-			temp = Hzk2[num][i];
-		} // 24*24
-		else if (size1 == 32)
-		{
-			temp = Hzk3[num][i];
-		} // 32*32
-		else if (size1 == 64)
-		{
-			temp = Hzk4[num][i];
-		} // 64*64
-		else
-			return;
-		for (m = 0; m < 8; m++)
-		{
-			if (temp & 0x01)
-				OLED_DrawPoint(x, y, mode);
-			else
-				OLED_DrawPoint(x, y, !mode);
-			temp >>= 1;
-			y++;
-		}
-		x++;
-		if ((x - x0) == size1)
-		{
-			x = x0;
-			y0 = y0 + 8;
-		}
-		y = y0;
+		memmove(OLED_GRAM[n], OLED_GRAM[n] + 1, 127);
+		OLED_GRAM[n][127] = tail[n][0];
+		memmove(tail[n], tail[n] + 1, 15);
 	}
 }
 
@@ -440,25 +707,25 @@ void OLED_ShowChinese(uint8_t x, uint8_t y, uint8_t num, uint8_t size1, uint8_t
 // mode:0,ɫʾ;1,ʾ
 void OLED_ScrollDisplay(uint8_t num, uint8_t space, uint8_t mode)
 {
-	uint8_t i, n, t = 0, m = 0, r;
+	uint8_t i, t = 0, m = 0, r;
+	uint8_t tail[8][16] = {{0}};	// Ļұ16Уд
 	while (1)
 	{
 		if (m == 0)
 		{
-			OLED_ShowChinese(128, 24, t, 16, mode); // дһֱOLED_GRAM[][]
+			// 16*16ַy=24ռ34ҳ
+			for (i = 0; i < 16; i++)
+			{
+				tail[3][i] = mode ? Hzk1[t][i] : ~Hzk1[t][i];
+				tail[4][i] = mode ? Hzk1[t][i + 16] : ~Hzk1[t][i + 16];
+			}
 			t++;
 		}
 		if (t == num)
 		{
 			for (r = 0; r < 16 * space; r++) // ʾ
 			{
-				for (i = 1; i < 144; i++)
-				{
-					for (n = 0; n < 8; n++)
-					{
-						OLED_GRAM[i - 1][n] = OLED_GRAM[i][n];
-					}
-				}
+				OLED_Scroll_Left(tail);
 				OLED_Refresh();
 			}
 			t = 0;
@@ -468,13 +735,7 @@ void OLED_ScrollDisplay(uint8_t num, uint8_t space, uint8_t mode)
 		{
 			m = 0;
 		}
-		for (i = 1; i < 144; i++) // ʵ
-		{
-			for (n = 0; n < 8; n++)
-			{
-				OLED_GRAM[i - 1][n] = OLED_GRAM[i][n];
-			}
-		}
+		OLED_Scroll_Left(tail); // ʵ
 		OLED_Refresh();
 	}
 }
@@ -485,39 +746,13 @@ void OLED_ScrollDisplay(uint8_t num, uint8_t space, uint8_t mode)
 // mode:0,ɫʾ;1,ʾ
 void OLED_ShowPicture(uint8_t x, uint8_t y, uint8_t sizex, uint8_t sizey, const uint8_t BMP[], uint8_t mode)
 {
-	uint16_t j = 0;
-	uint8_t i, n, temp, m;
-	uint8_t x0 = x, y0 = y;
-	sizey = sizey / 8 + ((sizey % 8) ? 1 : 0);
-	for (n = 0; n < sizey; n++)
-	{
-		for (i = 0; i < sizex; i++)
-		{
-			temp = BMP[j];
-			j++;
-			for (m = 0; m < 8; m++)
-			{
-				if (temp & 0x01)
-					OLED_DrawPoint(x, y, mode);
-				else
-					OLED_DrawPoint(x, y, !mode);
-				temp >>= 1;
-				y++;
-			}
-			x++;
-			if ((x - x0) == sizex)
-			{
-				x = x0;
-				y0 = y0 + 8;
-			}
-			y = y0;
-		}
-	}
+	OLED_Blit(x, y, sizex, sizey / 8 + ((sizey % 8) ? 1 : 0), BMP, mode);
 }
 // OLEDĳʼ
 void OLED_Init(void)
 {
 	OLED_I2C_Init();
+	oled_page_force = 0xFF;	// ĻRAMδ֪һˢҳ
 
 	OLED_WR_Byte(0xAE, OLED_CMD); //--turn off oled panel
 	OLED_WR_Byte(0x00, OLED_CMD); //---set low column address
@@ -551,13 +786,12 @@ void OLED_Init(void)
 
 void oled_demo(void)
 {
-    extern unsigned char logo[1024];
     uint8_t t = ' ';
     OLED_Init();					// Ļʼ
     OLED_ColorTurn(0);   // 0ʾ1 ɫʾ
     OLED_DisplayTurn(0); // 0ʾ 1 Ļתʾ
    
-        OLED_ShowPicture(0, 0, 128, 64, logo, 1);
+        OLED_ShowImage(0, 0, &img_logo, 1);
         OLED_Refresh(); // Դ棬ʾ
         delay_ms(5000);
         OLED_Clear();		// 
@@ -4,11 +4,47 @@
 #include "stm32f4XX.h"
 
 /************************************ЩҪ㲹ȫ************************************** */
+#include "hard_i2c.h"
 #include "soft_i2c.h"
+#if USE_HARD_I2C
+#define OLED_I2C_Init()									Hard_I2C_Init()
+#define OLED_Send_Byte(dev_addr, reg_addr, data) 		Hard_I2C_Write_Byte(dev_addr, reg_addr, data)
+#define OLED_Send_Bytes(dev_addr, reg_addr, len, pdata) Hard_I2C_Write_Bytes(dev_addr, reg_addr, len, pdata)
+// ͣɺжcb
+#define OLED_Send_Bytes_Async(dev_addr, reg_addr, len, pdata, cb) Hard_I2C_Write_Bytes_DMA(dev_addr, reg_addr, len, pdata, cb)
+// ɻصһ첽Ƿڵʱóߣ֮ resume
+#define OLED_Send_Error()								Hard_I2C_Get_Error()
+#define OLED_Send_Yield(resume)							Hard_I2C_Yield(resume)
+#else
 #define OLED_I2C_Init()									Soft_I2C_Init()
 #define OLED_Send_Byte(dev_addr, reg_addr, data) 		Soft_I2C_Write_Byte(dev_addr, reg_addr, data)
 #define OLED_Send_Bytes(dev_addr, reg_addr, len, pdata) Soft_I2C_Write_Bytes(dev_addr, reg_addr, len, pdata)
+// I2Cû첽ص
+#define OLED_Send_Bytes_Async(dev_addr, reg_addr, len, pdata, cb) (Soft_I2C_Write_Bytes(dev_addr, reg_addr, len, (uint8_t *)(pdata)), (cb)(), 0)
+#define OLED_Send_Error()								0
+#define OLED_Send_Yield(resume)							0
+#endif
 /****************************************end********************************************** */
+//  tools/gen_font_meta.py  oledfont.h ɵ oledfont_meta.h
+typedef struct
+{
+	const uint8_t *bitmap;		// һεĵΰҳ
+	const uint8_t (*prop)[2];	// ÿε {ʼ, }ȿΪ0
+	uint8_t width;				// ο()
+	uint8_t height;				// θ߶()
+	uint8_t pages;				// ÿռҳ
+	uint16_t stride;			// ÿεֽ
+	uint8_t first;				// һַı
+	uint8_t count;				// θ
+} OLED_Font;
+
+// ȿ
+extern const OLED_Font oled_font_0806, oled_font_1206, oled_font_1608, oled_font_2412;
+// (ֵȿ)ܷͬ¸ַ
+extern const OLED_Font oled_font_1206p, oled_font_1608p, oled_font_2412p;
+// 
+extern const OLED_Font oled_font_hz16, oled_font_hz24, oled_font_hz32, oled_font_hz64;
+
 #define OLED_CMD 0  // д
 #define OLED_DATA 1 // д
 void OLED_ClearPoint(uint8_t x, uint8_t y);
@@ -21,10 +57,21 @@ void OLED_Refresh(void);
 void OLED_Refresh_Area(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2);
 void OLED_Set_Dirty_Area(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2);
 void OLED_Refresh_Dirty(void);
+uint8_t OLED_Is_Busy(void);
+void OLED_Wait_Idle(void);
+const uint8_t *OLED_Get_GRAM(void);
 void OLED_Clear(void);
 void OLED_DrawPoint(uint8_t x, uint8_t y, uint8_t t);
 void OLED_DrawLine(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, uint8_t mode);
 void OLED_DrawCircle(uint8_t x, uint8_t y, uint8_t r);
+void OLED_Fill(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, uint8_t t);
+void OLED_Blit(uint8_t x, uint8_t y, uint8_t w, uint8_t pages, const uint8_t *bmp, uint8_t mode);
+void OLED_Blit_Xor(uint8_t x, uint8_t y, uint8_t w, uint8_t pages, const uint8_t *bmp);
+const OLED_Font *OLED_Get_Font(uint8_t size1);
+uint8_t OLED_Glyph_Width(const OLED_Font *font, uint8_t chr);
+uint8_t OLED_Draw_Glyph(uint8_t x, uint8_t y, uint8_t chr, const OLED_Font *font, uint8_t mode);
+uint8_t OLED_ShowString_Font(uint8_t x, uint8_t y, const uint8_t *chr, const OLED_Font *font, uint8_t mode);
+uint16_t OLED_Text_Width(const uint8_t *chr, const OLED_Font *font);
 void OLED_ShowChar(uint8_t x, uint8_t y, uint8_t chr, uint8_t size1, uint8_t mode);
 void OLED_ShowString(uint8_t x, uint8_t y, uint8_t *chr, uint8_t size1, uint8_t mode);
 void OLED_ShowNum(uint8_t x, uint8_t y, u32 num, uint8_t len, uint8_t size1, uint8_t mode);
@@ -0,0 +1,447 @@
+// 由 tools/gen_assets.py 根据 logo.c / bagua.c 生成，请勿手工修改
+#include "oled_assets.h"
+
+// logo 128x64: 1024 -> 482 字节
+static const uint8_t img_logo_data[482] = {
+    0x9B, 0x00, 0x0C, 0x40, 0xA0, 0xD0, 0xE0, 0xF4, 0xF8, 0xF8, 0x78, 0x30, 0x70, 0x50, 0x80, 0xC0,
+    0xE7, 0x00, 0x20, 0x80, 0x40, 0xA0, 0xC0, 0xE0, 0xF8, 0xF2, 0xF9, 0xFD, 0xFE, 0xBF, 0x1F, 0xAF,
+    0xC7, 0xE7, 0xF3, 0xF8, 0x9C, 0x8E, 0xC7, 0xE3, 0xF1, 0x78, 0xBC, 0x5C, 0xEA, 0x80, 0x00, 0x80,
+    0x80, 0xC0, 0x00, 0x80, 0xD4, 0x00, 0x09, 0x80, 0x40, 0xA0, 0xC0, 0xF0, 0xE0, 0xF6, 0xF9, 0xFC,
+    0xFE, 0x8A, 0xFF, 0x0D, 0x7F, 0xBF, 0xDF, 0x2F, 0x7F, 0x47, 0x8B, 0xDD, 0xF0, 0xE1, 0xF6, 0xF8,
+    0xFD, 0xFE, 0x83, 0xFF, 0x08, 0xFE, 0xFD, 0xF8, 0xF4, 0xE0, 0xD0, 0xB0, 0x80, 0x40, 0x91, 0x00,
+    0x13, 0x80, 0xC0, 0xE0, 0x20, 0x20, 0xE0, 0xA0, 0x20, 0x20, 0xF0, 0xF8, 0x38, 0x28, 0x20, 0xA0,
+    0xE0, 0x20, 0x20, 0xE0, 0xE0, 0x82, 0x00, 0x00, 0x80, 0x81, 0xF0, 0x83, 0x80, 0x03, 0xE0, 0xF8,
+    0xF8, 0xB8, 0x83, 0x80, 0x02, 0xF0, 0xF0, 0x70, 0x83, 0x00, 0x09, 0x80, 0x40, 0xA0, 0xC0, 0xD0,
+    0xE8, 0xF0, 0xFB, 0xFD, 0xFE, 0x87, 0xFF, 0x04, 0x1F, 0xF7, 0x33, 0xF3, 0xF3, 0x81, 0xF1, 0x17,
+    0xF3, 0xE3, 0x65, 0xFE, 0x08, 0xF0, 0xFB, 0xFD, 0xFE, 0xFF, 0xFF, 0x1F, 0x2F, 0x37, 0xD7, 0xF3,
+    0xEB, 0xE3, 0xE3, 0xE7, 0xE7, 0x77, 0x6F, 0x3F, 0x86, 0xFF, 0x09, 0xFE, 0xFC, 0xFA, 0xF0, 0xE8,
+    0xC0, 0xA0, 0x60, 0x80, 0x80, 0x85, 0x00, 0x26, 0xA0, 0xF4, 0xFE, 0x87, 0xE0, 0xB6, 0xB6, 0xBE,
+    0x9F, 0x8E, 0xFD, 0x8F, 0x9F, 0x9C, 0xB4, 0xB7, 0xA5, 0x84, 0xFA, 0x7E, 0x0F, 0x01, 0x10, 0x90,
+    0x10, 0xFC, 0xBC, 0x1C, 0x10, 0x10, 0x90, 0xFC, 0x7C, 0x30, 0x94, 0xC0, 0x78, 0x3E, 0xDE, 0x81,
+    0x10, 0x04, 0x90, 0xF0, 0xF3, 0x31, 0x10, 0x83, 0x00, 0x07, 0x01, 0x04, 0x09, 0x0B, 0x17, 0x2F,
+    0x5F, 0xBF, 0x89, 0xFF, 0x1F, 0xFC, 0xFB, 0xF6, 0xE9, 0xEB, 0xF7, 0xE7, 0xE7, 0xEB, 0xE9, 0xF0,
+    0xFB, 0xFC, 0xFF, 0xFF, 0x7F, 0xFF, 0x1F, 0x2F, 0xF0, 0x40, 0x80, 0xCB, 0xC7, 0xCF, 0xCF, 0xC7,
+    0xC7, 0xDB, 0xEE, 0xF4, 0xF8, 0x87, 0xFF, 0x08, 0x7F, 0xBF, 0x1F, 0x2F, 0x07, 0x0B, 0x0D, 0x00,
+    0x01, 0x81, 0x00, 0x81, 0x04, 0x00, 0x2D, 0x81, 0x3C, 0x00, 0x2C, 0x86, 0x24, 0x00, 0xA4, 0x81,
+    0xE4, 0x1B, 0x04, 0x05, 0x05, 0x04, 0x04, 0xA0, 0xF4, 0x9C, 0xAF, 0x85, 0x84, 0x84, 0xEC, 0x7D,
+    0xC7, 0x89, 0xC1, 0xE3, 0x71, 0x38, 0x1E, 0x5F, 0x7F, 0x60, 0xE0, 0x81, 0x01, 0x01, 0x90, 0x00,
+    0x07, 0x05, 0x0B, 0x13, 0x17, 0x0F, 0x5F, 0x3F, 0x7F, 0x85, 0xFF, 0x0D, 0x7F, 0x3F, 0x5F, 0x6F,
+    0x0F, 0x7B, 0xA3, 0xC5, 0xEE, 0xF0, 0xFA, 0xF8, 0xFC, 0xFE, 0x8A, 0xFF, 0x07, 0x7F, 0x3F, 0x5F,
+    0x0F, 0x17, 0x1B, 0x01, 0x04, 0x93, 0x00, 0x02, 0x03, 0x00, 0x03, 0x82, 0x02, 0x02, 0x03, 0x03,
+    0x01, 0x84, 0x00, 0x82, 0x01, 0x83, 0x00, 0x03, 0x02, 0x03, 0x01, 0x01, 0x83, 0x00, 0x04, 0x01,
+    0x00, 0x01, 0x03, 0x01, 0x97, 0x00, 0x23, 0x01, 0x00, 0x02, 0x05, 0x03, 0x03, 0x07, 0x35, 0x12,
+    0xA7, 0x74, 0xF8, 0x3D, 0x1E, 0x8F, 0xC7, 0xE3, 0x73, 0x3F, 0x1F, 0x8F, 0xC7, 0xE3, 0xF1, 0xFB,
+    0xFB, 0x7F, 0xBF, 0x1F, 0x2F, 0x27, 0x03, 0x0B, 0x01, 0x00, 0x01, 0xE3, 0x00, 0x00, 0x01, 0x82,
+    0x00, 0x0D, 0x11, 0x11, 0x18, 0x3C, 0x3E, 0x1F, 0x0F, 0x0F, 0x17, 0x03, 0x05, 0x00, 0x01, 0x01,
+    0xD1, 0x00,
+};
+const OLED_Image img_logo = {128, 64, OLED_IMG_RLE, 482, img_logo_data};
+
+// gImage_1 58x58: 464 -> 189 字节
+static const uint8_t img_1_data[189] = {
+    0x8C, 0x00, 0x01, 0x80, 0xC0, 0x82, 0x60, 0x81, 0xC0, 0x00, 0x80, 0x8C, 0x00, 0x0A, 0x80, 0x80,
+    0xE0, 0xE0, 0x60, 0x60, 0x70, 0x60, 0xE0, 0xE0, 0x80, 0x8F, 0x00, 0x08, 0x80, 0xE0, 0xF0, 0xFC,
+    0x9E, 0x87, 0xC3, 0xC0, 0xE0, 0x81, 0x60, 0x07, 0x30, 0x31, 0x33, 0x3F, 0x3F, 0x1C, 0x38, 0x30,
+    0x81, 0x38, 0x08, 0x30, 0x30, 0x38, 0x38, 0x7C, 0x7F, 0x77, 0x63, 0xE1, 0x82, 0xC0, 0x00, 0x80,
+    0x81, 0x00, 0x04, 0x03, 0x0F, 0x7E, 0xF8, 0xC0, 0x87, 0x00, 0x0A, 0xC0, 0xE0, 0x70, 0x3C, 0x1F,
+    0x0F, 0x07, 0x03, 0x03, 0x01, 0x01, 0x99, 0x00, 0x0C, 0x01, 0x01, 0x03, 0x03, 0x07, 0x06, 0x0C,
+    0x38, 0xF8, 0xFF, 0xFF, 0xFC, 0xC0, 0x82, 0x00, 0x04, 0x60, 0xFC, 0xFF, 0x07, 0x01, 0x81, 0x00,
+    0x04, 0x1E, 0x7E, 0x7F, 0x7F, 0x0E, 0x84, 0x00, 0x02, 0x30, 0x60, 0x60, 0x81, 0x70, 0x04, 0x60,
+    0xE0, 0xE0, 0x60, 0x70, 0x85, 0x00, 0x04, 0x3C, 0xFF, 0xFF, 0xFE, 0x3C, 0x86, 0x00, 0x04, 0x01,
+    0x07, 0x3F, 0xFF, 0xF0, 0x81, 0x00, 0x04, 0x07, 0x3F, 0xFF, 0xF0, 0xC0, 0xAE, 0x00, 0x02, 0x03,
+    0xFF, 0xFF, 0x84, 0x00, 0x03, 0x03, 0xFF, 0xFE, 0x80, 0xAC, 0x00, 0x02, 0x0F, 0xFF, 0xFF, 0x84,
+    0x00, 0x02, 0x7F, 0x7F, 0x3F, 0xAC, 0x00, 0x02, 0x20, 0x3F, 0x3F, 0xB8, 0x00,
+};
+const OLED_Image img_1 = {58, 58, OLED_IMG_RLE, 189, img_1_data};
+
+// gImage_bg 64x64: 512 -> 246 字节
+static const uint8_t img_bg_data[246] = {
+    0x9A, 0x00, 0x86, 0x60, 0xA5, 0x00, 0x09, 0x80, 0xC0, 0x40, 0x10, 0x98, 0xCC, 0x60, 0xB0, 0xC0,
+    0x40, 0x85, 0x00, 0x86, 0x09, 0x85, 0x00, 0x09, 0x40, 0xC0, 0xB0, 0x60, 0xCC, 0x98, 0x30, 0x60,
+    0xC0, 0x80, 0x94, 0x00, 0x0F, 0x01, 0x00, 0x06, 0x13, 0x09, 0x06, 0x03, 0x01, 0x00, 0x80, 0xC0,
+    0xE0, 0xF0, 0xF4, 0xF8, 0xFA, 0x82, 0xFC, 0x01, 0x7F, 0x7F, 0x81, 0xFC, 0x03, 0xF8, 0xF2, 0xE0,
+    0x04, 0x83, 0x00, 0x08, 0x01, 0x00, 0x06, 0x0D, 0x1B, 0x06, 0x04, 0x01, 0x01, 0x8D, 0x00, 0x06,
+    0xF0, 0xF0, 0x00, 0x70, 0x00, 0x00, 0xF0, 0x84, 0x00, 0x01, 0xF9, 0xFE, 0x88, 0xFF, 0x08, 0xFE,
+    0xFC, 0xFC, 0xFE, 0xFF, 0x7F, 0x7F, 0x3F, 0x0F, 0x84, 0x00, 0x00, 0x01, 0x84, 0x00, 0x06, 0x70,
+    0x00, 0x00, 0xF0, 0x00, 0x70, 0x70, 0x88, 0x00, 0x06, 0x0F, 0x0F, 0x00, 0x0E, 0x00, 0x00, 0x0F,
+    0x84, 0x00, 0x01, 0x9F, 0x7F, 0x83, 0xFF, 0x05, 0x0F, 0x07, 0x03, 0x01, 0x01, 0x80, 0x81, 0xC0,
+    0x89, 0x00, 0x00, 0x80, 0x84, 0x00, 0x06, 0x0E, 0x00, 0x00, 0x0F, 0x00, 0x0E, 0x0E, 0x8D, 0x00,
+    0x16, 0x80, 0x80, 0x20, 0x60, 0xC8, 0x90, 0x20, 0x40, 0x80, 0x00, 0x01, 0x03, 0x07, 0x0F, 0x2F,
+    0x1C, 0x10, 0x20, 0x20, 0x00, 0x00, 0x81, 0x81, 0x84, 0x00, 0x00, 0x20, 0x83, 0x00, 0x08, 0x80,
+    0x00, 0x60, 0x90, 0xC8, 0x60, 0x20, 0x80, 0x80, 0x93, 0x00, 0x09, 0x01, 0x03, 0x02, 0x08, 0x18,
+    0x32, 0x06, 0x0C, 0x01, 0x02, 0x85, 0x00, 0x81, 0x90, 0x01, 0x00, 0x00, 0x81, 0x90, 0x85, 0x00,
+    0x09, 0x02, 0x03, 0x0D, 0x06, 0x32, 0x18, 0x0C, 0x06, 0x03, 0x01, 0xA5, 0x00, 0x81, 0x06, 0x01,
+    0x00, 0x00, 0x81, 0x06, 0x9A, 0x00,
+};
+const OLED_Image img_bg = {64, 64, OLED_IMG_RLE, 246, img_bg_data};
+
+// gImage_bgg 64x64: 512 -> 179 字节
+static const uint8_t img_bgg_data[179] = {
+    0x9E, 0x00, 0x01, 0x20, 0x80, 0xAB, 0x00, 0x06, 0x80, 0xC0, 0xE0, 0xF0, 0xF8, 0xF8, 0xFC, 0x81,
+    0xFE, 0x01, 0xFF, 0x7F, 0x8A, 0xFF, 0x81, 0xFE, 0x08, 0xFC, 0xFC, 0xF8, 0xF8, 0xF0, 0xF0, 0xE0,
+    0xC0, 0x80, 0x98, 0x00, 0x0C, 0x70, 0x7E, 0x3F, 0x3F, 0x0F, 0x0F, 0x07, 0x03, 0x01, 0x01, 0x00,
+    0x38, 0xFE, 0x87, 0xFF, 0x01, 0xCF, 0x07, 0x82, 0x03, 0x01, 0x87, 0xDF, 0x87, 0xFF, 0x02, 0xFE,
+    0xF8, 0xC0, 0x93, 0x00, 0x01, 0xBE, 0x80, 0x89, 0x00, 0x03, 0x03, 0x0F, 0x1F, 0x1F, 0x81, 0x3F,
+    0x00, 0x7F, 0x95, 0xFF, 0x00, 0xD0, 0x91, 0x00, 0x01, 0xC0, 0xC1, 0x89, 0x00, 0x00, 0xC0, 0x82,
+    0xE0, 0x00, 0xC0, 0x82, 0x00, 0x05, 0x01, 0x01, 0x03, 0x07, 0x0F, 0x3F, 0x8B, 0xFF, 0x02, 0x7F,
+    0x1F, 0x01, 0x92, 0x00, 0x0E, 0x03, 0x0F, 0x3E, 0x7C, 0x78, 0xF8, 0xF0, 0xE0, 0xE0, 0xC0, 0xC0,
+    0x81, 0x07, 0x87, 0x0F, 0x81, 0x07, 0x00, 0x01, 0x81, 0x00, 0x05, 0x80, 0x80, 0xC0, 0xE0, 0xF0,
+    0xFC, 0x87, 0xFF, 0x03, 0x3F, 0x1F, 0x07, 0x03, 0x9A, 0x00, 0x06, 0x01, 0x01, 0x07, 0x07, 0x0F,
+    0x1F, 0x1F, 0x81, 0x3F, 0x87, 0x7F, 0x81, 0x3F, 0x81, 0x1F, 0x05, 0x0F, 0x0F, 0x07, 0x03, 0x01,
+    0x01, 0xCD, 0x00,
+};
+const OLED_Image img_bgg = {64, 64, OLED_IMG_RLE, 179, img_bgg_data};
+
+// gImage_xbg 32x32: 128 -> 75 字节
+static const uint8_t img_xbg_data[75] = {
+    0x86, 0x00, 0x02, 0x80, 0xC0, 0xE0, 0x88, 0xF0, 0x03, 0xE0, 0xE0, 0xC0, 0x80, 0x8B, 0x00, 0x0B,
+    0x88, 0x07, 0x07, 0x03, 0x01, 0x00, 0x1E, 0x3F, 0x7F, 0x7F, 0xFF, 0xFF, 0x81, 0xF1, 0x83, 0xFF,
+    0x01, 0xFE, 0xF8, 0x88, 0x00, 0x0D, 0x18, 0x70, 0x60, 0xC0, 0x80, 0x80, 0x18, 0x38, 0x38, 0x18,
+    0x00, 0x00, 0x81, 0xC3, 0x83, 0xFF, 0x02, 0x7F, 0x1F, 0x07, 0x8C, 0x00, 0x01, 0x01, 0x03, 0x82,
+    0x07, 0x00, 0x0F, 0x82, 0x07, 0x02, 0x03, 0x03, 0x01, 0x86, 0x00,
+};
+const OLED_Image img_xbg = {32, 32, OLED_IMG_RLE, 75, img_xbg_data};
+
+// gImage_calendar 32x32: 128 -> 54 字节
+static const uint8_t img_calendar_data[54] = {
+    0x84, 0x00, 0x93, 0xC0, 0x89, 0x00, 0x03, 0xFF, 0x03, 0x03, 0x83, 0x85, 0x03, 0x03, 0xF3, 0x73,
+    0x73, 0x03, 0x81, 0x73, 0x02, 0x03, 0x03, 0xFF, 0x89, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x81, 0x3B,
+    0x00, 0x00, 0x81, 0x3B, 0x00, 0x00, 0x81, 0x3B, 0x00, 0x00, 0x81, 0x03, 0x02, 0x00, 0x00, 0xFF,
+    0x89, 0x00, 0x93, 0x01, 0x83, 0x00,
+};
+const OLED_Image img_calendar = {32, 32, OLED_IMG_RLE, 54, img_calendar_data};
+
+// gImage_clock 32x32: 128 -> 80 字节
+static const uint8_t img_clock_data[80] = {
+    0x83, 0x00, 0x06, 0x80, 0xC0, 0x60, 0x30, 0x30, 0x18, 0x18, 0x85, 0x0C, 0x07, 0x08, 0x18, 0x18,
+    0x30, 0x30, 0x60, 0xC0, 0x80, 0x85, 0x00, 0x03, 0xF0, 0xFC, 0x0F, 0x03, 0x86, 0x00, 0x01, 0xFF,
+    0xFF, 0x88, 0x00, 0x03, 0x03, 0x0F, 0xFC, 0xE0, 0x82, 0x00, 0x04, 0x07, 0x1F, 0x78, 0xE0, 0x80,
+    0x85, 0x00, 0x86, 0x01, 0x81, 0x00, 0x04, 0x80, 0xE0, 0x78, 0x1F, 0x03, 0x86, 0x00, 0x05, 0x01,
+    0x03, 0x06, 0x06, 0x0C, 0x0C, 0x86, 0x18, 0x05, 0x0C, 0x0C, 0x06, 0x06, 0x03, 0x01, 0x84, 0x00,
+};
+const OLED_Image img_clock = {32, 32, OLED_IMG_RLE, 80, img_clock_data};
+
+// gImage_flashlight 32x32: 128 -> 52 字节
+static const uint8_t img_flashlight_data[52] = {
+    0x87, 0x00, 0x02, 0x10, 0x60, 0x80, 0x81, 0x00, 0x01, 0x7C, 0x3C, 0x81, 0x00, 0x02, 0xC0, 0x60,
+    0x10, 0x8F, 0x00, 0x03, 0x0E, 0x1E, 0x32, 0xC2, 0x86, 0x82, 0x03, 0xE2, 0x32, 0x1E, 0x04, 0x92,
+    0x00, 0x07, 0xFD, 0x05, 0x05, 0xE5, 0xE5, 0x05, 0x05, 0xFD, 0x96, 0x00, 0x00, 0x1F, 0x84, 0x10,
+    0x00, 0x1F, 0x8A, 0x00,
+};
+const OLED_Image img_flashlight = {32, 32, OLED_IMG_RLE, 52, img_flashlight_data};
+
+// gImage_stopwatch 32x32: 128 -> 94 字节
+static const uint8_t img_stopwatch_data[94] = {
+    0x88, 0x00, 0x0B, 0xBE, 0x3E, 0x32, 0xF2, 0xF2, 0x02, 0x02, 0xF2, 0xF2, 0x32, 0x3E, 0xBE, 0x81,
+    0x00, 0x04, 0x80, 0xD0, 0x78, 0x70, 0x60, 0x84, 0x00, 0x17, 0xE0, 0x78, 0x1C, 0x0E, 0x03, 0x03,
+    0x01, 0x01, 0x00, 0x01, 0x01, 0xF8, 0xF8, 0x01, 0x01, 0x00, 0x01, 0x01, 0x03, 0x07, 0x0E, 0x3C,
+    0xF0, 0xE0, 0x85, 0x00, 0x03, 0x0F, 0x7F, 0xF0, 0x80, 0x86, 0x00, 0x01, 0x07, 0x07, 0x85, 0x06,
+    0x03, 0x00, 0xC0, 0xF9, 0x39, 0x87, 0x00, 0x08, 0x01, 0x03, 0x07, 0x06, 0x0C, 0x0C, 0x18, 0x18,
+    0x10, 0x82, 0x30, 0x07, 0x10, 0x18, 0x18, 0x0C, 0x0C, 0x06, 0x03, 0x01, 0x84, 0x00,
+};
+const OLED_Image img_stopwatch = {32, 32, OLED_IMG_RLE, 94, img_stopwatch_data};
+
+// gImage_setting 32x32: 128 -> 102 字节
+static const uint8_t img_setting_data[102] = {
+    0x82, 0x00, 0x16, 0x80, 0x80, 0xC0, 0xC0, 0xE0, 0xE0, 0x70, 0x30, 0x38, 0x38, 0x1C, 0x0C, 0x0C,
+    0x1C, 0x38, 0x38, 0x70, 0x70, 0xE0, 0xE0, 0xC0, 0xC0, 0x80, 0x86, 0x00, 0x04, 0xFE, 0xFF, 0xFF,
+    0x01, 0x01, 0x81, 0x00, 0x09, 0xF0, 0xF8, 0x38, 0x1C, 0x0C, 0x0C, 0x1C, 0x38, 0xF8, 0xF0, 0x81,
+    0x00, 0x04, 0x01, 0x01, 0xFF, 0xFF, 0xFE, 0x84, 0x00, 0x0A, 0x1F, 0x3F, 0x7F, 0x60, 0xE0, 0xC0,
+    0xC0, 0x80, 0x81, 0x03, 0x07, 0x82, 0x0E, 0x0A, 0x07, 0x03, 0x81, 0x80, 0xC0, 0xE0, 0xE0, 0x70,
+    0x7F, 0x3F, 0x1F, 0x8A, 0x00, 0x0D, 0x01, 0x01, 0x03, 0x03, 0x07, 0x06, 0x0E, 0x0E, 0x06, 0x07,
+    0x03, 0x03, 0x01, 0x01, 0x87, 0x00,
+};
+const OLED_Image img_setting = {32, 32, OLED_IMG_RLE, 102, img_setting_data};
+
+// gImage_TandH 32x32: 128 -> 95 字节
+static const uint8_t img_TandH_data[95] = {
+    0x82, 0x00, 0x09, 0xF8, 0xFC, 0x0E, 0x06, 0x07, 0x06, 0x06, 0xFE, 0xFC, 0xE0, 0x94, 0x00, 0x01,
+    0xFF, 0xFF, 0x83, 0x00, 0x81, 0xFF, 0x85, 0x00, 0x01, 0x80, 0xC0, 0x81, 0xF0, 0x01, 0xC0, 0x80,
+    0x82, 0x00, 0x14, 0x40, 0xF8, 0xFE, 0x0F, 0x43, 0xF3, 0xF8, 0xF8, 0xFC, 0xFC, 0xF8, 0xF9, 0xF3,
+    0x07, 0x1E, 0xFC, 0xF0, 0x00, 0xE0, 0xF8, 0xFE, 0x85, 0xFF, 0x18, 0xFE, 0xF8, 0xE0, 0x00, 0x00,
+    0x03, 0x0F, 0x1E, 0x18, 0x39, 0x33, 0x37, 0x77, 0x77, 0x33, 0x33, 0x39, 0x1C, 0x0F, 0x07, 0x01,
+    0x00, 0x07, 0x0F, 0x1F, 0x81, 0x3F, 0x00, 0x7F, 0x81, 0x3F, 0x03, 0x1F, 0x0F, 0x07, 0x00,
+};
+const OLED_Image img_TandH = {32, 32, OLED_IMG_RLE, 95, img_TandH_data};
+
+// gImage_sun 32x32: 128 -> 71 字节
+static const uint8_t img_sun_data[71] = {
+    0x8C, 0x00, 0x01, 0x70, 0x40, 0x82, 0x00, 0x02, 0x80, 0xC0, 0xC0, 0x8C, 0x00, 0x09, 0x80, 0x80,
+    0x83, 0x03, 0xF2, 0x18, 0x04, 0x06, 0x03, 0x03, 0x81, 0x01, 0x05, 0x03, 0x02, 0x06, 0x0D, 0xF0,
+    0x00, 0x82, 0x10, 0x87, 0x00, 0x0A, 0x01, 0x01, 0x60, 0x30, 0x33, 0x0E, 0x18, 0x10, 0x30, 0xA0,
+    0xA0, 0x81, 0x20, 0x07, 0x10, 0xD8, 0xCC, 0x07, 0x00, 0x0C, 0x08, 0x18, 0x91, 0x00, 0x00, 0x03,
+    0x84, 0x00, 0x01, 0x01, 0x01, 0x87, 0x00,
+};
+const OLED_Image img_sun = {32, 32, OLED_IMG_RLE, 71, img_sun_data};
+
+// gImage_moon 32x32: 128 -> 71 字节
+static const uint8_t img_moon_data[71] = {
+    0x91, 0x00, 0x06, 0x18, 0xF0, 0xF0, 0x60, 0xE0, 0xC0, 0x80, 0x94, 0x00, 0x0C, 0x80, 0xC0, 0xF0,
+    0x3E, 0x0F, 0x01, 0x00, 0x00, 0x01, 0x07, 0x1F, 0xFC, 0xE0, 0x85, 0x00, 0x0D, 0x18, 0x78, 0xF8,
+    0xD8, 0x98, 0x18, 0x18, 0x0C, 0x0C, 0x0E, 0x06, 0x03, 0x03, 0x01, 0x83, 0x00, 0x05, 0x80, 0xC0,
+    0xF0, 0x3C, 0x1F, 0x03, 0x88, 0x00, 0x05, 0x01, 0x03, 0x03, 0x06, 0x06, 0x04, 0x84, 0x0C, 0x81,
+    0x06, 0x02, 0x03, 0x01, 0x01, 0x85, 0x00,
+};
+const OLED_Image img_moon = {32, 32, OLED_IMG_RLE, 71, img_moon_data};
+
+// gImage_bell 32x32: 128 -> 66 字节
+static const uint8_t img_bell_data[66] = {
+    0x86, 0x00, 0x0F, 0x80, 0xC0, 0xC0, 0x60, 0x20, 0x30, 0x30, 0x38, 0x38, 0x30, 0x30, 0x60, 0x60,
+    0xC0, 0xC0, 0x80, 0x8C, 0x00, 0x03, 0xFC, 0xFF, 0x03, 0x01, 0x8A, 0x00, 0x03, 0x01, 0x07, 0xFE,
+    0xF8, 0x87, 0x00, 0x81, 0x80, 0x01, 0xFF, 0xFF, 0x8E, 0x80, 0x01, 0xFF, 0xFF, 0x81, 0x80, 0x84,
+    0x00, 0x86, 0x01, 0x09, 0x07, 0x07, 0x0D, 0x0D, 0x19, 0x09, 0x0D, 0x0D, 0x07, 0x03, 0x86, 0x01,
+    0x81, 0x00,
+};
+const OLED_Image img_bell = {32, 32, OLED_IMG_RLE, 66, img_bell_data};
+
+// gImage_list 32x32: 128 -> 15 字节
+static const uint8_t img_list_data[15] = {
+    0x01, 0x00, 0x00, 0x99, 0x20, 0x83, 0x00, 0x99, 0x80, 0xA3, 0x00, 0x99, 0x02, 0x81, 0x00,
+};
+const OLED_Image img_list = {32, 32, OLED_IMG_RLE, 15, img_list_data};
+
+// gImage_new 32x32: 128 -> 24 字节
+static const uint8_t img_new_data[24] = {
+    0x8C, 0x00, 0x82, 0xFF, 0x8C, 0x00, 0x8C, 0xC0, 0x82, 0xFF, 0x8C, 0xC0, 0x8C, 0x01, 0x82, 0xFF,
+    0x8C, 0x01, 0x8C, 0x00, 0x82, 0x7F, 0x8C, 0x00,
+};
+const OLED_Image img_new = {32, 32, OLED_IMG_RLE, 24, img_new_data};
+
+// gImage_add 32x32: 128 -> 83 字节
+static const uint8_t img_add_data[83] = {
+    0x84, 0x00, 0x04, 0x80, 0xC0, 0x60, 0x30, 0x30, 0x81, 0x18, 0x82, 0x08, 0x81, 0x18, 0x04, 0x30,
+    0x30, 0x60, 0xC0, 0x80, 0x87, 0x00, 0x04, 0xF8, 0x3E, 0x07, 0x01, 0x00, 0x85, 0x80, 0x01, 0xFF,
+    0xFF, 0x85, 0x80, 0x04, 0x00, 0x01, 0x07, 0xFE, 0xF0, 0x84, 0x00, 0x04, 0x0F, 0x3E, 0x70, 0xC0,
+    0x80, 0x85, 0x00, 0x01, 0x7F, 0x7F, 0x85, 0x00, 0x04, 0x80, 0xC0, 0x70, 0x3F, 0x07, 0x88, 0x00,
+    0x03, 0x01, 0x03, 0x06, 0x06, 0x81, 0x0C, 0x82, 0x08, 0x06, 0x0C, 0x0C, 0x04, 0x06, 0x06, 0x03,
+    0x01, 0x85, 0x00,
+};
+const OLED_Image img_add = {32, 32, OLED_IMG_RLE, 83, img_add_data};
+
+// gImage_step 32x32: 128 -> 66 字节
+static const uint8_t img_step_data[66] = {
+    0x85, 0x00, 0x00, 0x80, 0x83, 0xC0, 0x00, 0x80, 0x82, 0x00, 0x01, 0xF0, 0xF0, 0x82, 0xF8, 0x02,
+    0xF0, 0xE0, 0x80, 0x88, 0x00, 0x00, 0xFC, 0x85, 0xFF, 0x00, 0x7F, 0x82, 0x00, 0x00, 0x3F, 0x85,
+    0xFF, 0x00, 0x1F, 0x88, 0x00, 0x84, 0x8F, 0x01, 0x0F, 0x03, 0x84, 0x00, 0x03, 0x01, 0x73, 0xF3,
+    0xF3, 0x81, 0xF1, 0x89, 0x00, 0x00, 0x07, 0x81, 0x0F, 0x01, 0x07, 0x01, 0x88, 0x00, 0x82, 0x01,
+    0x85, 0x00,
+};
+const OLED_Image img_step = {32, 32, OLED_IMG_RLE, 66, img_step_data};
+
+// gImage_test 32x32: 128 -> 56 字节
+static const uint8_t img_test_data[56] = {
+    0x87, 0x00, 0x03, 0x30, 0x30, 0xF0, 0xF0, 0x84, 0x30, 0x03, 0xF0, 0xF0, 0x30, 0x30, 0x90, 0x00,
+    0x03, 0xE0, 0xF8, 0x3F, 0x0F, 0x84, 0x00, 0x03, 0x0F, 0x3F, 0xF8, 0xE0, 0x8C, 0x00, 0x04, 0xC0,
+    0xF0, 0x3C, 0x0F, 0x0F, 0x8A, 0x0C, 0x04, 0x0F, 0x0F, 0x3C, 0xF0, 0xC0, 0x88, 0x00, 0x01, 0x07,
+    0x0F, 0x90, 0x0C, 0x01, 0x0F, 0x07, 0x83, 0x00,
+};
+const OLED_Image img_test = {32, 32, OLED_IMG_RLE, 56, img_test_data};
+
+// bagua_frames 8帧 128x64: 8192 -> 2772 字节
+static const uint8_t anim_bagua_0[869] = {
+    0xC0, 0x00, 0x03, 0x03, 0x0C, 0x30, 0xC0, 0x82, 0x00, 0x03, 0x03, 0x0C, 0x30, 0xC0, 0x82, 0x00,
+    0x03, 0x03, 0x0C, 0x30, 0xC0, 0x82, 0x00, 0x03, 0x03, 0x0C, 0x30, 0xC0, 0x82, 0x00, 0x03, 0x03,
+    0x0C, 0x30, 0xC0, 0x82, 0x00, 0x03, 0x03, 0x0C, 0x30, 0xC0, 0x82, 0x00, 0x03, 0x03, 0x0C, 0x30,
+    0xC0, 0x82, 0x00, 0x03, 0x03, 0x0C, 0x30, 0xC0, 0x81, 0x00, 0x7F, 0x01, 0x07, 0x1E, 0x78, 0xE0,
+    0x80, 0x00, 0x00, 0x01, 0x07, 0x1E, 0x78, 0xE0, 0x80, 0x00, 0x00, 0x01, 0x07, 0x1E, 0x78, 0xE0,
+    0x80, 0x00, 0x00, 0x01, 0x07, 0x1E, 0x78, 0xE0, 0x80, 0x00, 0x00, 0x01, 0x07, 0x1E, 0x78, 0xE0,
+    0x80, 0x00, 0x00, 0x01, 0x07, 0x1E, 0x78, 0xE0, 0x80, 0x00, 0x00, 0x01, 0x07, 0x1E, 0x78, 0xE0,
+    0x80, 0x00, 0x00, 0x01, 0x07, 0x1E, 0x78, 0xE0, 0x80, 0x00, 0x00, 0x03, 0x0F, 0x3F, 0xFC, 0xF0,
+    0xC0, 0x00, 0x00, 0x03, 0x0F, 0x3F, 0xFC, 0xF0, 0xC0, 0x00, 0x00, 0x03, 0x0F, 0x3F, 0xFC, 0xF0,
+    0xC0, 0x00, 0x00, 0x03, 0x0F, 0x3F, 0xFC, 0xF0, 0xC0, 0x00, 0x00, 0x03, 0x0F, 0x3F, 0xFC, 0xF0,
+    0xC0, 0x00, 0x00, 0x03, 0x0F, 0x3F, 0xFC, 0xF0, 0xC0, 0x00, 0x00, 0x03, 0x0F, 0x3F, 0xFC, 0xF0,
+    0xC0, 0x00, 0x00, 0x03, 0x0F, 0x3F, 0xFC, 0xF0, 0xC0, 0x00, 0x00, 0x01, 0x07, 0x1F, 0x81, 0x7E,
+    0x04, 0xE0, 0x00, 0x00, 0x07, 0x1F, 0x81, 0x7E, 0x14, 0xE0, 0x00, 0x00, 0x07, 0x1F, 0x7E, 0x00,
+    0x7E, 0xE0, 0x00, 0x00, 0x07, 0x1F, 0x7E, 0x00, 0x7E, 0xE0, 0x00, 0x00, 0x07, 0x1F, 0x81, 0x7E,
+    0x04, 0xE0, 0x00, 0x00, 0x07, 0x1F, 0x81, 0x7E, 0x04, 0xE0, 0x00, 0x00, 0x07, 0x1F, 0x81, 0x7E,
+    0x04, 0xE0, 0x00, 0x00, 0x07, 0x1F, 0x81, 0x7E, 0x04, 0xE0, 0x00, 0x00, 0x0F, 0x3F, 0x81, 0xFC,
+    0x04, 0xF0, 0x00, 0x00, 0x0F, 0x3F, 0x81, 0xFC, 0x14, 0xF0, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xFF,
+    0xFC, 0xF0, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xFF, 0xFC, 0xF0, 0x00, 0x00, 0x0F, 0x3F, 0x81, 0xFC,
+    0x04, 0xF0, 0x00, 0x00, 0x0F, 0x3F, 0x81, 0xFC, 0x04, 0xF0, 0x00, 0x00, 0x0F, 0x3F, 0x81, 0xFC,
+    0x04, 0xF0, 0x00, 0x00, 0x0F, 0x3F, 0x81, 0xFC, 0x04, 0xF0, 0x00, 0x00, 0x1F, 0x7F, 0x81, 0xFE,
+    0x04, 0xF8, 0x00, 0x00, 0x1F, 0x7F, 0x81, 0xFE, 0x04, 0xF8, 0x00, 0x00, 0x1F, 0x7F, 0x81, 0xFE,
+    0x04, 0xF8, 0x00, 0x00, 0x1F, 0x7F, 0x81, 0xFE, 0x04, 0xF8, 0x00, 0x00, 0x1F, 0x7F, 0x81, 0xFE,
+    0x04, 0xF8, 0x00, 0x00, 0x1F, 0x7F, 0x81, 0xFE, 0x04, 0xF8, 0x00, 0x00, 0x1F, 0x7F, 0x81, 0xFE,
+    0x04, 0xF8, 0x00, 0x00, 0x1F, 0x7F, 0x81, 0xFE, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x82, 0xFF, 0x03,
+    0xFC, 0x00, 0x00, 0x3F, 0x82, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0x82, 0xFF, 0x03, 0xFC, 0x00,
+    0x00, 0x3F, 0x82, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0x82, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x3F,
+    0x82, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0x82, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0x82, 0xFF,
+    0x03, 0xFC, 0x00, 0x00, 0x3F, 0x82, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0x82, 0xFF, 0x03, 0xFC,
+    0x00, 0x00, 0x3F, 0x82, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0x82, 0xFF, 0x03, 0xFC, 0x00, 0x00,
+    0x3F, 0x82, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0x82, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0x82,
+    0xFF, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0x82, 0xFF, 0x04, 0xFC, 0x00, 0x00, 0x1F, 0x7F, 0x81, 0xFE,
+    0x04, 0xF8, 0x00, 0x00, 0x1F, 0x7F, 0x81, 0xFE, 0x04, 0xF8, 0x00, 0x00, 0x1F, 0x7F, 0x81, 0xFE,
+    0x04, 0xF8, 0x00, 0x00, 0x1F, 0x7F, 0x81, 0xFE, 0x04, 0xF8, 0x00, 0x00, 0x1F, 0x7F, 0x81, 0xFE,
+    0x04, 0xF8, 0x00, 0x00, 0x1F, 0x7F, 0x81, 0xFE, 0x04, 0xF8, 0x00, 0x00, 0x1F, 0x7F, 0x81, 0xFE,
+    0x04, 0xF8, 0x00, 0x00, 0x1F, 0x7F, 0x81, 0xFE, 0x04, 0xF8, 0x00, 0x00, 0x0F, 0x3F, 0x81, 0xFC,
+    0x04, 0xF0, 0x00, 0x00, 0x0F, 0x3F, 0x81, 0xFC, 0x04, 0xF0, 0x00, 0x00, 0x0F, 0x3F, 0x81, 0xFC,
+    0x04, 0xF0, 0x00, 0x00, 0x0F, 0x3F, 0x81, 0xFC, 0x04, 0xF0, 0x00, 0x00, 0x0F, 0x3F, 0x81, 0xFC,
+    0x04, 0xF0, 0x00, 0x00, 0x0F, 0x3F, 0x81, 0xFC, 0x04, 0xF0, 0x00, 0x00, 0x0F, 0x3F, 0x81, 0xFC,
+    0x04, 0xF0, 0x00, 0x00, 0x0F, 0x3F, 0x81, 0xFC, 0x04, 0xF0, 0x00, 0x00, 0x07, 0x1F, 0x81, 0x7E,
+    0x04, 0xE0, 0x00, 0x00, 0x07, 0x1F, 0x81, 0x7E, 0x04, 0xE0, 0x00, 0x00, 0x07, 0x1F, 0x81, 0x7E,
+    0x04, 0xE0, 0x00, 0x00, 0x07, 0x1F, 0x81, 0x7E, 0x04, 0xE0, 0x00, 0x00, 0x07, 0x1F, 0x81, 0x7E,
+    0x04, 0xE0, 0x00, 0x00, 0x07, 0x1F, 0x81, 0x7E, 0x04, 0xE0, 0x00, 0x00, 0x07, 0x1F, 0x81, 0x7E,
+    0x04, 0xE0, 0x00, 0x00, 0x07, 0x1F, 0x81, 0x7E, 0x7F, 0xE0, 0x00, 0x00, 0x03, 0x0F, 0x3F, 0xFC,
+    0xF0, 0xC0, 0x00, 0x00, 0x03, 0x0F, 0x3F, 0xFC, 0xF0, 0xC0, 0x00, 0x00, 0x03, 0x0F, 0x3F, 0xFC,
+    0xF0, 0xC0, 0x00, 0x00, 0x03, 0x0F, 0x3F, 0xFC, 0xF0, 0xC0, 0x00, 0x00, 0x03, 0x0F, 0x3F, 0xFC,
+    0xF0, 0xC0, 0x00, 0x00, 0x03, 0x0F, 0x3F, 0xFC, 0xF0, 0xC0, 0x00, 0x00, 0x03, 0x0F, 0x3F, 0xFC,
+    0xF0, 0xC0, 0x00, 0x00, 0x03, 0x0F, 0x3F, 0xFC, 0xF0, 0xC0, 0x00, 0x00, 0x01, 0x07, 0x1E, 0x78,
+    0xE0, 0x80, 0x00, 0x00, 0x01, 0x07, 0x1E, 0x78, 0xE0, 0x80, 0x00, 0x00, 0x01, 0x07, 0x1E, 0x78,
+    0xE0, 0x80, 0x00, 0x00, 0x01, 0x07, 0x1E, 0x78, 0xE0, 0x80, 0x00, 0x00, 0x01, 0x07, 0x1E, 0x78,
+    0xE0, 0x80, 0x00, 0x00, 0x01, 0x07, 0x1E, 0x78, 0xE0, 0x80, 0x00, 0x00, 0x01, 0x07, 0x1E, 0x78,
+    0xE0, 0x80, 0x00, 0x00, 0x01, 0x07, 0x1E, 0x78, 0xE0, 0x00, 0x80, 0x81, 0x00, 0x03, 0x03, 0x0C,
+    0x30, 0xC0, 0x82, 0x00, 0x03, 0x03, 0x0C, 0x30, 0xC0, 0x82, 0x00, 0x03, 0x03, 0x0C, 0x30, 0xC0,
+    0x82, 0x00, 0x03, 0x03, 0x0C, 0x30, 0xC0, 0x82, 0x00, 0x03, 0x03, 0x0C, 0x30, 0xC0, 0x82, 0x00,
+    0x03, 0x03, 0x0C, 0x30, 0xC0, 0x82, 0x00, 0x03, 0x03, 0x0C, 0x30, 0xC0, 0x82, 0x00, 0x03, 0x03,
+    0x0C, 0x30, 0xC0, 0xC0, 0x00,
+};
+static const uint8_t anim_bagua_1[812] = {
+    0xC0, 0x00, 0x04, 0x04, 0x12, 0x48, 0x20, 0x80, 0x81, 0x00, 0x04, 0x04, 0x12, 0x48, 0x20, 0x80,
+    0x81, 0x00, 0x04, 0x04, 0x12, 0x48, 0x20, 0x80, 0x81, 0x00, 0x04, 0x04, 0x12, 0x48, 0x20, 0x80,
+    0x81, 0x00, 0x04, 0x04, 0x12, 0x48, 0x20, 0x80, 0x81, 0x00, 0x04, 0x04, 0x12, 0x48, 0x20, 0x80,
+    0x81, 0x00, 0x04, 0x04, 0x12, 0x48, 0x20, 0x80, 0x81, 0x00, 0x04, 0x04, 0x12, 0x48, 0x20, 0x80,
+    0xC0, 0x00, 0x41, 0x03, 0x0F, 0x3F, 0xFC, 0xF0, 0xC0, 0x00, 0x00, 0x03, 0x0F, 0x3F, 0xFC, 0xF0,
+    0xC0, 0x00, 0x00, 0x03, 0x0F, 0x3F, 0xFC, 0xF0, 0xC0, 0x00, 0x00, 0x03, 0x0F, 0x3F, 0xFC, 0xF0,
+    0xC0, 0x00, 0x00, 0x03, 0x0F, 0x3F, 0xFC, 0xF0, 0xC0, 0x00, 0x00, 0x03, 0x0F, 0x3F, 0xFC, 0xF0,
+    0xC0, 0x00, 0x00, 0x03, 0x0F, 0x3F, 0xFC, 0xF0, 0xC0, 0x00, 0x00, 0x03, 0x0F, 0x3F, 0xFC, 0xF0,
+    0xC0, 0x00, 0x00, 0x07, 0x1F, 0x81, 0x7E, 0x04, 0xE0, 0x00, 0x00, 0x07, 0x1F, 0x81, 0x7E, 0x14,
+    0xE0, 0x00, 0x00, 0x07, 0x1F, 0x7E, 0x00, 0x7E, 0xE0, 0x00, 0x00, 0x07, 0x1F, 0x7E, 0x00, 0x7E,
+    0xE0, 0x00, 0x00, 0x07, 0x1F, 0x81, 0x7E, 0x04, 0xE0, 0x00, 0x00, 0x07, 0x1F, 0x81, 0x7E, 0x04,
+    0xE0, 0x00, 0x00, 0x07, 0x1F, 0x81, 0x7E, 0x04, 0xE0, 0x00, 0x00, 0x07, 0x1F, 0x81, 0x7E, 0x04,
+    0xE0, 0x00, 0x00, 0x0F, 0x3F, 0x81, 0xFC, 0x04, 0xF0, 0x00, 0x00, 0x0F, 0x3F, 0x81, 0xFC, 0x14,
+    0xF0, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xFF, 0xFC, 0xF0, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xFF, 0xFC,
+    0xF0, 0x00, 0x00, 0x0F, 0x3F, 0x81, 0xFC, 0x04, 0xF0, 0x00, 0x00, 0x0F, 0x3F, 0x81, 0xFC, 0x04,
+    0xF0, 0x00, 0x00, 0x0F, 0x3F, 0x81, 0xFC, 0x04, 0xF0, 0x00, 0x00, 0x0F, 0x3F, 0x81, 0xFC, 0x04,
+    0xF0, 0x00, 0x00, 0x1F, 0x7F, 0x81, 0xFE, 0x04, 0xF8, 0x00, 0x00, 0x1F, 0x7F, 0x81, 0xFE, 0x04,
+    0xF8, 0x00, 0x00, 0x1F, 0x7F, 0x81, 0xFE, 0x04, 0xF8, 0x00, 0x00, 0x1F, 0x7F, 0x81, 0xFE, 0x04,
+    0xF8, 0x00, 0x00, 0x1F, 0x7F, 0x81, 0xFE, 0x04, 0xF8, 0x00, 0x00, 0x1F, 0x7F, 0x81, 0xFE, 0x04,
+    0xF8, 0x00, 0x00, 0x1F, 0x7F, 0x81, 0xFE, 0x04, 0xF8, 0x00, 0x00, 0x1F, 0x7F, 0x81, 0xFE, 0x03,
+    0xF8, 0x00, 0x00, 0x3F, 0x82, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0x82, 0xFF, 0x03, 0xFC, 0x00,
+    0x00, 0x3F, 0x82, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0x82, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x3F,
+    0x82, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0x82, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0x82, 0xFF,
+    0x03, 0xFC, 0x00, 0x00, 0x3F, 0x82, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0x82, 0xFF, 0x03, 0xFC,
+    0x00, 0x00, 0x3F, 0x82, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0x82, 0xFF, 0x03, 0xFC, 0x00, 0x00,
+    0x3F, 0x82, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0x82, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0x82,
+    0xFF, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0x82, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0x82, 0xFF, 0x04,
+    0xFC, 0x00, 0x00, 0x1F, 0x7F, 0x81, 0xFE, 0x04, 0xF8, 0x00, 0x00, 0x1F, 0x7F, 0x81, 0xFE, 0x04,
+    0xF8, 0x00, 0x00, 0x1F, 0x7F, 0x81, 0xFE, 0x04, 0xF8, 0x00, 0x00, 0x1F, 0x7F, 0x81, 0xFE, 0x04,
+    0xF8, 0x00, 0x00, 0x1F, 0x7F, 0x81, 0xFE, 0x04, 0xF8, 0x00, 0x00, 0x1F, 0x7F, 0x81, 0xFE, 0x04,
+    0xF8, 0x00, 0x00, 0x1F, 0x7F, 0x81, 0xFE, 0x04, 0xF8, 0x00, 0x00, 0x1F, 0x7F, 0x81, 0xFE, 0x04,
+    0xF8, 0x00, 0x00, 0x0F, 0x3F, 0x81, 0xFC, 0x04, 0xF0, 0x00, 0x00, 0x0F, 0x3F, 0x81, 0xFC, 0x04,
+    0xF0, 0x00, 0x00, 0x0F, 0x3F, 0x81, 0xFC, 0x04, 0xF0, 0x00, 0x00, 0x0F, 0x3F, 0x81, 0xFC, 0x04,
+    0xF0, 0x00, 0x00, 0x0F, 0x3F, 0x81, 0xFC, 0x04, 0xF0, 0x00, 0x00, 0x0F, 0x3F, 0x81, 0xFC, 0x04,
+    0xF0, 0x00, 0x00, 0x0F, 0x3F, 0x81, 0xFC, 0x04, 0xF0, 0x00, 0x00, 0x0F, 0x3F, 0x81, 0xFC, 0x04,
+    0xF0, 0x00, 0x00, 0x07, 0x1F, 0x81, 0x7E, 0x04, 0xE0, 0x00, 0x00, 0x07, 0x1F, 0x81, 0x7E, 0x04,
+    0xE0, 0x00, 0x00, 0x07, 0x1F, 0x81, 0x7E, 0x04, 0xE0, 0x00, 0x00, 0x07, 0x1F, 0x81, 0x7E, 0x04,
+    0xE0, 0x00, 0x00, 0x07, 0x1F, 0x81, 0x7E, 0x04, 0xE0, 0x00, 0x00, 0x07, 0x1F, 0x81, 0x7E, 0x04,
+    0xE0, 0x00, 0x00, 0x07, 0x1F, 0x81, 0x7E, 0x04, 0xE0, 0x00, 0x00, 0x07, 0x1F, 0x81, 0x7E, 0x7F,
+    0xE0, 0x00, 0x00, 0x03, 0x0F, 0x3F, 0xFC, 0xF0, 0xC0, 0x00, 0x00, 0x03, 0x0F, 0x3F, 0xFC, 0xF0,
+    0xC0, 0x00, 0x00, 0x03, 0x0F, 0x3F, 0xFC, 0xF0, 0xC0, 0x00, 0x00, 0x03, 0x0F, 0x3F, 0xFC, 0xF0,
+    0xC0, 0x00, 0x00, 0x03, 0x0F, 0x3F, 0xFC, 0xF0, 0xC0, 0x00, 0x00, 0x03, 0x0F, 0x3F, 0xFC, 0xF0,
+    0xC0, 0x00, 0x00, 0x03, 0x0F, 0x3F, 0xFC, 0xF0, 0xC0, 0x00, 0x00, 0x03, 0x0F, 0x3F, 0xFC, 0xF0,
+    0xC0, 0x00, 0x00, 0x01, 0x07, 0x1E, 0x78, 0xE0, 0x80, 0x00, 0x00, 0x01, 0x07, 0x1E, 0x78, 0xE0,
+    0x80, 0x00, 0x00, 0x01, 0x07, 0x1E, 0x78, 0xE0, 0x80, 0x00, 0x00, 0x01, 0x07, 0x1E, 0x78, 0xE0,
+    0x80, 0x00, 0x00, 0x01, 0x07, 0x1E, 0x78, 0xE0, 0x80, 0x00, 0x00, 0x01, 0x07, 0x1E, 0x78, 0xE0,
+    0x80, 0x00, 0x00, 0x01, 0x07, 0x1E, 0x78, 0xE0, 0x80, 0x00, 0x00, 0x01, 0x07, 0x1E, 0x78, 0xE0,
+    0x00, 0x80, 0x81, 0x00, 0x03, 0x03, 0x0C, 0x30, 0xC0, 0x82, 0x00, 0x03, 0x03, 0x0C, 0x30, 0xC0,
+    0x82, 0x00, 0x03, 0x03, 0x0C, 0x30, 0xC0, 0x82, 0x00, 0x03, 0x03, 0x0C, 0x30, 0xC0, 0x82, 0x00,
+    0x03, 0x03, 0x0C, 0x30, 0xC0, 0x82, 0x00, 0x03, 0x03, 0x0C, 0x30, 0xC0, 0x82, 0x00, 0x03, 0x03,
+    0x0C, 0x30, 0xC0, 0x82, 0x00, 0x03, 0x03, 0x0C, 0x30, 0xC0, 0xC0, 0x00,
+};
+static const uint8_t anim_bagua_2[142] = {
+    0xC0, 0x00, 0x04, 0x07, 0x1E, 0x78, 0xE0, 0x80, 0x81, 0x00, 0x04, 0x07, 0x1E, 0x78, 0xE0, 0x80,
+    0x81, 0x00, 0x04, 0x07, 0x1E, 0x78, 0xE0, 0x80, 0x81, 0x00, 0x04, 0x07, 0x1E, 0x78, 0xE0, 0x80,
+    0x81, 0x00, 0x04, 0x07, 0x1E, 0x78, 0xE0, 0x80, 0x81, 0x00, 0x04, 0x07, 0x1E, 0x78, 0xE0, 0x80,
+    0x81, 0x00, 0x04, 0x07, 0x1E, 0x78, 0xE0, 0x80, 0x81, 0x00, 0x44, 0x07, 0x1E, 0x78, 0xE0, 0x80,
+    0x00, 0x00, 0x01, 0x07, 0x1E, 0x78, 0xE0, 0x80, 0x00, 0x00, 0x01, 0x07, 0x1E, 0x78, 0xE0, 0x80,
+    0x00, 0x00, 0x01, 0x07, 0x1E, 0x78, 0xE0, 0x80, 0x00, 0x00, 0x01, 0x07, 0x1E, 0x78, 0xE0, 0x80,
+    0x00, 0x00, 0x01, 0x07, 0x1E, 0x78, 0xE0, 0x80, 0x00, 0x00, 0x01, 0x07, 0x1E, 0x78, 0xE0, 0x80,
+    0x00, 0x00, 0x01, 0x07, 0x1E, 0x78, 0xE0, 0x80, 0x00, 0x00, 0x01, 0x07, 0x1E, 0x78, 0xE0, 0x80,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xB9, 0x00,
+};
+static const uint8_t anim_bagua_3[16] = {
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xF7, 0x00,
+};
+static const uint8_t anim_bagua_4[16] = {
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xF7, 0x00,
+};
+static const uint8_t anim_bagua_5[16] = {
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xF7, 0x00,
+};
+static const uint8_t anim_bagua_6[16] = {
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xF7, 0x00,
+};
+static const uint8_t anim_bagua_7[16] = {
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xF7, 0x00,
+};
+static const uint8_t anim_bagua_8[869] = {
+    0xC0, 0x00, 0x03, 0x03, 0x0C, 0x30, 0xC0, 0x82, 0x00, 0x03, 0x03, 0x0C, 0x30, 0xC0, 0x82, 0x00,
+    0x03, 0x03, 0x0C, 0x30, 0xC0, 0x82, 0x00, 0x03, 0x03, 0x0C, 0x30, 0xC0, 0x82, 0x00, 0x03, 0x03,
+    0x0C, 0x30, 0xC0, 0x82, 0x00, 0x03, 0x03, 0x0C, 0x30, 0xC0, 0x82, 0x00, 0x03, 0x03, 0x0C, 0x30,
+    0xC0, 0x82, 0x00, 0x03, 0x03, 0x0C, 0x30, 0xC0, 0x81, 0x00, 0x7F, 0x01, 0x07, 0x1E, 0x78, 0xE0,
+    0x80, 0x00, 0x00, 0x01, 0x07, 0x1E, 0x78, 0xE0, 0x80, 0x00, 0x00, 0x01, 0x07, 0x1E, 0x78, 0xE0,
+    0x80, 0x00, 0x00, 0x01, 0x07, 0x1E, 0x78, 0xE0, 0x80, 0x00, 0x00, 0x01, 0x07, 0x1E, 0x78, 0xE0,
+    0x80, 0x00, 0x00, 0x01, 0x07, 0x1E, 0x78, 0xE0, 0x80, 0x00, 0x00, 0x01, 0x07, 0x1E, 0x78, 0xE0,
+    0x80, 0x00, 0x00, 0x01, 0x07, 0x1E, 0x78, 0xE0, 0x80, 0x00, 0x00, 0x03, 0x0F, 0x3F, 0xFC, 0xF0,
+    0xC0, 0x00, 0x00, 0x03, 0x0F, 0x3F, 0xFC, 0xF0, 0xC0, 0x00, 0x00, 0x03, 0x0F, 0x3F, 0xFC, 0xF0,
+    0xC0, 0x00, 0x00, 0x03, 0x0F, 0x3F, 0xFC, 0xF0, 0xC0, 0x00, 0x00, 0x03, 0x0F, 0x3F, 0xFC, 0xF0,
+    0xC0, 0x00, 0x00, 0x03, 0x0F, 0x3F, 0xFC, 0xF0, 0xC0, 0x00, 0x00, 0x03, 0x0F, 0x3F, 0xFC, 0xF0,
+    0xC0, 0x00, 0x00, 0x03, 0x0F, 0x3F, 0xFC, 0xF0, 0xC0, 0x00, 0x00, 0x01, 0x07, 0x1F, 0x81, 0x7E,
+    0x04, 0xE0, 0x00, 0x00, 0x07, 0x1F, 0x81, 0x7E, 0x14, 0xE0, 0x00, 0x00, 0x07, 0x1F, 0x7E, 0x00,
+    0x7E, 0xE0, 0x00, 0x00, 0x07, 0x1F, 0x7E, 0x00, 0x7E, 0xE0, 0x00, 0x00, 0x07, 0x1F, 0x81, 0x7E,
+    0x04, 0xE0, 0x00, 0x00, 0x07, 0x1F, 0x81, 0x7E, 0x04, 0xE0, 0x00, 0x00, 0x07, 0x1F, 0x81, 0x7E,
+    0x04, 0xE0, 0x00, 0x00, 0x07, 0x1F, 0x81, 0x7E, 0x04, 0xE0, 0x00, 0x00, 0x0F, 0x3F, 0x81, 0xFC,
+    0x04, 0xF0, 0x00, 0x00, 0x0F, 0x3F, 0x81, 0xFC, 0x14, 0xF0, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xFF,
+    0xFC, 0xF0, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xFF, 0xFC, 0xF0, 0x00, 0x00, 0x0F, 0x3F, 0x81, 0xFC,
+    0x04, 0xF0, 0x00, 0x00, 0x0F, 0x3F, 0x81, 0xFC, 0x04, 0xF0, 0x00, 0x00, 0x0F, 0x3F, 0x81, 0xFC,
+    0x04, 0xF0, 0x00, 0x00, 0x0F, 0x3F, 0x81, 0xFC, 0x04, 0xF0, 0x00, 0x00, 0x1F, 0x7F, 0x81, 0xFE,
+    0x04, 0xF8, 0x00, 0x00, 0x1F, 0x7F, 0x81, 0xFE, 0x04, 0xF8, 0x00, 0x00, 0x1F, 0x7F, 0x81, 0xFE,
+    0x04, 0xF8, 0x00, 0x00, 0x1F, 0x7F, 0x81, 0xFE, 0x04, 0xF8, 0x00, 0x00, 0x1F, 0x7F, 0x81, 0xFE,
+    0x04, 0xF8, 0x00, 0x00, 0x1F, 0x7F, 0x81, 0xFE, 0x04, 0xF8, 0x00, 0x00, 0x1F, 0x7F, 0x81, 0xFE,
+    0x04, 0xF8, 0x00, 0x00, 0x1F, 0x7F, 0x81, 0xFE, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x82, 0xFF, 0x03,
+    0xFC, 0x00, 0x00, 0x3F, 0x82, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0x82, 0xFF, 0x03, 0xFC, 0x00,
+    0x00, 0x3F, 0x82, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0x82, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x3F,
+    0x82, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0x82, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0x82, 0xFF,
+    0x03, 0xFC, 0x00, 0x00, 0x3F, 0x82, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0x82, 0xFF, 0x03, 0xFC,
+    0x00, 0x00, 0x3F, 0x82, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0x82, 0xFF, 0x03, 0xFC, 0x00, 0x00,
+    0x3F, 0x82, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0x82, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0x82,
+    0xFF, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0x82, 0xFF, 0x04, 0xFC, 0x00, 0x00, 0x1F, 0x7F, 0x81, 0xFE,
+    0x04, 0xF8, 0x00, 0x00, 0x1F, 0x7F, 0x81, 0xFE, 0x04, 0xF8, 0x00, 0x00, 0x1F, 0x7F, 0x81, 0xFE,
+    0x04, 0xF8, 0x00, 0x00, 0x1F, 0x7F, 0x81, 0xFE, 0x04, 0xF8, 0x00, 0x00, 0x1F, 0x7F, 0x81, 0xFE,
+    0x04, 0xF8, 0x00, 0x00, 0x1F, 0x7F, 0x81, 0xFE, 0x04, 0xF8, 0x00, 0x00, 0x1F, 0x7F, 0x81, 0xFE,
+    0x04, 0xF8, 0x00, 0x00, 0x1F, 0x7F, 0x81, 0xFE, 0x04, 0xF8, 0x00, 0x00, 0x0F, 0x3F, 0x81, 0xFC,
+    0x04, 0xF0, 0x00, 0x00, 0x0F, 0x3F, 0x81, 0xFC, 0x04, 0xF0, 0x00, 0x00, 0x0F, 0x3F, 0x81, 0xFC,
+    0x04, 0xF0, 0x00, 0x00, 0x0F, 0x3F, 0x81, 0xFC, 0x04, 0xF0, 0x00, 0x00, 0x0F, 0x3F, 0x81, 0xFC,
+    0x04, 0xF0, 0x00, 0x00, 0x0F, 0x3F, 0x81, 0xFC, 0x04, 0xF0, 0x00, 0x00, 0x0F, 0x3F, 0x81, 0xFC,
+    0x04, 0xF0, 0x00, 0x00, 0x0F, 0x3F, 0x81, 0xFC, 0x04, 0xF0, 0x00, 0x00, 0x07, 0x1F, 0x81, 0x7E,
+    0x04, 0xE0, 0x00, 0x00, 0x07, 0x1F, 0x81, 0x7E, 0x04, 0xE0, 0x00, 0x00, 0x07, 0x1F, 0x81, 0x7E,
+    0x04, 0xE0, 0x00, 0x00, 0x07, 0x1F, 0x81, 0x7E, 0x04, 0xE0, 0x00, 0x00, 0x07, 0x1F, 0x81, 0x7E,
+    0x04, 0xE0, 0x00, 0x00, 0x07, 0x1F, 0x81, 0x7E, 0x04, 0xE0, 0x00, 0x00, 0x07, 0x1F, 0x81, 0x7E,
+    0x04, 0xE0, 0x00, 0x00, 0x07, 0x1F, 0x81, 0x7E, 0x7F, 0xE0, 0x00, 0x00, 0x03, 0x0F, 0x3F, 0xFC,
+    0xF0, 0xC0, 0x00, 0x00, 0x03, 0x0F, 0x3F, 0xFC, 0xF0, 0xC0, 0x00, 0x00, 0x03, 0x0F, 0x3F, 0xFC,
+    0xF0, 0xC0, 0x00, 0x00, 0x03, 0x0F, 0x3F, 0xFC, 0xF0, 0xC0, 0x00, 0x00, 0x03, 0x0F, 0x3F, 0xFC,
+    0xF0, 0xC0, 0x00, 0x00, 0x03, 0x0F, 0x3F, 0xFC, 0xF0, 0xC0, 0x00, 0x00, 0x03, 0x0F, 0x3F, 0xFC,
+    0xF0, 0xC0, 0x00, 0x00, 0x03, 0x0F, 0x3F, 0xFC, 0xF0, 0xC0, 0x00, 0x00, 0x01, 0x07, 0x1E, 0x78,
+    0xE0, 0x80, 0x00, 0x00, 0x01, 0x07, 0x1E, 0x78, 0xE0, 0x80, 0x00, 0x00, 0x01, 0x07, 0x1E, 0x78,
+    0xE0, 0x80, 0x00, 0x00, 0x01, 0x07, 0x1E, 0x78, 0xE0, 0x80, 0x00, 0x00, 0x01, 0x07, 0x1E, 0x78,
+    0xE0, 0x80, 0x00, 0x00, 0x01, 0x07, 0x1E, 0x78, 0xE0, 0x80, 0x00, 0x00, 0x01, 0x07, 0x1E, 0x78,
+    0xE0, 0x80, 0x00, 0x00, 0x01, 0x07, 0x1E, 0x78, 0xE0, 0x00, 0x80, 0x81, 0x00, 0x03, 0x03, 0x0C,
+    0x30, 0xC0, 0x82, 0x00, 0x03, 0x03, 0x0C, 0x30, 0xC0, 0x82, 0x00, 0x03, 0x03, 0x0C, 0x30, 0xC0,
+    0x82, 0x00, 0x03, 0x03, 0x0C, 0x30, 0xC0, 0x82, 0x00, 0x03, 0x03, 0x0C, 0x30, 0xC0, 0x82, 0x00,
+    0x03, 0x03, 0x0C, 0x30, 0xC0, 0x82, 0x00, 0x03, 0x03, 0x0C, 0x30, 0xC0, 0x82, 0x00, 0x03, 0x03,
+    0x0C, 0x30, 0xC0, 0xC0, 0x00,
+};
+static const OLED_Image anim_bagua_frames[9] = {
+    {128, 64, OLED_IMG_RLE, 869, anim_bagua_0},
+    {128, 64, OLED_IMG_XOR, 812, anim_bagua_1},
+    {128, 64, OLED_IMG_XOR, 142, anim_bagua_2},
+    {128, 64, OLED_IMG_XOR, 16, anim_bagua_3},
+    {128, 64, OLED_IMG_XOR, 16, anim_bagua_4},
+    {128, 64, OLED_IMG_XOR, 16, anim_bagua_5},
+    {128, 64, OLED_IMG_XOR, 16, anim_bagua_6},
+    {128, 64, OLED_IMG_XOR, 16, anim_bagua_7},
+    {128, 64, OLED_IMG_XOR, 869, anim_bagua_8},
+};
+const OLED_Anim anim_bagua = {8, anim_bagua_frames};
+
+// 合计: 12624 -> 4872 字节
@@ -0,0 +1,28 @@
+// 由 tools/gen_assets.py 生成，请勿手工修改
+#ifndef __OLED_ASSETS_H
+#define __OLED_ASSETS_H
+
+#include "oled_image.h"
+
+extern const OLED_Image img_logo;
+extern const OLED_Image img_1;
+extern const OLED_Image img_bg;
+extern const OLED_Image img_bgg;
+extern const OLED_Image img_xbg;
+extern const OLED_Image img_calendar;
+extern const OLED_Image img_clock;
+extern const OLED_Image img_flashlight;
+extern const OLED_Image img_stopwatch;
+extern const OLED_Image img_setting;
+extern const OLED_Image img_TandH;
+extern const OLED_Image img_sun;
+extern const OLED_Image img_moon;
+extern const OLED_Image img_bell;
+extern const OLED_Image img_list;
+extern const OLED_Image img_new;
+extern const OLED_Image img_add;
+extern const OLED_Image img_step;
+extern const OLED_Image img_test;
+extern const OLED_Anim anim_bagua;
+
+#endif
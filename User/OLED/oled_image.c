@@ -0,0 +1,90 @@
+#include "oled_image.h"
+#include "oled.h"
+#include <string.h>
+
+/**
+ * @brief RLE 流读取状态
+ */
+typedef struct
+{
+    const uint8_t *p;   // 下一个未读的字节
+    uint8_t left;       // 当前段还剩的字节数
+    uint8_t repeat;     // 当前段是否为重复段
+} RLE_Reader;
+
+/**
+ * @brief 从 RLE 流中解出 n 个字节
+ */
+static void RLE_Read(RLE_Reader *r, uint8_t *out, uint8_t n)
+{
+    uint8_t c, k;
+    while (n)
+    {
+        if (r->left == 0)
+        {
+            c = *r->p++;
+            r->repeat = c & 0x80;
+            r->left = r->repeat ? (c & 0x7F) + 2 : c + 1;
+        }
+        k = (n < r->left) ? n : r->left;
+        if (r->repeat)
+        {
+            memset(out, *r->p, k);
+            if (k == r->left)
+                r->p++;     // 重复段用完，跳过重复的那个字节
+        }
+        else
+        {
+            memcpy(out, r->p, k);
+            r->p += k;
+        }
+        r->left -= k;
+        out += k;
+        n -= k;
+    }
+}
+
+/**
+ * @brief 显示一张图片
+ * @note 每次只解码一页(最多128字节)再写入显存
+ */
+void OLED_ShowImage(uint8_t x, uint8_t y, const OLED_Image *img, uint8_t mode)
+{
+    uint8_t row[128];
+    uint8_t page, pages = img->height / 8 + ((img->height % 8) ? 1 : 0);
+    uint8_t w = img->width;
+    RLE_Reader r = {img->data, 0, 0};
+
+    if (img->format == OLED_IMG_RAW)
+    {
+        OLED_Blit(x, y, w, pages, img->data, mode);
+        return;
+    }
+    for (page = 0; page < pages; page++)
+    {
+        RLE_Read(&r, row, w);
+        if (img->format == OLED_IMG_XOR)
+            OLED_Blit_Xor(x, y + page * 8, w, 1, row);
+        else
+            OLED_Blit(x, y + page * 8, w, 1, row, mode);
+    }
+}
+
+void OLED_Anim_Next(uint8_t x, uint8_t y, const OLED_Anim *anim, uint8_t frame)
+{
+    if (frame >= anim->count)
+        return;
+    OLED_ShowImage(x, y, &anim->frames[frame ? frame : anim->count], 1);
+}
+
+void OLED_Anim_Show(uint8_t x, uint8_t y, const OLED_Anim *anim, uint8_t frame, uint8_t mode)
+{
+    uint8_t i;
+    if (frame >= anim->count)
+        return;
+    OLED_ShowImage(x, y, &anim->frames[0], mode);
+    for (i = 1; i <= frame; i++)
+    {
+        OLED_ShowImage(x, y, &anim->frames[i], mode);
+    }
+}
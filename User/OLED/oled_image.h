@@ -0,0 +1,55 @@
+#ifndef __OLED_IMAGE_H__
+#define __OLED_IMAGE_H__
+
+#include "stm32f4xx.h"
+
+// 图片数据格式，编码规则见 tools/gen_assets.py
+#define OLED_IMG_RAW    0   // 原始点阵，与 OLED_ShowPicture 的数组相同
+#define OLED_IMG_RLE    1   // RLE 压缩的点阵
+#define OLED_IMG_XOR    2   // RLE 压缩的帧间异或差分，只能叠加在上一帧上
+
+/**
+ * @brief 压缩图片资源，由 tools/gen_assets.py 生成到 oled_assets.c
+ */
+typedef struct
+{
+    uint8_t width;          // 宽度(像素)
+    uint8_t height;         // 高度(像素)
+    uint8_t format;         // OLED_IMG_RAW / OLED_IMG_RLE / OLED_IMG_XOR
+    uint16_t size;          // data 的字节数
+    const uint8_t *data;
+} OLED_Image;
+
+/**
+ * @brief 差分压缩的动画
+ * @note frames[0] 为关键帧，frames[i] 为第i帧与第i-1帧的异或差，
+ *       frames[count] 为第0帧与最后一帧的异或差，循环播放时使用
+ */
+typedef struct
+{
+    uint8_t count;              // 帧数
+    const OLED_Image *frames;   // count+1 个
+} OLED_Anim;
+
+/**
+ * @brief 显示一张图片，边解码边写入显存，不需要整帧缓冲
+ * @param x 起始X坐标（0-127）
+ * @param y 起始Y坐标（0-63）
+ * @param img 图片资源
+ * @param mode 0,反色显示;1,正常显示（XOR 格式忽略此参数）
+ */
+void OLED_ShowImage(uint8_t x, uint8_t y, const OLED_Image *img, uint8_t mode);
+
+/**
+ * @brief 在已显示上一帧的位置上切换到第 frame 帧
+ * @param frame 0~count-1；frame 为0时认为屏幕上是最后一帧
+ * @note 只解码并异或差分，未变化的区域不写显存
+ */
+void OLED_Anim_Next(uint8_t x, uint8_t y, const OLED_Anim *anim, uint8_t frame);
+
+/**
+ * @brief 直接显示动画的任意一帧：画关键帧后依次叠加差分
+ */
+void OLED_Anim_Show(uint8_t x, uint8_t y, const OLED_Anim *anim, uint8_t frame, uint8_t mode);
+
+#endif // __OLED_IMAGE_H__
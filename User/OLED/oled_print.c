@@ -1,7 +1,39 @@
 #include "oled_print.h"
+#include "prof.h"
+#include "fmt.h"
 
-// 临时缓冲区用于格式化字符串
-static char oled_buffer[128];
+// 格式化出来的字符直接画到显存上，不经过中间字符串
+typedef struct
+{
+    uint8_t x;
+    uint8_t y;
+    const OLED_Font *font;
+    uint8_t stop;       // 遇到非法字符或超出屏幕右边后不再画，和 OLED_ShowString_Font 一致
+} OLED_Pen;
+
+static void OLED_Pen_Out(void *ctx, char c)
+{
+    OLED_Pen *pen = (OLED_Pen *)ctx;
+    uint8_t w;
+
+    if (pen->stop || pen->x >= 128)
+        return;
+    w = OLED_Draw_Glyph(pen->x, pen->y, (uint8_t)c, pen->font, 1);
+    if (w == 0)
+        pen->stop = 1;
+    pen->x += w;
+}
+
+static void OLED_Vprintf(uint8_t x, uint8_t y, const OLED_Font *font, const char *format, va_list args)
+{
+    OLED_Pen pen;
+
+    pen.x = x;
+    pen.y = y;
+    pen.font = font;
+    pen.stop = 0;
+    Fmt_Format(OLED_Pen_Out, &pen, format, args);
+}
 
 /**
  * @brief OLED打印函数 - 在指定位置格式化打印信息
@@ -11,11 +43,7 @@ void OLED_Printf(uint8_t x, uint8_t y, const char* format, ...)
     va_list args;
     va_start(args, format);
     
-    // 格式化字符串
-    vsnprintf(oled_buffer, sizeof(oled_buffer), format, args);
-    
-    // 显示字符串
-    OLED_ShowString(x, y, (uint8_t*)oled_buffer, 12, 1);
+    OLED_Vprintf(x, y, &OLED_PRINT_FONT, format, args);
     
     va_end(args);
 }
@@ -33,14 +61,15 @@ void OLED_Printf_Line(uint8_t line, const char* format, ...)
     // 计算Y坐标
     uint8_t y = line * OLED_LINE_HEIGHT;
     
-    // 格式化字符串
-    vsnprintf(oled_buffer, sizeof(oled_buffer), format, args);
-    
+    PROF_BEGIN(PROF_OLED_DRAW);
     // 清除该行
     OLED_Clear_Line(line);
+    PROF_END(PROF_OLED_DRAW);
     
-    // 显示字符串
-    OLED_ShowString(0, y, (uint8_t*)oled_buffer, 12, 1);
+    // 边格式化边画字，这一段包括画字的时间
+    PROF_BEGIN(PROF_OLED_FORMAT);
+    OLED_Vprintf(0, y, &OLED_PRINT_FONT, format, args);
+    PROF_END(PROF_OLED_FORMAT);
     
     // 标记该行为脏区域，用于局部刷新
     OLED_Set_Dirty_Area(0, y, 127, y + OLED_LINE_HEIGHT - 1);
@@ -53,7 +82,8 @@ void OLED_Printf_Line(uint8_t line, const char* format, ...)
  */
 void OLED_Printf_Line_32(uint8_t line, const char* format, ...)
 {
-    if (line >= OLED_MAX_LINES) return; // 防止越界
+    const OLED_Font *font = OLED_Get_Font(24);
+    if (line >= OLED_MAX_LINES || !font) return; // 防止越界
     
     va_list args;
     va_start(args, format);
@@ -61,14 +91,15 @@ void OLED_Printf_Line_32(uint8_t line, const char* format, ...)
     // 计算Y坐标
     uint8_t y = line * OLED_LINE_HEIGHT;
     
-    // 格式化字符串
-    vsnprintf(oled_buffer, sizeof(oled_buffer), format, args);
-    
+    PROF_BEGIN(PROF_OLED_DRAW);
     // 清除该行
     OLED_Clear_Line(line);
+    PROF_END(PROF_OLED_DRAW);
     
-    // 显示字符串
-    OLED_ShowString(0, y, (uint8_t*)oled_buffer, 24, 1);
+    // 边格式化边画字，这一段包括画字的时间
+    PROF_BEGIN(PROF_OLED_FORMAT);
+    OLED_Vprintf(0, y, font, format, args);
+    PROF_END(PROF_OLED_FORMAT);
     
     // 标记该行为脏区域，用于局部刷新
     OLED_Set_Dirty_Area(0, y, 127, y + (OLED_LINE_HEIGHT*2) - 1);
@@ -86,10 +117,8 @@ void OLED_Clear_Line(uint8_t line)
     
     uint8_t y = line * OLED_LINE_HEIGHT;
     
-    // 绘制空格填充该行
-    for (uint8_t x = 0; x < OLED_MAX_CHARS; x++) {
-        OLED_ShowChar(x * 8, y, ' ', 12, 1);
-    }
+    // 整行清零
+    OLED_Fill(0, y, 127, y + OLED_LINE_HEIGHT - 1, 0);
 }
 
 /**
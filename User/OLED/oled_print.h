@@ -12,13 +12,19 @@
 #define OLED_MAX_LINES   4   // 最大行数（128x64像素屏幕）
 #define OLED_MAX_CHARS   16  // 每行最大字符数（8x16字体）
 
+// OLED_Printf / OLED_Printf_Line 使用的字体
+// 默认用12像素比例字体，一行能放下的字符比等宽的6x12多；数字仍然等宽
+#ifndef OLED_PRINT_FONT
+#define OLED_PRINT_FONT  oled_font_1206p
+#endif
+
 /**
  * @brief OLED打印函数 - 在指定位置格式化打印信息
  * @param x 起始X坐标（0-127）
  * @param y 起始Y坐标（0-63）
  * @param format 格式化字符串（类似printf）
  * @param ... 可变参数
- * @note 支持%d, %u, %f, %s, %c, %x等常用格式
+ * @note 用 fmt.c 格式化，字符直接画到显存上；支持%d, %u, %s, %c, %x等常用格式，%f 为定点(见 fmt.h)
  */
 void OLED_Printf(uint8_t x, uint8_t y, const char* format, ...);
 
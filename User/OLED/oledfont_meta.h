@@ -0,0 +1,324 @@
+// 由 tools/gen_font_meta.py 根据 oledfont.h 生成，请勿手工修改
+// 只能被 oled.c 包含一次(和 oledfont.h 一样直接定义数据)
+#ifndef __OLEDFONT_META_H
+#define __OLEDFONT_META_H
+
+// asc2_0806: 6x8, 92 个字形
+const OLED_Font oled_font_0806 = {&asc2_0806[0][0], 0, 6, 8, 1, 6, 32, 92};
+
+// asc2_1206: 6x12, 95 个字形
+const OLED_Font oled_font_1206 = {&asc2_1206[0][0], 0, 6, 12, 2, 12, 32, 95};
+static const uint8_t asc2_1206_prop[95][2] = {
+    {0, 3}, // ' '
+    {2, 1}, // '!'
+    {1, 4}, // '"'
+    {0, 6}, // '#'
+    {0, 5}, // '$'
+    {0, 6}, // '%'
+    {0, 6}, // '&'
+    {0, 2}, // '''
+    {3, 3}, // '('
+    {1, 3}, // ')'
+    {0, 5}, // '*'
+    {0, 5}, // '+'
+    {0, 2}, // ','
+    {0, 5}, // '-'
+    {1, 1}, // '.'
+    {0, 5}, // '/'
+    {0, 5}, // '0'
+    {0, 5}, // '1'
+    {0, 5}, // '2'
+    {0, 5}, // '3'
+    {0, 5}, // '4'
+    {0, 5}, // '5'
+    {0, 5}, // '6'
+    {0, 5}, // '7'
+    {0, 5}, // '8'
+    {0, 5}, // '9'
+    {2, 1}, // ':'
+    {2, 1}, // ';'
+    {1, 5}, // '<'
+    {0, 5}, // '='
+    {1, 5}, // '>'
+    {0, 5}, // '?'
+    {0, 5}, // '@'
+    {0, 6}, // 'A'
+    {0, 5}, // 'B'
+    {0, 5}, // 'C'
+    {0, 5}, // 'D'
+    {0, 5}, // 'E'
+    {0, 5}, // 'F'
+    {0, 6}, // 'G'
+    {0, 6}, // 'H'
+    {0, 5}, // 'I'
+    {0, 6}, // 'J'
+    {0, 6}, // 'K'
+    {0, 6}, // 'L'
+    {0, 5}, // 'M'
+    {0, 6}, // 'N'
+    {0, 5}, // 'O'
+    {0, 5}, // 'P'
+    {0, 5}, // 'Q'
+    {0, 6}, // 'R'
+    {0, 5}, // 'S'
+    {0, 5}, // 'T'
+    {0, 6}, // 'U'
+    {0, 6}, // 'V'
+    {0, 5}, // 'W'
+    {0, 5}, // 'X'
+    {0, 5}, // 'Y'
+    {0, 5}, // 'Z'
+    {2, 3}, // '['
+    {1, 4}, // '\\'
+    {1, 3}, // ']'
+    {1, 3}, // '^'
+    {0, 6}, // '_'
+    {2, 1}, // '`'
+    {1, 5}, // 'a'
+    {0, 5}, // 'b'
+    {1, 4}, // 'c'
+    {1, 5}, // 'd'
+    {1, 4}, // 'e'
+    {1, 5}, // 'f'
+    {1, 5}, // 'g'
+    {0, 6}, // 'h'
+    {1, 3}, // 'i'
+    {0, 4}, // 'j'
+    {0, 6}, // 'k'
+    {0, 5}, // 'l'
+    {0, 5}, // 'm'
+    {0, 6}, // 'n'
+    {1, 4}, // 'o'
+    {0, 5}, // 'p'
+    {1, 5}, // 'q'
+    {0, 5}, // 'r'
+    {1, 4}, // 's'
+    {1, 4}, // 't'
+    {0, 6}, // 'u'
+    {0, 6}, // 'v'
+    {0, 5}, // 'w'
+    {0, 5}, // 'x'
+    {0, 6}, // 'y'
+    {1, 4}, // 'z'
+    {2, 3}, // '{'
+    {3, 1}, // '|'
+    {1, 3}, // '}'
+    {0, 6}, // '~'
+};
+const OLED_Font oled_font_1206p = {&asc2_1206[0][0], asc2_1206_prop, 6, 12, 2, 12, 32, 95};
+
+// asc2_1608: 8x16, 95 个字形
+const OLED_Font oled_font_1608 = {&asc2_1608[0][0], 0, 8, 16, 2, 16, 32, 95};
+static const uint8_t asc2_1608_prop[95][2] = {
+    {0, 4}, // ' '
+    {3, 2}, // '!'
+    {1, 6}, // '"'
+    {0, 7}, // '#'
+    {1, 5}, // '$'
+    {0, 7}, // '%'
+    {0, 8}, // '&'
+    {0, 3}, // '''
+    {3, 4}, // '('
+    {1, 4}, // ')'
+    {0, 7}, // '*'
+    {0, 7}, // '+'
+    {0, 3}, // ','
+    {1, 7}, // '-'
+    {1, 2}, // '.'
+    {1, 7}, // '/'
+    {1, 6}, // '0'
+    {1, 6}, // '1'
+    {1, 6}, // '2'
+    {1, 6}, // '3'
+    {1, 6}, // '4'
+    {1, 6}, // '5'
+    {1, 6}, // '6'
+    {1, 6}, // '7'
+    {1, 6}, // '8'
+    {1, 6}, // '9'
+    {3, 2}, // ':'
+    {2, 2}, // ';'
+    {1, 6}, // '<'
+    {0, 7}, // '='
+    {1, 6}, // '>'
+    {1, 6}, // '?'
+    {0, 7}, // '@'
+    {0, 8}, // 'A'
+    {0, 7}, // 'B'
+    {0, 7}, // 'C'
+    {0, 7}, // 'D'
+    {0, 7}, // 'E'
+    {0, 7}, // 'F'
+    {0, 7}, // 'G'
+    {0, 8}, // 'H'
+    {1, 5}, // 'I'
+    {0, 7}, // 'J'
+    {0, 7}, // 'K'
+    {0, 7}, // 'L'
+    {0, 7}, // 'M'
+    {0, 8}, // 'N'
+    {0, 7}, // 'O'
+    {0, 7}, // 'P'
+    {0, 7}, // 'Q'
+    {0, 8}, // 'R'
+    {1, 6}, // 'S'
+    {0, 7}, // 'T'
+    {0, 8}, // 'U'
+    {0, 8}, // 'V'
+    {0, 7}, // 'W'
+    {0, 8}, // 'X'
+    {0, 7}, // 'Y'
+    {0, 7}, // 'Z'
+    {3, 4}, // '['
+    {1, 6}, // '\\'
+    {1, 4}, // ']'
+    {2, 5}, // '^'
+    {0, 8}, // '_'
+    {1, 3}, // '`'
+    {1, 7}, // 'a'
+    {0, 7}, // 'b'
+    {1, 6}, // 'c'
+    {1, 7}, // 'd'
+    {1, 6}, // 'e'
+    {1, 7}, // 'f'
+    {1, 6}, // 'g'
+    {0, 8}, // 'h'
+    {1, 5}, // 'i'
+    {1, 5}, // 'j'
+    {0, 7}, // 'k'
+    {1, 5}, // 'l'
+    {0, 8}, // 'm'
+    {0, 8}, // 'n'
+    {1, 6}, // 'o'
+    {0, 7}, // 'p'
+    {1, 7}, // 'q'
+    {0, 7}, // 'r'
+    {1, 6}, // 's'
+    {1, 5}, // 't'
+    {0, 8}, // 'u'
+    {0, 8}, // 'v'
+    {0, 8}, // 'w'
+    {1, 6}, // 'x'
+    {0, 8}, // 'y'
+    {1, 6}, // 'z'
+    {4, 4}, // '{'
+    {4, 1}, // '|'
+    {1, 4}, // '}'
+    {1, 7}, // '~'
+};
+const OLED_Font oled_font_1608p = {&asc2_1608[0][0], asc2_1608_prop, 8, 16, 2, 16, 32, 95};
+
+// asc2_2412: 12x24, 95 个字形
+const OLED_Font oled_font_2412 = {&asc2_2412[0][0], 0, 12, 24, 3, 36, 32, 95};
+static const uint8_t asc2_2412_prop[95][2] = {
+    {0, 6}, // ' '
+    {5, 3}, // '!'
+    {2, 9}, // '"'
+    {1, 10}, // '#'
+    {2, 8}, // '$'
+    {0, 11}, // '%'
+    {0, 11}, // '&'
+    {1, 4}, // '''
+    {5, 6}, // '('
+    {1, 6}, // ')'
+    {1, 11}, // '*'
+    {1, 11}, // '+'
+    {1, 4}, // ','
+    {1, 10}, // '-'
+    {2, 3}, // '.'
+    {1, 10}, // '/'
+    {1, 10}, // '0'
+    {1, 10}, // '1'
+    {1, 10}, // '2'
+    {1, 10}, // '3'
+    {1, 10}, // '4'
+    {1, 10}, // '5'
+    {1, 10}, // '6'
+    {1, 10}, // '7'
+    {1, 10}, // '8'
+    {1, 10}, // '9'
+    {5, 3}, // ':'
+    {5, 2}, // ';'
+    {2, 9}, // '<'
+    {1, 10}, // '='
+    {2, 9}, // '>'
+    {1, 10}, // '?'
+    {1, 11}, // '@'
+    {0, 12}, // 'A'
+    {0, 11}, // 'B'
+    {1, 10}, // 'C'
+    {0, 11}, // 'D'
+    {0, 11}, // 'E'
+    {0, 11}, // 'F'
+    {1, 11}, // 'G'
+    {0, 12}, // 'H'
+    {2, 8}, // 'I'
+    {1, 11}, // 'J'
+    {0, 12}, // 'K'
+    {0, 11}, // 'L'
+    {0, 12}, // 'M'
+    {0, 12}, // 'N'
+    {1, 10}, // 'O'
+    {0, 11}, // 'P'
+    {1, 10}, // 'Q'
+    {0, 12}, // 'R'
+    {1, 10}, // 'S'
+    {0, 12}, // 'T'
+    {0, 12}, // 'U'
+    {0, 12}, // 'V'
+    {0, 12}, // 'W'
+    {1, 10}, // 'X'
+    {0, 12}, // 'Y'
+    {1, 10}, // 'Z'
+    {5, 6}, // '['
+    {2, 9}, // '\\'
+    {2, 6}, // ']'
+    {3, 7}, // '^'
+    {0, 12}, // '_'
+    {3, 4}, // '`'
+    {1, 11}, // 'a'
+    {1, 10}, // 'b'
+    {1, 9}, // 'c'
+    {1, 10}, // 'd'
+    {2, 9}, // 'e'
+    {1, 10}, // 'f'
+    {1, 11}, // 'g'
+    {1, 10}, // 'h'
+    {2, 8}, // 'i'
+    {2, 7}, // 'j'
+    {1, 10}, // 'k'
+    {2, 8}, // 'l'
+    {0, 12}, // 'm'
+    {1, 10}, // 'n'
+    {1, 10}, // 'o'
+    {1, 10}, // 'p'
+    {1, 10}, // 'q'
+    {0, 11}, // 'r'
+    {2, 9}, // 's'
+    {1, 9}, // 't'
+    {1, 10}, // 'u'
+    {1, 11}, // 'v'
+    {0, 12}, // 'w'
+    {1, 10}, // 'x'
+    {1, 10}, // 'y'
+    {2, 9}, // 'z'
+    {5, 5}, // '{'
+    {6, 1}, // '|'
+    {2, 5}, // '}'
+    {1, 11}, // '~'
+};
+const OLED_Font oled_font_2412p = {&asc2_2412[0][0], asc2_2412_prop, 12, 24, 3, 36, 32, 95};
+
+// Hzk1: 16x16, 16 个字形
+const OLED_Font oled_font_hz16 = {&Hzk1[0][0], 0, 16, 16, 2, 32, 0, 16};
+
+// Hzk2: 24x24, 1 个字形
+const OLED_Font oled_font_hz24 = {&Hzk2[0][0], 0, 24, 24, 3, 72, 0, 1};
+
+// Hzk3: 32x32, 1 个字形
+const OLED_Font oled_font_hz32 = {&Hzk3[0][0], 0, 32, 32, 4, 128, 0, 1};
+
+// Hzk4: 64x64, 1 个字形
+const OLED_Font oled_font_hz64 = {&Hzk4[0][0], 0, 64, 64, 8, 512, 0, 1};
+
+#endif
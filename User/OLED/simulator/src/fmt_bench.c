@@ -0,0 +1,160 @@
+// 格式化性能对比：C库 vsnprintf vs 固件 User/code/fmt.c
+// 主机程序，不依赖SDL；直接编译固件的 fmt.c
+// 先把项目里用到的格式和边界值逐个和 snprintf 对比，再计时表盘每帧要格式化的几行
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "../../../code/fmt.h"
+
+#define BENCH_LOOPS 200000
+
+static int failures = 0;
+static int checks = 0;
+
+#define CHECK(...) do {                                                     \
+    char ref[128], out[128];                                                \
+    int nr = snprintf(ref, sizeof(ref), __VA_ARGS__);                       \
+    int no = Fmt_Snprintf(out, sizeof(out), __VA_ARGS__);                   \
+    checks++;                                                               \
+    if (nr != no || strcmp(ref, out) != 0) {                                \
+        failures++;                                                         \
+        printf("MISMATCH %-28s libc=\"%s\"(%d) fmt=\"%s\"(%d)\n",           \
+               #__VA_ARGS__, ref, nr, out, no);                             \
+    }                                                                       \
+} while (0)
+
+static void check_formats(void)
+{
+    static const int ints[] = { 0, 1, -1, 7, 42, -42, 999, 12345, -99999, 2147483647, -2147483647 - 1 };
+    static const unsigned uints[] = { 0, 1, 9, 10, 255, 0xABCD, 0x7FFFFFFF, 0xFFFFFFFF };
+    static const double dbls[] = { 0.0, -0.0, 0.5, 1.005, 3.14159, -2.5, -0.004, 99.995, 1234.5678, 4294967295.0,
+                                   4294967295.25, 0.1, 1e-7, 5e-10, 1.5e-9, 4.9e-324, 2097152.5, 0.125 };
+    size_t i;
+
+    for (i = 0; i < sizeof(ints) / sizeof(ints[0]); i++) {
+        int v = ints[i];
+        CHECK("%d", v);
+        CHECK("%i|%5d|%-5d|%05d", v, v, v, v);
+        CHECK("%02d:%04d", v, v);
+        CHECK("%+d|% d|%+05d", v, v, v);
+        CHECK("%.3d|%8.4d|%-8.4d|%.0d", v, v, v, v);
+        CHECK("%ld|%6ld", (long)v, (long)v);
+        CHECK("%hd|%hhd", v, v);
+        CHECK("%*d|%-*d|%.*d", 6, v, 6, v, 4, v);
+    }
+    for (i = 0; i < sizeof(uints) / sizeof(uints[0]); i++) {
+        unsigned v = uints[i];
+        CHECK("%u|%8u|%-8u|%08u", v, v, v, v);
+        CHECK("%x|%X|%#x|%#X|%08x|%#010x", v, v, v, v, v, v);
+        CHECK("%o|%#o|%.0u|%#.0o", v, v, v, v);
+        CHECK("%lu|%8lu|%6lu|%06lX", (unsigned long)v, (unsigned long)v, (unsigned long)v, (unsigned long)v);
+        CHECK("%02X %hx %hhu", v, v, v);
+        CHECK("%zu", (size_t)v);
+    }
+    for (i = 0; i < sizeof(dbls) / sizeof(dbls[0]); i++) {
+        double v = dbls[i];
+        CHECK("%f", v);
+        CHECK("%.2f|%.3f|%.1f|%.0f", v, v, v, v);
+        CHECK("%7.1f|%-8.2f|%08.2f|%+.2f", v, v, v, v);
+        CHECK("%12.0f|%#.0f|%.9f", v, v, v);
+    }
+    CHECK("%s|%8s|%-8s|%.3s|%-14s|%12s", "abc", "abc", "abc", "abcdef", "name", "value");
+    CHECK("%c%c|%3c|%-3c|", 'A', 'z', 'x', 'y');
+    CHECK("100%%|%%d");
+    CHECK("T:%d.%dC H:%d.%d%%", 23, 5, 61, 0);
+    CHECK("%02d/%02d/%02d %s", 25, 10, 17, "Fri");
+    CHECK("Steps: %lu", 123456UL);
+    CHECK("plain text only");
+    CHECK("%s", "");
+}
+
+// %f 只用整数运算：随机尾数和指数的 double 逐个精度和库里的结果对比(含正好一半的舍入)
+static void check_fixed_random(void)
+{
+    uint32_t rng = 2024;
+    int i, prec;
+
+    for (i = 0; i < 20000; i++) {
+        double v;
+
+        rng = rng * 1664525u + 1013904223u;
+        v = (double)(rng >> 8) * 16 / (double)((uint64_t)1 << (rng % 64));  // 约 2^-40 ~ 2^28
+        if (i & 1)
+            v = -v;
+        if (i % 7 == 0)
+            v = (double)(rng >> 12) / 8;            // x.5、x.25 这样的精确小数
+        for (prec = 0; prec <= 9; prec++)
+            CHECK("%.*f", prec, v);
+    }
+}
+
+static int fmt_only_checks(void)
+{
+    char out[64];
+    int n;
+
+    // 截断：返回完整长度，缓冲区以 '\0' 结尾
+    n = Fmt_Snprintf(out, 6, "%s", "0123456789");
+    if (n != 10 || strcmp(out, "01234") != 0)
+        return 1;
+    // 超出 %f 的范围
+    Fmt_Snprintf(out, sizeof(out), "%.1f", 1e12);
+    if (strcmp(out, "ovf") != 0)
+        return 1;
+    Fmt_Snprintf(out, sizeof(out), "%.0f", 4294967295.5);     // 舍入后到了 2^32
+    if (strcmp(out, "ovf") != 0)
+        return 1;
+    // 没有支持的转换原样输出
+    Fmt_Snprintf(out, sizeof(out), "%e", 1.0);
+    if (strcmp(out, "%e") != 0)
+        return 1;
+    return 0;
+}
+
+static char sink_buf[128];
+
+static double bench(int use_fmt)
+{
+    volatile int h = 12, m = 34, s = 56, y = 25, mo = 10, d = 17;
+    volatile unsigned long steps = 8765;
+    clock_t t0 = clock();
+    int i;
+
+    for (i = 0; i < BENCH_LOOPS; i++) {
+        // 表盘每帧的三行：日期、大字时间、步数
+        if (use_fmt) {
+            Fmt_Snprintf(sink_buf, sizeof(sink_buf), "20%02d-%02d-%02d", y, mo, d);
+            Fmt_Snprintf(sink_buf, sizeof(sink_buf), "%02d:%02d:%02d", h, m, s);
+            Fmt_Snprintf(sink_buf, sizeof(sink_buf), "Steps: %lu", steps);
+        } else {
+            snprintf(sink_buf, sizeof(sink_buf), "20%02d-%02d-%02d", y, mo, d);
+            snprintf(sink_buf, sizeof(sink_buf), "%02d:%02d:%02d", h, m, s);
+            snprintf(sink_buf, sizeof(sink_buf), "Steps: %lu", steps);
+        }
+    }
+    return (double)(clock() - t0) / CLOCKS_PER_SEC;
+}
+
+int main(void)
+{
+    double t_ref, t_fmt;
+
+    check_formats();
+    check_fixed_random();
+    if (fmt_only_checks()) {
+        printf("fmt-only checks FAILED\n");
+        failures++;
+    }
+    printf("%d/%d formats match libc snprintf\n", checks - failures, checks);
+    if (failures)
+        return 1;
+
+    t_ref = bench(0);
+    t_fmt = bench(1);
+    printf("libc snprintf: %.3f s\n", t_ref);
+    printf("Fmt_Snprintf : %.3f s (%.2fx)\n", t_fmt, t_fmt > 0 ? t_ref / t_fmt : 0.0);
+    printf("(%d loops x 3 lines)\n", BENCH_LOOPS);
+    return 0;
+}
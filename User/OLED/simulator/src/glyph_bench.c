@@ -0,0 +1,252 @@
+// 字符绘制性能对比：逐点 OLED_DrawPoint 路径 vs 按字节 OLED_Blit 路径
+// 主机程序，不依赖SDL；两条路径都按固件 oled.c 的写法实现
+// 先对所有字库、所有y偏移、两种mode做像素一致性检查，再计时
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "../include/oledfont.h"
+
+#define BENCH_LOOPS 20000
+
+static uint8_t gram_ref[8][128];	// 逐点路径的显存
+static uint8_t gram_new[8][128];	// blit路径的显存
+
+// ============= 原逐点路径 =============
+
+static void ref_DrawPoint(uint8_t x, uint8_t y, uint8_t t) {
+    uint8_t i, m, n;
+    if (x >= 128 || y >= 64) return;
+    i = y / 8;
+    m = y % 8;
+    n = 1 << m;
+    if (t) {
+        gram_ref[i][x] |= n;
+    } else {
+        gram_ref[i][x] = ~gram_ref[i][x];
+        gram_ref[i][x] |= n;
+        gram_ref[i][x] = ~gram_ref[i][x];
+    }
+}
+
+static void ref_ShowChar(uint8_t x, uint8_t y, uint8_t chr, uint8_t size1, uint8_t mode) {
+    uint8_t i, m, temp, size2, chr1;
+    uint8_t x0 = x, y0 = y;
+    if (size1 == 8)
+        size2 = 6;
+    else
+        size2 = (size1 / 8 + ((size1 % 8) ? 1 : 0)) * (size1 / 2);
+    chr1 = chr - ' ';
+    for (i = 0; i < size2; i++) {
+        if (size1 == 8) {
+            temp = asc2_0806[chr1][i];
+        } else if (size1 == 12) {
+            temp = asc2_1206[chr1][i];
+        } else if (size1 == 16) {
+            temp = asc2_1608[chr1][i];
+        } else if (size1 == 24) {
+            temp = asc2_2412[chr1][i];
+        } else
+            return;
+        for (m = 0; m < 8; m++) {
+            if (temp & 0x01)
+                ref_DrawPoint(x, y, mode);
+            else
+                ref_DrawPoint(x, y, !mode);
+            temp >>= 1;
+            y++;
+        }
+        x++;
+        if ((size1 != 8) && ((x - x0) == size1 / 2)) {
+            x = x0;
+            y0 = y0 + 8;
+        }
+        y = y0;
+    }
+}
+
+static void ref_ShowChinese(uint8_t x, uint8_t y, uint8_t num, uint8_t size1, uint8_t mode) {
+    uint8_t m, temp;
+    uint8_t x0 = x, y0 = y;
+    uint16_t i, size3 = (size1 / 8 + ((size1 % 8) ? 1 : 0)) * size1;
+    for (i = 0; i < size3; i++) {
+        if (size1 == 16) {
+            temp = Hzk1[num][i];
+        } else if (size1 == 24) {
+            temp = Hzk2[num][i];
+        } else if (size1 == 32) {
+            temp = Hzk3[num][i];
+        } else if (size1 == 64) {
+            temp = Hzk4[num][i];
+        } else
+            return;
+        for (m = 0; m < 8; m++) {
+            if (temp & 0x01)
+                ref_DrawPoint(x, y, mode);
+            else
+                ref_DrawPoint(x, y, !mode);
+            temp >>= 1;
+            y++;
+        }
+        x++;
+        if ((x - x0) == size1) {
+            x = x0;
+            y0 = y0 + 8;
+        }
+        y = y0;
+    }
+}
+
+// ============= blit路径 =============
+
+static void new_Blit(uint8_t x, uint8_t y, uint8_t w, uint8_t pages, const uint8_t *bmp, uint8_t mode) {
+    uint8_t i, n, b, cols;
+    uint8_t page = y / 8, shift = y % 8;
+    uint8_t inv = mode ? 0x00 : 0xFF;
+    uint8_t keep = 0xFF >> (8 - shift);
+    uint8_t *row, *next;
+    if (x >= 128 || page >= 8) return;
+    cols = (w > 128 - x) ? 128 - x : w;
+    for (n = 0; n < pages && page < 8; n++, page++, bmp += w) {
+        row = &gram_new[page][x];
+        if (shift == 0) {
+            for (i = 0; i < cols; i++) {
+                row[i] = bmp[i] ^ inv;
+            }
+        } else {
+            next = (page < 7) ? &gram_new[page + 1][x] : NULL;
+            for (i = 0; i < cols; i++) {
+                b = bmp[i] ^ inv;
+                row[i] = (row[i] & keep) | (uint8_t)(b << shift);
+                if (next) {
+                    next[i] = (next[i] & ~keep) | (b >> (8 - shift));
+                }
+            }
+        }
+    }
+}
+
+static void new_ShowChar(uint8_t x, uint8_t y, uint8_t chr, uint8_t size1, uint8_t mode) {
+    uint8_t chr1 = chr - ' ';
+    if (size1 == 8)
+        new_Blit(x, y, 6, 1, asc2_0806[chr1], mode);
+    else if (size1 == 12)
+        new_Blit(x, y, 6, 2, asc2_1206[chr1], mode);
+    else if (size1 == 16)
+        new_Blit(x, y, 8, 2, asc2_1608[chr1], mode);
+    else if (size1 == 24)
+        new_Blit(x, y, 12, 3, asc2_2412[chr1], mode);
+}
+
+static void new_ShowChinese(uint8_t x, uint8_t y, uint8_t num, uint8_t size1, uint8_t mode) {
+    if (size1 == 16)
+        new_Blit(x, y, 16, 2, Hzk1[num], mode);
+    else if (size1 == 24)
+        new_Blit(x, y, 24, 3, Hzk2[num], mode);
+    else if (size1 == 32)
+        new_Blit(x, y, 32, 4, Hzk3[num], mode);
+    else if (size1 == 64)
+        new_Blit(x, y, 64, 8, Hzk4[num], mode);
+}
+
+// ============= 一致性检查 =============
+
+static void fill_random(void) {
+    uint16_t i;
+    for (i = 0; i < sizeof(gram_ref); i++) {
+        ((uint8_t *)gram_ref)[i] = (uint8_t)rand();
+    }
+    memcpy(gram_new, gram_ref, sizeof(gram_ref));
+}
+
+static int check_all(void) {
+    static const uint8_t asc_size[] = {8, 12, 16, 24};
+    static const uint8_t hz_size[] = {16, 24, 32, 64};
+    static const uint8_t hz_count[] = {
+        sizeof(Hzk1) / sizeof(Hzk1[0]), sizeof(Hzk2) / sizeof(Hzk2[0]),
+        sizeof(Hzk3) / sizeof(Hzk3[0]), sizeof(Hzk4) / sizeof(Hzk4[0])
+    };
+    static const uint8_t xs[] = {0, 3, 61, 120, 127};
+    int fail = 0;
+    uint8_t s, c, y, mode, k;
+
+    for (s = 0; s < 4; s++)
+        for (c = ' '; c <= '~'; c++)
+            for (y = 0; y < 64; y++)
+                for (k = 0; k < sizeof(xs); k++)
+                    for (mode = 0; mode < 2; mode++) {
+                        fill_random();
+                        ref_ShowChar(xs[k], y, c, asc_size[s], mode);
+                        new_ShowChar(xs[k], y, c, asc_size[s], mode);
+                        if (memcmp(gram_ref, gram_new, sizeof(gram_ref))) {
+                            if (fail++ < 5)
+                                printf("不一致: ShowChar x=%d y=%d '%c' size=%d mode=%d\n",
+                                       xs[k], y, c, asc_size[s], mode);
+                        }
+                    }
+
+    for (s = 0; s < 4; s++)
+        for (c = 0; c < hz_count[s]; c++)
+            for (y = 0; y < 64; y++)
+                for (k = 0; k < sizeof(xs); k++)
+                    for (mode = 0; mode < 2; mode++) {
+                        fill_random();
+                        ref_ShowChinese(xs[k], y, c, hz_size[s], mode);
+                        new_ShowChinese(xs[k], y, c, hz_size[s], mode);
+                        if (memcmp(gram_ref, gram_new, sizeof(gram_ref))) {
+                            if (fail++ < 5)
+                                printf("不一致: ShowChinese x=%d y=%d num=%d size=%d mode=%d\n",
+                                       xs[k], y, c, hz_size[s], mode);
+                        }
+                    }
+    return fail;
+}
+
+// ============= 计时 =============
+
+typedef void (*show_char_fn)(uint8_t, uint8_t, uint8_t, uint8_t, uint8_t);
+
+// 模拟 OLED_Printf_Line_32 画一行时钟字符串
+static double bench_string(show_char_fn fn, const char *str, uint8_t y, uint8_t size1) {
+    clock_t t0 = clock();
+    int loop;
+    const char *p;
+    uint8_t x;
+    for (loop = 0; loop < BENCH_LOOPS; loop++) {
+        x = 0;
+        for (p = str; *p; p++) {
+            fn(x, y, (uint8_t)*p, size1, 1);
+            x += (size1 == 8) ? 6 : size1 / 2;
+        }
+    }
+    return (double)(clock() - t0) * 1e9 / CLOCKS_PER_SEC / BENCH_LOOPS;
+}
+
+int main(void) {
+    static const struct { const char *name; uint8_t y; uint8_t size; } cases[] = {
+        {"24px 对齐  y=0 ", 0, 24},
+        {"24px 非对齐 y=20", 20, 24},
+        {"16px 对齐  y=16", 16, 16},
+        {"12px 非对齐 y=12", 12, 12},
+        {" 8px 对齐  y=56", 56, 8},
+    };
+    const char *clock_str = "12:34:56";
+    unsigned i;
+    int fail;
+    double t_ref, t_new;
+
+    srand(1);
+    fail = check_all();
+    printf("像素一致性检查: %s (%d 处不一致)\n", fail ? "失败" : "通过", fail);
+
+    printf("\n绘制 \"%s\"，每行 %d 次取平均\n", clock_str, BENCH_LOOPS);
+    printf("%-18s %12s %12s %8s\n", "场景", "逐点(ns)", "blit(ns)", "加速比");
+    for (i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        t_ref = bench_string(ref_ShowChar, clock_str, cases[i].y, cases[i].size);
+        t_new = bench_string(new_ShowChar, clock_str, cases[i].y, cases[i].size);
+        printf("%-18s %12.0f %12.0f %7.1fx\n", cases[i].name, t_ref, t_new,
+               t_new > 0 ? t_ref / t_new : 0.0);
+    }
+    return fail ? 1 : 0;
+}
@@ -0,0 +1,221 @@
+// 块处理一致性检查与性能对比：直接编译固件的 User/code/imu_block.c
+// 主机程序，不依赖SDL
+// 1. Imu_Block_xxx 和逐个样本的 _Ref 对拍(随机块、极值、奇数长度、空块)，FIR 再和直接卷积对比
+// 2. 计时，给出每块的平均耗时
+// 用 -DIMU_BLOCK_SIMD=1 -Isrc/simd_emu 编译时，SIMD 路径用C模拟的指令运行，只看对拍结果，计时没有意义
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "../../../code/imu_block.h"
+
+#define BENCH_BLOCKS 200000
+#define STREAM_LEN   1000
+
+static int failures = 0;
+static int checks = 0;
+
+static uint32_t rng_state = 2024;
+
+static int16_t rnd16(void)
+{
+    rng_state = rng_state * 1664525u + 1013904223u;
+    return (int16_t)(rng_state >> 16);
+}
+
+#define EXPECT(cond, ...) do {          \
+    checks++;                           \
+    if (!(cond)) {                      \
+        failures++;                     \
+        printf("MISMATCH ");            \
+        printf(__VA_ARGS__);            \
+        printf("\n");                   \
+    }                                   \
+} while (0)
+
+static void check_block(const int16_t *x, const int16_t *y, const int16_t *z, uint16_t n, const char *what)
+{
+    uint32_t sq[IMU_BLOCK_MAX + 1], sq_ref[IMU_BLOCK_MAX + 1];
+    int16_t lo, hi, lo_ref, hi_ref;
+    uint64_t e, e_ref;
+
+    Imu_Block_SumSq(x, y, z, sq, n);
+    Imu_Block_SumSq_Ref(x, y, z, sq_ref, n);
+    EXPECT(memcmp(sq, sq_ref, n * sizeof(sq[0])) == 0, "SumSq %s n=%u", what, n);
+
+    Imu_Block_MinMax(x, n, &lo, &hi);
+    Imu_Block_MinMax_Ref(x, n, &lo_ref, &hi_ref);
+    EXPECT(lo == lo_ref && hi == hi_ref, "MinMax %s n=%u: %d..%d vs %d..%d", what, n, lo, hi, lo_ref, hi_ref);
+
+    e = Imu_Block_Energy(z, n);
+    e_ref = Imu_Block_Energy_Ref(z, n);
+    EXPECT(e == e_ref, "Energy %s n=%u: %llu vs %llu", what, n,
+           (unsigned long long)e, (unsigned long long)e_ref);
+}
+
+static void check_kernels(void)
+{
+    static const int16_t edge[] = { -32768, 32767, 0, -1, 1, -32767 };
+    int16_t x[IMU_BLOCK_MAX + 1], y[IMU_BLOCK_MAX + 1], z[IMU_BLOCK_MAX + 1];
+    uint16_t n, i, k;
+    int round;
+
+    // 随机块，从奇数地址开始的也要对
+    for (round = 0; round < 200; round++)
+    {
+        for (i = 0; i <= IMU_BLOCK_MAX; i++)
+        {
+            x[i] = rnd16();
+            y[i] = rnd16();
+            z[i] = rnd16();
+        }
+        for (n = 0; n <= IMU_BLOCK_MAX; n++)
+            check_block(x, y, z, n, "random");
+        check_block(x + 1, y + 1, z + 1, IMU_BLOCK_MAX - 1, "unaligned");
+    }
+
+    // 全部是同一个极值
+    for (k = 0; k < sizeof(edge) / sizeof(edge[0]); k++)
+    {
+        for (i = 0; i <= IMU_BLOCK_MAX; i++)
+            x[i] = y[i] = z[i] = edge[k];
+        check_block(x, y, z, IMU_BLOCK_MAX, "constant");
+        check_block(x, y, z, IMU_BLOCK_MAX - 1, "constant odd");
+    }
+
+    // 最值在最后一个(奇数长度时落在尾巴上)
+    for (i = 0; i <= IMU_BLOCK_MAX; i++)
+        x[i] = y[i] = z[i] = (int16_t)i;
+    x[IMU_BLOCK_MAX] = -32768;
+    check_block(x, y, z, IMU_BLOCK_MAX + 1, "ramp");
+    check_block(x + IMU_BLOCK_MAX - 2, y, z, 3, "tail");
+
+    // 能量：+-A 交替，n*sum((v-mean)^2) = n*n*A^2
+    for (i = 0; i < IMU_BLOCK_MAX; i++)
+        z[i] = (i & 1) ? 1000 : -1000;
+    EXPECT(Imu_Block_Energy(z, IMU_BLOCK_MAX) == (uint64_t)IMU_BLOCK_MAX * IMU_BLOCK_MAX * 1000000,
+           "Energy square wave");
+}
+
+// 整条数据按随机长度分块滤波，和直接卷积逐个对比
+// fixed 不为0时所有系数都用它(增益大于1，检查饱和)，否则随机，绝对值之和不超过1
+static void check_fir(uint8_t taps, int16_t fixed, const char *what)
+{
+    static int16_t in[STREAM_LEN], out[STREAM_LEN], out_ref[STREAM_LEN];
+    int16_t coef[IMU_FIR_MAX_TAPS];
+    Imu_Fir f, f_ref;
+    int i, k, pos, bad = 0;
+    int32_t abs_sum = 0;
+
+    for (k = 0; k < taps; k++)
+    {
+        coef[k] = fixed ? fixed : (int16_t)(rnd16() / taps);
+        abs_sum += abs(coef[k]);
+    }
+    for (i = 0; i < STREAM_LEN; i++)
+        in[i] = rnd16();
+    // 满幅的直流，增益大于1时输出要饱和而不是回绕
+    for (i = 100; i < 140; i++)
+        in[i] = 32767;
+
+    Imu_Fir_Init(&f, coef, taps);
+    Imu_Fir_Init(&f_ref, coef, taps);
+    for (pos = 0; pos < STREAM_LEN; )
+    {
+        int n = 1 + (uint16_t)rnd16() % IMU_BLOCK_MAX;
+
+        if (n > STREAM_LEN - pos)
+            n = STREAM_LEN - pos;
+        memcpy(out + pos, in + pos, n * sizeof(int16_t));
+        Imu_Fir_Process(&f, out + pos, out + pos, (uint16_t)n);      // 原地
+        Imu_Fir_Process_Ref(&f_ref, in + pos, out_ref + pos, (uint16_t)n);
+        pos += n;
+    }
+    for (i = 0; i < STREAM_LEN; i++)
+    {
+        int64_t acc = 0;
+
+        for (k = 0; k < taps && k <= i; k++)
+            acc += (int32_t)coef[k] * in[i - k];
+        acc = (acc + (1 << 14)) >> 15;
+        if (acc > 32767)
+            acc = 32767;
+        if (acc < -32768)
+            acc = -32768;
+        if (out[i] != out_ref[i] || out_ref[i] != acc)
+            bad++;
+    }
+    EXPECT(bad == 0, "FIR %s taps=%u: %d samples differ (sum|coef|=%ld)", what, taps, bad, (long)abs_sum);
+}
+
+static double bench(int use_ref, int kernel)
+{
+    static int16_t x[IMU_BLOCK_MAX], y[IMU_BLOCK_MAX], z[IMU_BLOCK_MAX];
+    static const int16_t lp[8] = { 1024, 3072, 5120, 7168, 7168, 5120, 3072, 1024 };
+    uint32_t sq[IMU_BLOCK_MAX];
+    volatile uint64_t sink = 0;
+    int16_t lo, hi, out[IMU_BLOCK_MAX];
+    Imu_Fir f;
+    clock_t t0;
+    long i;
+
+    for (i = 0; i < IMU_BLOCK_MAX; i++)
+    {
+        x[i] = rnd16();
+        y[i] = rnd16();
+        z[i] = rnd16();
+    }
+    Imu_Fir_Init(&f, lp, 8);
+    t0 = clock();
+    for (i = 0; i < BENCH_BLOCKS; i++)
+    {
+        x[i & (IMU_BLOCK_MAX - 1)] ^= 1;     // 每块改一点，编译器不能把循环外提
+        switch (kernel)
+        {
+        case 0:
+            (use_ref ? Imu_Block_SumSq_Ref : Imu_Block_SumSq)(x, y, z, sq, IMU_BLOCK_MAX);
+            sink += sq[i & (IMU_BLOCK_MAX - 1)];
+            break;
+        case 1:
+            (use_ref ? Imu_Block_MinMax_Ref : Imu_Block_MinMax)(x, IMU_BLOCK_MAX, &lo, &hi);
+            sink += lo + hi;
+            break;
+        case 2:
+            sink += (use_ref ? Imu_Block_Energy_Ref : Imu_Block_Energy)(x, IMU_BLOCK_MAX);
+            break;
+        default:
+            (use_ref ? Imu_Fir_Process_Ref : Imu_Fir_Process)(&f, x, out, IMU_BLOCK_MAX);
+            sink += out[i & (IMU_BLOCK_MAX - 1)];
+            break;
+        }
+    }
+    (void)sink;
+    return (double)(clock() - t0) / CLOCKS_PER_SEC * 1e9 / BENCH_BLOCKS;
+}
+
+int main(void)
+{
+    static const char *const names[] = { "SumSq", "MinMax", "Energy", "FIR 8 taps" };
+    int k;
+
+    printf("imu block kernels, %s path\n", IMU_BLOCK_SIMD ? "SIMD" : "scalar");
+    check_kernels();
+    check_fir(1, 0, "single");
+    check_fir(7, 0, "odd");
+    check_fir(8, 0, "even");
+    check_fir(IMU_FIR_MAX_TAPS, 0, "max");
+    check_fir(4, 16384, "gain 2");
+    printf("%d/%d checks passed\n", checks - failures, checks);
+    if (failures)
+        return 1;
+
+    printf("%-12s %10s %10s  (ns per %d-sample block)\n", "kernel", "ref", "block", IMU_BLOCK_MAX);
+    for (k = 0; k < 4; k++)
+    {
+        double t_ref = bench(1, k);
+        double t_blk = bench(0, k);
+        printf("%-12s %10.1f %10.1f  %.2fx\n", names[k], t_ref, t_blk, t_blk > 0 ? t_ref / t_blk : 0.0);
+    }
+    return 0;
+}
@@ -24,7 +24,7 @@
 // 全局变量
 SDL_Window* window = NULL;
 SDL_Renderer* renderer = NULL;
-uint8_t OLED_GRAM[144][8];  // 模拟OLED显存
+uint8_t OLED_GRAM[8][128];  // 模拟OLED显存，按页存放 [页][列]，与固件一致
 static uint8_t dirty_flag = 0;
 static uint8_t dirty_x1 = 127, dirty_y1 = 63, dirty_x2 = 0, dirty_y2 = 0;
 static char oled_buffer[128];  // OLED_Print用缓冲区
@@ -150,11 +150,7 @@ void OLED_Refresh_Dirty(void) {
 
 // 清屏
 void OLED_Clear(void) {
-    for (uint8_t i = 0; i < 8; i++) {
-        for (uint8_t n = 0; n < 128; n++) {
-            OLED_GRAM[n][i] = 0; // 清除所有数据
-        }
-    }
+    memset(OLED_GRAM, 0, sizeof(OLED_GRAM)); // 清除所有数据
     printf("OLED: 清屏完成\n");
 }
 
@@ -167,9 +163,9 @@ void OLED_DrawPoint(uint8_t x, uint8_t y, uint8_t t) {
     m = y % 8;
     n = 1 << m;
     if (t) {
-        OLED_GRAM[x][i] |= n;
+        OLED_GRAM[i][x] |= n;
     } else {
-        OLED_GRAM[x][i] &= ~n;
+        OLED_GRAM[i][x] &= ~n;
     }
 }
 
@@ -242,41 +238,45 @@ void OLED_DrawCircle(uint8_t x, uint8_t y, uint8_t r) {
     }
 }
 
+// 把按页排列的点阵块直接写入显存，与固件 OLED_Blit 相同
+void OLED_Blit(uint8_t x, uint8_t y, uint8_t w, uint8_t pages, const uint8_t *bmp, uint8_t mode) {
+    uint8_t i, n, b, cols;
+    uint8_t page = y / 8, shift = y % 8;
+    uint8_t inv = mode ? 0x00 : 0xFF;
+    uint8_t keep = 0xFF >> (8 - shift);
+    uint8_t *row, *next;
+    if (x >= WIDTH || page >= 8) return;
+    cols = (w > WIDTH - x) ? WIDTH - x : w;
+    for (n = 0; n < pages && page < 8; n++, page++, bmp += w) {
+        row = &OLED_GRAM[page][x];
+        if (shift == 0) {
+            for (i = 0; i < cols; i++) {
+                row[i] = bmp[i] ^ inv;
+            }
+        } else {
+            next = (page < 7) ? &OLED_GRAM[page + 1][x] : NULL;
+            for (i = 0; i < cols; i++) {
+                b = bmp[i] ^ inv;
+                row[i] = (row[i] & keep) | (uint8_t)(b << shift);
+                if (next) {
+                    next[i] = (next[i] & ~keep) | (b >> (8 - shift));
+                }
+            }
+        }
+    }
+}
+
 // 显示字符
 void OLED_ShowChar(uint8_t x, uint8_t y, uint8_t chr, uint8_t size1, uint8_t mode) {
-    uint8_t i, m, temp, size2, chr1;
-    uint8_t x0 = x, y0 = y;
+    uint8_t chr1 = chr - ' ';
     if (size1 == 8)
-        size2 = 6;
-    else
-        size2 = (size1 / 8 + ((size1 % 8) ? 1 : 0)) * (size1 / 2);
-    chr1 = chr - ' ';
-    for (i = 0; i < size2; i++) {
-        if (size1 == 8) {
-            temp = asc2_0806[chr1][i];
-        } else if (size1 == 12) {
-            temp = asc2_1206[chr1][i];
-        } else if (size1 == 16) {
-            temp = asc2_1608[chr1][i];
-        } else if (size1 == 24) {
-            temp = asc2_2412[chr1][i];
-        } else
-            return;
-        for (m = 0; m < 8; m++) {
-            if (temp & 0x01)
-                OLED_DrawPoint(x, y, mode);
-            else
-                OLED_DrawPoint(x, y, !mode);
-            temp >>= 1;
-            y++;
-        }
-        x++;
-        if ((size1 != 8) && ((x - x0) == size1 / 2)) {
-            x = x0;
-            y0 = y0 + 8;
-        }
-        y = y0;
-    }
+        OLED_Blit(x, y, 6, 1, asc2_0806[chr1], mode);
+    else if (size1 == 12)
+        OLED_Blit(x, y, 6, 2, asc2_1206[chr1], mode);
+    else if (size1 == 16)
+        OLED_Blit(x, y, 8, 2, asc2_1608[chr1], mode);
+    else if (size1 == 24)
+        OLED_Blit(x, y, 12, 3, asc2_2412[chr1], mode);
 }
 
 // 显示字符串
@@ -317,63 +317,19 @@ void OLED_ShowNum(uint8_t x, uint8_t y, uint32_t num, uint8_t len, uint8_t size1
 
 // 显示中文
 void OLED_ShowChinese(uint8_t x, uint8_t y, uint8_t num, uint8_t size1, uint8_t mode) {
-    uint8_t m, temp;
-    uint8_t x0 = x, y0 = y;
-    uint16_t i, size3 = (size1 / 8 + ((size1 % 8) ? 1 : 0)) * size1;
-    for (i = 0; i < size3; i++) {
-        if (size1 == 16) {
-            temp = Hzk1[num][i];
-        } else if (size1 == 24) {
-            temp = Hzk2[num][i];
-        } else if (size1 == 32) {
-            temp = Hzk3[num][i];
-        } else if (size1 == 64) {
-            temp = Hzk4[num][i];
-        } else
-            return;
-        for (m = 0; m < 8; m++) {
-            if (temp & 0x01)
-                OLED_DrawPoint(x, y, mode);
-            else
-                OLED_DrawPoint(x, y, !mode);
-            temp >>= 1;
-            y++;
-        }
-        x++;
-        if ((x - x0) == size1) {
-            x = x0;
-            y0 = y0 + 8;
-        }
-        y = y0;
-    }
+    if (size1 == 16)
+        OLED_Blit(x, y, 16, 2, Hzk1[num], mode);
+    else if (size1 == 24)
+        OLED_Blit(x, y, 24, 3, Hzk2[num], mode);
+    else if (size1 == 32)
+        OLED_Blit(x, y, 32, 4, Hzk3[num], mode);
+    else if (size1 == 64)
+        OLED_Blit(x, y, 64, 8, Hzk4[num], mode);
 }
 
 // 显示图片
 void OLED_ShowPicture(uint8_t x, uint8_t y, uint8_t sizex, uint8_t sizey, const uint8_t BMP[], uint8_t mode) {
-    uint16_t j = 0;
-    uint8_t i, n, temp, m;
-    uint8_t x0 = x, y0 = y;
-    sizey = sizey / 8 + ((sizey % 8) ? 1 : 0);
-    for (n = 0; n < sizey; n++) {
-        for (i = 0; i < sizex; i++) {
-            temp = BMP[j];
-            j++;
-            for (m = 0; m < 8; m++) {
-                if (temp & 0x01)
-                    OLED_DrawPoint(x, y, mode);
-                else
-                    OLED_DrawPoint(x, y, !mode);
-                temp >>= 1;
-                y++;
-            }
-            x++;
-            if ((x - x0) == sizex) {
-                x = x0;
-                y0 = y0 + 8;
-            }
-            y = y0;
-        }
-    }
+    OLED_Blit(x, y, sizex, sizey / 8 + ((sizey % 8) ? 1 : 0), BMP, mode);
 }
 
 // OLED初始化
@@ -521,21 +477,30 @@ void OLED_Display_Sensor(const char* sensor_name, float data1, float data2, cons
     OLED_Printf_Line(3, "Status: Active");
 }
 
+// 整屏左移一列，最右一列由屏幕外的tail补入
+static void OLED_Scroll_Left(uint8_t tail[8][16]) {
+    for (uint8_t n = 0; n < 8; n++) {
+        memmove(OLED_GRAM[n], OLED_GRAM[n] + 1, 127);
+        OLED_GRAM[n][127] = tail[n][0];
+        memmove(tail[n], tail[n] + 1, 15);
+    }
+}
+
 // 滚动显示
 void OLED_ScrollDisplay(uint8_t num, uint8_t space, uint8_t mode) {
-    uint8_t i, n, t = 0, m = 0, r;
+    uint8_t i, t = 0, m = 0, r;
+    uint8_t tail[8][16] = {{0}};  // 屏幕右边外侧的16列
     while (1) {
         if (m == 0) {
-            OLED_ShowChinese(128, 24, t, 16, mode);
+            for (i = 0; i < 16; i++) {
+                tail[3][i] = mode ? Hzk1[t][i] : ~Hzk1[t][i];
+                tail[4][i] = mode ? Hzk1[t][i + 16] : ~Hzk1[t][i + 16];
+            }
             t++;
         }
         if (t == num) {
             for (r = 0; r < 16 * space; r++) {
-                for (i = 1; i < 144; i++) {
-                    for (n = 0; n < 8; n++) {
-                        OLED_GRAM[i - 1][n] = OLED_GRAM[i][n];
-                    }
-                }
+                OLED_Scroll_Left(tail);
                 OLED_Refresh_Dirty();
             }
             t = 0;
@@ -544,11 +509,7 @@ void OLED_ScrollDisplay(uint8_t num, uint8_t space, uint8_t mode) {
         if (m == 16) {
             m = 0;
         }
-        for (i = 1; i < 144; i++) {
-            for (n = 0; n < 8; n++) {
-                OLED_GRAM[i - 1][n] = OLED_GRAM[i][n];
-            }
-        }
+        OLED_Scroll_Left(tail);
         OLED_Refresh_Dirty();
     }
 }
@@ -601,7 +562,7 @@ void save_oled_to_file(const char* filename) {
     for (int y = 0; y < HEIGHT; y++) {
         for (int x = 0; x < WIDTH; x++) {
             int bit_mask = 1 << (y % 8);
-            if (OLED_GRAM[x][y / 8] & bit_mask) {
+            if (OLED_GRAM[y / 8][x] & bit_mask) {
                 fprintf(file, "█");
             } else {
                 fprintf(file, " ");
@@ -627,7 +588,7 @@ void oled_simulator_update_display() {
             int byte_index = x + (y / 8) * WIDTH;
             int bit_mask = 1 << (y % 8);
             
-            if (OLED_GRAM[x][y / 8] & bit_mask) {
+            if (OLED_GRAM[y / 8][x] & bit_mask) {
                 SDL_RenderDrawPoint(renderer, x, y);
             }
         }
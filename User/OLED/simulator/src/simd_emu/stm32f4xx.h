@@ -0,0 +1,53 @@
+// 主机上代替 stm32f4xx.h，只给 imu_block.c 的 SIMD 实现用
+// 按 ARMv7E-M 的定义用C实现它用到的几条 core_cmSimd.h 指令，主机上也能对拍 SIMD 路径
+// GE 标志用一个静态变量模拟：__SSUB16 写，__SEL 读
+#ifndef __SIMD_EMU_STM32F4XX_H
+#define __SIMD_EMU_STM32F4XX_H
+
+#include <stdint.h>
+
+#define __STATIC_INLINE static inline
+
+static uint32_t simd_emu_ge;    // bit0: 低半字 GE，bit1: 高半字 GE
+
+static inline int32_t simd_lo(uint32_t v)
+{
+    return (int16_t)(v & 0xFFFF);
+}
+
+static inline int32_t simd_hi(uint32_t v)
+{
+    return (int16_t)(v >> 16);
+}
+
+static inline uint32_t __SSUB16(uint32_t op1, uint32_t op2)
+{
+    int32_t lo = simd_lo(op1) - simd_lo(op2);
+    int32_t hi = simd_hi(op1) - simd_hi(op2);
+
+    simd_emu_ge = (lo >= 0 ? 1u : 0u) | (hi >= 0 ? 2u : 0u);
+    return ((uint32_t)hi << 16) | ((uint32_t)lo & 0xFFFF);
+}
+
+static inline uint32_t __SEL(uint32_t op1, uint32_t op2)
+{
+    uint32_t lo = (simd_emu_ge & 1) ? op1 : op2;
+    uint32_t hi = (simd_emu_ge & 2) ? op1 : op2;
+
+    return (hi & 0xFFFF0000) | (lo & 0xFFFF);
+}
+
+static inline uint32_t __SMLAD(uint32_t op1, uint32_t op2, uint32_t op3)
+{
+    return op3 + (uint32_t)(simd_lo(op1) * simd_lo(op2)) + (uint32_t)(simd_hi(op1) * simd_hi(op2));
+}
+
+static inline uint64_t __SMLALD(uint32_t op1, uint32_t op2, uint64_t acc)
+{
+    return acc + (uint64_t)((int64_t)simd_lo(op1) * simd_lo(op2) + (int64_t)simd_hi(op1) * simd_hi(op2));
+}
+
+#define __PKHBT(ARG1, ARG2, ARG3)   ((((uint32_t)(ARG1)) & 0x0000FFFFUL) | (((uint32_t)(ARG2) << (ARG3)) & 0xFFFF0000UL))
+#define __PKHTB(ARG1, ARG2, ARG3)   ((((uint32_t)(ARG1)) & 0xFFFF0000UL) | (((uint32_t)(ARG2) >> (ARG3)) & 0x0000FFFFUL))
+
+#endif
@@ -0,0 +1,305 @@
+// 计步流水线回放测试：直接编译固件的 User/code/step_detect.c
+// 主机程序，不依赖SDL
+// 1. 内置场景：按已知步频合成加速度(重力 + 每步一个起伏 + 噪声 + 干扰)，步数和期望值比较
+// 2. 记录的数据：step_replay 文件.csv[:期望步数] ...
+//    CSV 就是 User/code/tools/proto_host.py sensor 10 的输出(t_ms,ax,ay,az[,steps])，非数字开头的行跳过
+// 最后计时，给出每个样本的平均耗时
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "../../../code/step_detect.h"
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+#define RAW_1G      16384.0     // ±2g 量程的原始读数
+#define DT_MS       (1000 / STEP_FS)
+
+static uint32_t rng_state = 12345;
+
+static double rnd(void)
+{
+    rng_state = rng_state * 1664525u + 1013904223u;
+    return (rng_state >> 8) / 16777216.0;
+}
+
+// 近似正态分布
+static double gauss(void)
+{
+    return rnd() + rnd() + rnd() + rnd() - 2.0;
+}
+
+static int16_t raw(double v)
+{
+    if (v > 32767)
+        return 32767;
+    if (v < -32768)
+        return -32768;
+    return (int16_t)lrint(v);
+}
+
+typedef struct
+{
+    Step_Detect sd;
+    uint32_t t;
+    uint16_t cadence;       ///< 最近一段走路结束时的步频
+} Run;
+
+static void start(Run *r)
+{
+    Step_Init(&r->sd);
+    r->t = 0;
+    r->cadence = 0;
+}
+
+static void feed(Run *r, double gx, double gy, double gz)
+{
+    Step_Update(&r->sd, raw(gx), raw(gy), raw(gz), r->t);
+    r->t += DT_MS;
+}
+
+// 静止：重力方向 tilt(弧度)，只有噪声
+static void still(Run *r, double secs, double tilt)
+{
+    int i, n = (int)(secs * STEP_FS);
+
+    for (i = 0; i < n; i++)
+        feed(r, RAW_1G * sin(tilt) + 80 * gauss(), 80 * gauss(), RAW_1G * cos(tilt) + 80 * gauss());
+}
+
+// 走路：每步一个竖直方向的起伏(基波 + 二次谐波)，步间隔有 jitter 的随机变化；返回实际步数
+static int walk(Run *r, double secs, double hz, double amp_g, double jitter)
+{
+    double phase = 0, step_hz = hz * (1 + jitter * gauss());
+    int steps = 0, i, n = (int)(secs * STEP_FS);
+
+    for (i = 0; i < n; i++)
+    {
+        double v = amp_g * (sin(2 * M_PI * phase) + 0.3 * sin(4 * M_PI * phase + 1.0));
+        double side = 0.3 * amp_g * sin(M_PI * phase);      // 左右晃，半个步频
+        feed(r, RAW_1G * side + 150 * gauss(), 150 * gauss(), RAW_1G * (1 + v) + 150 * gauss());
+        phase += step_hz / STEP_FS;
+        if (phase >= 1)
+        {
+            phase -= 1;
+            steps++;
+            step_hz = hz * (1 + jitter * gauss());
+        }
+    }
+    r->cadence = Step_Cadence(&r->sd, r->t);
+    return steps;
+}
+
+// 甩手、拿起放下：间隔不定的单个冲击
+static void gestures(Run *r, double secs)
+{
+    int i, n = (int)(secs * STEP_FS);
+    int next = STEP_FS;
+
+    for (i = 0; i < n; i++)
+    {
+        double v = 0;
+
+        if (i >= next && i < next + STEP_FS / 4)
+            v = 0.8 * sin(M_PI * (i - next) / (STEP_FS / 4.0));
+        if (i == next + STEP_FS / 4)
+            next += (int)(STEP_FS * (0.6 + 2.5 * rnd()));
+        feed(r, RAW_1G * v * 0.7 + 100 * gauss(), RAW_1G * v * 0.7, RAW_1G + 100 * gauss());
+    }
+}
+
+// 车上的振动：6Hz，在带通之外
+static void vibration(Run *r, double secs)
+{
+    int i, n = (int)(secs * STEP_FS);
+
+    for (i = 0; i < n; i++)
+    {
+        double v = 0.3 * sin(2 * M_PI * 6.0 * i / STEP_FS);
+        feed(r, 100 * gauss(), RAW_1G * v * 0.5, RAW_1G * (1 + v) + 100 * gauss());
+    }
+}
+
+// 慢慢转动手腕：重力方向在几秒内转过90度
+static void rotate(Run *r, double secs)
+{
+    int i, n = (int)(secs * STEP_FS);
+
+    for (i = 0; i < n; i++)
+    {
+        double a = M_PI / 2 * i / n;
+        feed(r, RAW_1G * sin(a) + 80 * gauss(), 80 * gauss(), RAW_1G * cos(a) + 80 * gauss());
+    }
+}
+
+static int failures = 0;
+static int cases = 0;
+
+// hz 为0时不检查步频，否则要在 60*hz 的 5% 以内
+static void check(const char *name, const Run *r, int expect, int tol, double hz)
+{
+    int got = (int)r->sd.steps;
+    int ok = abs(got - expect) <= tol;
+
+    if (hz > 0 && fabs(r->cadence - 60 * hz) > 3 * hz)
+        ok = 0;
+    cases++;
+    if (!ok)
+        failures++;
+    printf("%-4s %-26s expect %4d got %4d  cadence %3u/min stride %4u mm dist %6.1f m\n",
+           ok ? "ok" : "FAIL", name, expect, got, (unsigned)r->cadence,
+           (unsigned)r->sd.stride_mm, r->sd.distance_mm / 1000.0);
+}
+
+// 计数允许的误差：走路开头的窗口预热和确认期会漏掉一两步
+static int tolerance(int steps)
+{
+    int t = steps * 3 / 100;
+    return t > 3 ? t : 3;
+}
+
+static void scenarios(void)
+{
+    Run r;
+    int n;
+
+    start(&r);
+    still(&r, 30, 0.4);
+    check("still", &r, 0, 0, 0);
+
+    start(&r);
+    still(&r, 2, 0);
+    n = walk(&r, 60, 1.2, 0.12, 0.04);
+    still(&r, 2, 0);
+    check("slow walk 72/min 0.12g", &r, n, tolerance(n), 1.2);
+
+    start(&r);
+    still(&r, 2, 0);
+    n = walk(&r, 60, 1.8, 0.3, 0.04);
+    still(&r, 2, 0);
+    check("walk 108/min 0.3g", &r, n, tolerance(n), 1.8);
+
+    start(&r);
+    still(&r, 2, 0);
+    n = walk(&r, 60, 2.8, 0.9, 0.03);
+    still(&r, 2, 0);
+    check("run 168/min 0.9g", &r, n, tolerance(n), 2.8);
+
+    start(&r);
+    still(&r, 2, 0);
+    n = walk(&r, 20, 1.7, 0.3, 0.04);
+    still(&r, 10, 0.2);
+    n += walk(&r, 20, 1.7, 0.3, 0.04);
+    still(&r, 2, 0);
+    check("walk, stop, walk", &r, n, 2 * tolerance(n / 2), 1.7);
+
+    start(&r);
+    still(&r, 2, 0);
+    gestures(&r, 30);
+    check("arm gestures", &r, 0, 0, 0);
+
+    start(&r);
+    still(&r, 2, 0);
+    vibration(&r, 30);
+    check("6Hz vibration", &r, 0, 0, 0);
+
+    start(&r);
+    still(&r, 2, 0);
+    rotate(&r, 5);
+    still(&r, 5, M_PI / 2);
+    check("wrist rotation", &r, 0, 0, 0);
+}
+
+// 回放一个 CSV
+static void replay(const char *arg)
+{
+    char path[512], line[256];
+    const char *colon = strrchr(arg, ':');
+    int expect = -1;
+    long samples = 0;
+    uint32_t first = 0, last = 0;
+    Run r;
+    FILE *f;
+
+    snprintf(path, sizeof(path), "%s", arg);
+    if (colon && colon[1] >= '0' && colon[1] <= '9')
+    {
+        expect = atoi(colon + 1);
+        path[colon - arg] = '\0';
+    }
+    f = fopen(path, "r");
+    if (!f)
+    {
+        printf("FAIL %s: cannot open\n", path);
+        cases++;
+        failures++;
+        return;
+    }
+    start(&r);
+    while (fgets(line, sizeof(line), f))
+    {
+        unsigned long t;
+        int ax, ay, az;
+
+        if (line[0] < '0' || line[0] > '9')
+            continue;
+        if (sscanf(line, "%lu,%d,%d,%d", &t, &ax, &ay, &az) != 4)
+            continue;
+        if (samples == 0)
+            first = (uint32_t)t;
+        last = (uint32_t)t;
+        Step_Update(&r.sd, (int16_t)ax, (int16_t)ay, (int16_t)az, (uint32_t)t);
+        samples++;
+    }
+    fclose(f);
+    r.t = last;
+    if (samples > 1)
+    {
+        double dt = (double)(last - first) / (samples - 1);
+        if (dt < DT_MS * 0.8 || dt > DT_MS * 1.2)
+            printf("warn %s: %.1f ms per sample, pipeline expects %d\n", path, dt, DT_MS);
+    }
+    if (expect < 0)
+    {
+        printf("     %-26s %ld samples, %u steps\n", path, samples, (unsigned)r.sd.steps);
+        return;
+    }
+    r.cadence = Step_Cadence(&r.sd, last);
+    check(path, &r, expect, tolerance(expect), 0);
+}
+
+static double bench(void)
+{
+    Run r;
+    clock_t t0;
+    long i, n = 5L * 1000 * 1000;
+    volatile uint32_t sink;
+
+    start(&r);
+    t0 = clock();
+    for (i = 0; i < n; i++)
+    {
+        int16_t z = (int16_t)(16384 + ((i * 37) & 4095) - 2048);
+        Step_Update(&r.sd, (int16_t)(i & 511), (int16_t)-(i & 255), z, (uint32_t)(i * DT_MS));
+    }
+    sink = r.sd.steps;
+    (void)sink;
+    return (double)(clock() - t0) / CLOCKS_PER_SEC * 1e9 / n;
+}
+
+int main(int argc, char *argv[])
+{
+    int i;
+
+    printf("step pipeline replay, %d Hz\n", STEP_FS);
+    scenarios();
+    for (i = 1; i < argc; i++)
+        replay(argv[i]);
+    printf("%d/%d cases passed\n", cases - failures, cases);
+    printf("Step_Update: %.1f ns/sample on this host\n", bench());
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,239 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+图片资源压缩：把 logo.c / bagua.c 中的原始点阵数组编码成 oled_assets.c / oled_assets.h
+
+用法: python gen_assets.py [输出目录]
+默认读写本脚本上一级目录(User/OLED)。修改 logo.c、bagua.c 或下面的 IMAGES 表后重新运行。
+
+编码格式(解码器见 oled_image.c):
+  点阵顺序与 OLED_ShowPicture 相同：先第0页的 width 个字节，再第1页...
+  RLE 控制字节 c:
+    0x00~0x7F  后面跟 c+1 个原样字节
+    0x80~0xFF  后面跟 1 个字节，重复 (c&0x7F)+2 次
+  单张图片用 RLE 编码，若不比原始数据小则直接存原始数据(RAW)
+  动画第0帧为关键帧(RLE)，之后每帧存与上一帧的异或差(XOR)，同样用 RLE 编码；
+  最后多存一帧“第0帧 XOR 最后一帧”，循环播放时回到第0帧用
+"""
+import os
+import re
+import sys
+
+# 数组名 -> (资源名, 宽, 高)；宽高以调用处实际显示的尺寸为准
+IMAGES = [
+    ("logo.c", "logo", "img_logo", 128, 64),
+    ("logo.c", "gImage_1", "img_1", 58, 58),
+    ("logo.c", "gImage_bg", "img_bg", 64, 64),
+    ("logo.c", "gImage_bgg", "img_bgg", 64, 64),
+    ("logo.c", "gImage_xbg", "img_xbg", 32, 32),
+    ("logo.c", "gImage_calendar", "img_calendar", 32, 32),
+    ("logo.c", "gImage_clock", "img_clock", 32, 32),
+    ("logo.c", "gImage_flashlight", "img_flashlight", 32, 32),
+    ("logo.c", "gImage_stopwatch", "img_stopwatch", 32, 32),
+    ("logo.c", "gImage_setting", "img_setting", 32, 32),
+    ("logo.c", "gImage_TandH", "img_TandH", 32, 32),
+    ("logo.c", "gImage_sun", "img_sun", 32, 32),
+    ("logo.c", "gImage_moon", "img_moon", 32, 32),
+    ("logo.c", "gImage_bell", "img_bell", 32, 32),
+    ("logo.c", "gImage_list", "img_list", 32, 32),
+    ("logo.c", "gImage_new", "img_new", 32, 32),
+    ("logo.c", "gImage_add", "img_add", 32, 32),
+    ("logo.c", "gImage_step", "img_step", 32, 32),
+    ("logo.c", "gImage_test", "img_test", 32, 32),
+]
+
+# 动画：数组名 -> (资源名, 帧数, 宽, 高)
+ANIMS = [
+    ("bagua.c", "bagua_frames", "anim_bagua", 8, 128, 64),
+]
+
+FORMAT_NAME = {0: "OLED_IMG_RAW", 1: "OLED_IMG_RLE", 2: "OLED_IMG_XOR"}
+
+ARRAY_RE = re.compile(r"const\s+unsigned\s+char\s+(\w+)\s*((?:\[[^\]]*\])+)\s*=\s*\{", re.S)
+TOKEN_RE = re.compile(r"[{}]|0[xX][0-9a-fA-F]+|\d+")
+
+
+def read_text(path):
+    with open(path, "rb") as f:
+        raw = f.read()
+    try:
+        return raw.decode("utf-8")
+    except UnicodeDecodeError:
+        return raw.decode("gb18030")
+
+
+def parse_arrays(text):
+    """返回 {数组名: [字节...]}，二维数组每行按第二维长度补0(与C的初始化规则一致)"""
+    text = re.sub(r"/\*.*?\*/", "", text, flags=re.S)
+    text = re.sub(r"//[^\n]*", "", text)
+    arrays = {}
+    for m in ARRAY_RE.finditer(text):
+        dims = re.findall(r"\[([^\]]*)\]", m.group(2))
+        inner = int(dims[1], 0) if len(dims) == 2 else None
+        depth, data, row = 1, [], []
+        for tok in TOKEN_RE.finditer(text, m.end()):
+            t = tok.group(0)
+            if t == "{":
+                depth += 1
+                row = []
+            elif t == "}":
+                depth -= 1
+                if depth == 0:
+                    break
+                data += row + [0] * (inner - len(row))
+            elif depth == 2:
+                row.append(int(t, 0))
+            else:
+                data.append(int(t, 0))
+        arrays[m.group(1)] = data
+    return arrays
+
+
+def rle_encode(data):
+    out = []
+    lit = []
+    i = 0
+
+    def flush():
+        while lit:
+            chunk = lit[:128]
+            del lit[:128]
+            out.append(len(chunk) - 1)
+            out.extend(chunk)
+
+    while i < len(data):
+        run = 1
+        while i + run < len(data) and data[i + run] == data[i] and run < 129:
+            run += 1
+        if run >= 3:
+            flush()
+            out.append(0x80 | (run - 2))
+            out.append(data[i])
+            i += run
+        else:
+            lit.extend(data[i:i + run])
+            i += run
+    flush()
+    return out
+
+
+def rle_decode(stream, size):
+    out = []
+    i = 0
+    while len(out) < size:
+        c = stream[i]
+        i += 1
+        if c & 0x80:
+            out += [stream[i]] * ((c & 0x7F) + 2)
+            i += 1
+        else:
+            out += stream[i:i + c + 1]
+            i += c + 1
+    return out
+
+
+def bytes_c(data, indent="    "):
+    lines = []
+    for i in range(0, len(data), 16):
+        lines.append(indent + ", ".join("0x%02X" % b for b in data[i:i + 16]) + ",")
+    return "\n".join(lines)
+
+
+def frame_size(w, h):
+    return w * ((h + 7) // 8)
+
+
+def encode_image(raw):
+    enc = rle_encode(raw)
+    assert rle_decode(enc, len(raw)) == raw
+    if len(enc) < len(raw):
+        return 1, enc
+    return 0, raw
+
+
+def generate(base, out_dir):
+    sources = {}
+    for src in set(s for s, *_ in IMAGES + ANIMS):
+        sources[src] = parse_arrays(read_text(os.path.join(base, src)))
+
+    c_out = []
+    h_out = []
+    total_raw = total_enc = 0
+
+    c_out.append("// 由 tools/gen_assets.py 根据 logo.c / bagua.c 生成，请勿手工修改")
+    c_out.append('#include "oled_assets.h"')
+    c_out.append("")
+
+    h_out.append("// 由 tools/gen_assets.py 生成，请勿手工修改")
+    h_out.append("#ifndef __OLED_ASSETS_H")
+    h_out.append("#define __OLED_ASSETS_H")
+    h_out.append("")
+    h_out.append('#include "oled_image.h"')
+    h_out.append("")
+
+    for src, arr, name, w, h in IMAGES:
+        raw = sources[src][arr]
+        size = frame_size(w, h)
+        if len(raw) < size:
+            raise SystemExit("%s: %d 字节，不够 %dx%d" % (arr, len(raw), w, h))
+        raw = raw[:size]
+        fmt, enc = encode_image(raw)
+        total_raw += size
+        total_enc += len(enc)
+        c_out.append("// %s %dx%d: %d -> %d 字节" % (arr, w, h, size, len(enc)))
+        c_out.append("static const uint8_t %s_data[%d] = {" % (name, len(enc)))
+        c_out.append(bytes_c(enc))
+        c_out.append("};")
+        c_out.append("const OLED_Image %s = {%d, %d, %s, %d, %s_data};"
+                     % (name, w, h, FORMAT_NAME[fmt], len(enc), name))
+        c_out.append("")
+        h_out.append("extern const OLED_Image %s;" % name)
+
+    for src, arr, name, count, w, h in ANIMS:
+        raw = sources[src][arr]
+        size = frame_size(w, h)
+        frames = [raw[i * size:(i + 1) * size] for i in range(count)]
+        frames = [f + [0] * (size - len(f)) for f in frames]
+        streams = []
+        fmt, enc = encode_image(frames[0])
+        streams.append((fmt, enc))
+        order = list(range(1, count)) + [0]
+        for i in order:
+            prev = frames[i - 1]
+            delta = [a ^ b for a, b in zip(frames[i], prev)]
+            enc = rle_encode(delta)
+            assert rle_decode(enc, size) == delta
+            streams.append((2, enc))
+        anim_enc = sum(len(e) for _, e in streams)
+        total_raw += size * count
+        total_enc += anim_enc
+        c_out.append("// %s %d帧 %dx%d: %d -> %d 字节" % (arr, count, w, h, size * count, anim_enc))
+        for k, (fmt, enc) in enumerate(streams):
+            c_out.append("static const uint8_t %s_%d[%d] = {" % (name, k, len(enc)))
+            c_out.append(bytes_c(enc))
+            c_out.append("};")
+        c_out.append("static const OLED_Image %s_frames[%d] = {" % (name, len(streams)))
+        for k, (fmt, enc) in enumerate(streams):
+            c_out.append("    {%d, %d, %s, %d, %s_%d}," % (w, h, FORMAT_NAME[fmt], len(enc), name, k))
+        c_out.append("};")
+        c_out.append("const OLED_Anim %s = {%d, %s_frames};" % (name, count, name))
+        c_out.append("")
+        h_out.append("extern const OLED_Anim %s;" % name)
+
+    c_out.append("// 合计: %d -> %d 字节" % (total_raw, total_enc))
+    c_out.append("")
+    h_out.append("")
+    h_out.append("#endif")
+    h_out.append("")
+
+    with open(os.path.join(out_dir, "oled_assets.c"), "w", encoding="utf-8", newline="\n") as f:
+        f.write("\n".join(c_out))
+    with open(os.path.join(out_dir, "oled_assets.h"), "w", encoding="utf-8", newline="\n") as f:
+        f.write("\n".join(h_out))
+    print("原始 %d 字节 -> 压缩后 %d 字节" % (total_raw, total_enc))
+
+
+if __name__ == "__main__":
+    base = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+    out = sys.argv[1] if len(sys.argv) > 1 else base
+    generate(base, out)
@@ -0,0 +1,129 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+从 oledfont.h 的点阵数组生成字体描述表 oledfont_meta.h
+
+用法: python gen_font_meta.py [oledfont.h] [oledfont_meta.h]
+默认读写本脚本上一级目录(User/OLED)下的文件。修改 oledfont.h 后重新运行。
+
+生成内容:
+  - 每套ASCII字体的比例宽度表 {起始列, 墨迹宽度}，由点阵实际有墨迹的列算出
+    数字0~9统一成同一宽度，时钟之类的数字刷新时不会左右跳动
+  - 每套字体的 OLED_Font 描述(宽、高、页数、每字形字节数、首字符、字符数、点阵指针)
+"""
+import os
+import re
+import sys
+
+# 数组名 -> (描述名, 字形宽度, 字形高度, 首字符)
+# 字形宽度就是点阵每页的列数，高度是实际像素高度(1206 点阵占2页但只有12行)
+FONTS = [
+    ("asc2_0806", "0806", 6, 8, " "),
+    ("asc2_1206", "1206", 6, 12, " "),
+    ("asc2_1608", "1608", 8, 16, " "),
+    ("asc2_2412", "2412", 12, 24, " "),
+    ("Hzk1", "hz16", 16, 16, None),
+    ("Hzk2", "hz24", 24, 24, None),
+    ("Hzk3", "hz32", 32, 32, None),
+    ("Hzk4", "hz64", 64, 64, None),
+]
+
+# 这些字体额外生成比例宽度版本
+PROPORTIONAL = ["asc2_1206", "asc2_1608", "asc2_2412"]
+
+ARRAY_RE = re.compile(
+    r"const\s+unsigned\s+char\s+(\w+)\s*\[[^\]]*\]\s*\[\s*(\d+)\s*\]\s*=\s*\{(.*?)\n\s*\}\s*;",
+    re.S)
+HEX_RE = re.compile(r"0[xX][0-9a-fA-F]{1,2}")
+
+
+def parse_fonts(text):
+    """返回 {数组名: (每字形字节数, [字形字节列表...])}"""
+    text = re.sub(r"/\*.*?\*/", "", text, flags=re.S)
+    text = re.sub(r"//[^\n]*", "", text)
+    fonts = {}
+    for name, stride, body in ARRAY_RE.findall(text):
+        stride = int(stride)
+        data = [int(h, 16) for h in HEX_RE.findall(body)]
+        if len(data) % stride:
+            raise SystemExit("%s: 数据长度 %d 不是 %d 的整数倍" % (name, len(data), stride))
+        fonts[name] = (stride, [data[i:i + stride] for i in range(0, len(data), stride)])
+    return fonts
+
+
+def ink_columns(glyph, width, pages):
+    """返回有墨迹的列号列表"""
+    return [c for c in range(width) if any(glyph[p * width + c] for p in range(pages))]
+
+
+def proportional_table(glyphs, width, pages, first):
+    table = []
+    for i, g in enumerate(glyphs):
+        cols = ink_columns(g, width, pages)
+        if not cols:
+            # 空格等空白字符取半个字宽
+            table.append((0, max(2, width // 2)))
+        else:
+            table.append((cols[0], cols[-1] - cols[0] + 1))
+    # 数字统一宽度：取所有数字墨迹范围的并集
+    d0 = ord("0") - ord(first)
+    digits = [ink_columns(glyphs[d0 + i], width, pages) for i in range(10)]
+    lo = min(c[0] for c in digits if c)
+    hi = max(c[-1] for c in digits if c)
+    for i in range(10):
+        table[d0 + i] = (lo, hi - lo + 1)
+    return table
+
+
+def generate(src_path, dst_path):
+    with open(src_path, "rb") as f:
+        raw = f.read()
+    try:
+        text = raw.decode("utf-8")
+    except UnicodeDecodeError:
+        text = raw.decode("gb18030")
+    fonts = parse_fonts(text)
+
+    out = []
+    out.append("// 由 tools/gen_font_meta.py 根据 oledfont.h 生成，请勿手工修改")
+    out.append("// 只能被 oled.c 包含一次(和 oledfont.h 一样直接定义数据)")
+    out.append("#ifndef __OLEDFONT_META_H")
+    out.append("#define __OLEDFONT_META_H")
+    out.append("")
+
+    for name, tag, width, height, first in FONTS:
+        if name not in fonts:
+            raise SystemExit("oledfont.h 中没有找到 %s" % name)
+        stride, glyphs = fonts[name]
+        pages = (height + 7) // 8
+        if stride != width * pages:
+            raise SystemExit("%s: 每字形 %d 字节，与 %dx%d 不符" % (name, stride, width, height))
+        first_code = ord(first) if first else 0
+        base = "&%s[0][0]" % name
+
+        out.append("// %s: %dx%d, %d 个字形" % (name, width, height, len(glyphs)))
+        out.append("const OLED_Font oled_font_%s = {%s, 0, %d, %d, %d, %d, %d, %d};"
+                   % (tag, base, width, height, pages, stride, first_code, len(glyphs)))
+        if name in PROPORTIONAL:
+            table = proportional_table(glyphs, width, pages, first)
+            out.append("static const uint8_t %s_prop[%d][2] = {" % (name, len(table)))
+            for i, (start, w) in enumerate(table):
+                ch = chr(first_code + i)
+                out.append("    {%d, %d}, // '%s'" % (start, w, "\\\\" if ch == "\\" else ch))
+            out.append("};")
+            out.append("const OLED_Font oled_font_%sp = {%s, %s_prop, %d, %d, %d, %d, %d, %d};"
+                       % (tag, base, name, width, height, pages, stride, first_code, len(glyphs)))
+        out.append("")
+
+    out.append("#endif")
+    out.append("")
+    with open(dst_path, "w", encoding="utf-8", newline="\n") as f:
+        f.write("\n".join(out))
+
+
+if __name__ == "__main__":
+    here = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+    src = sys.argv[1] if len(sys.argv) > 1 else os.path.join(here, "oledfont.h")
+    dst = sys.argv[2] if len(sys.argv) > 2 else os.path.join(here, "oledfont_meta.h")
+    generate(src, dst)
+    print("已生成", dst)
@@ -0,0 +1,113 @@
+/**
+ * @file cmd.c
+ * @brief 串口命令注册表实现
+ */
+
+#include "cmd.h"
+#include "uart_dma.h"
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+
+static const Cmd *cmd_index[CMD_MAX];   ///< 按名称排序的表项指针
+static uint8_t cmd_count = 0;
+
+// 二分查找，找到返回下标；找不到返回 -1，*pos 为应插入的位置
+static int16_t Cmd_Find(const char *name, uint8_t *pos)
+{
+    int16_t lo = 0, hi = cmd_count - 1;
+
+    while (lo <= hi)
+    {
+        int16_t mid = (lo + hi) / 2;
+        int c = strcmp(name, cmd_index[mid]->name);
+        if (c == 0)
+            return mid;
+        if (c < 0)
+            hi = mid - 1;
+        else
+            lo = mid + 1;
+    }
+    if (pos)
+        *pos = (uint8_t)lo;
+    return -1;
+}
+
+uint8_t Cmd_Register(const Cmd *table, uint8_t n)
+{
+    uint8_t i, pos;
+    uint8_t err = 0;
+
+    for (i = 0; i < n; i++)
+    {
+        int16_t found = Cmd_Find(table[i].name, &pos);
+        if (found >= 0)
+        {
+            // 同一张表再次登记时直接忽略，不算错误
+            if (cmd_index[found] != &table[i])
+                err = 1;
+            continue;
+        }
+        if (cmd_count >= CMD_MAX)
+            return 1;
+        memmove(&cmd_index[pos + 1], &cmd_index[pos], (cmd_count - pos) * sizeof(cmd_index[0]));
+        cmd_index[pos] = &table[i];
+        cmd_count++;
+    }
+    return err;
+}
+
+uint8_t Cmd_Exec(char *line)
+{
+    char *argv[CMD_MAX_ARGS];
+    uint8_t argc = 0;
+    int16_t i;
+    char *p = line;
+
+    // 按空格切词，多余的单词并入最后一个参数
+    while (*p && argc < CMD_MAX_ARGS)
+    {
+        while (*p == ' ' || *p == '\t')
+            *p++ = '\0';
+        if (!*p)
+            break;
+        argv[argc++] = p;
+        while (*p && *p != ' ' && *p != '\t')
+            p++;
+    }
+    if (argc == 0)
+        return 1;
+
+    i = Cmd_Find(argv[0], 0);
+    if (i < 0)
+        return 1;
+    cmd_index[i]->handler(argc, argv);
+    return 0;
+}
+
+void Cmd_Help(void)
+{
+    uint8_t i;
+
+    printf("Commands:\r\n");
+    for (i = 0; i < cmd_count; i++)
+    {
+        if (cmd_index[i]->help)
+        {
+            printf("%s\r\n", cmd_index[i]->help);
+            // 帮助比发送缓冲区长，每行之后等缓冲区腾出一半
+            while (uart_get_tx_buf_usage() > UART_TX_BUF_SIZE / 2)
+                ;
+        }
+    }
+}
+
+uint8_t Cmd_Arg_U32(const char *s, uint32_t *value)
+{
+    char *end;
+
+    if (!s || !*s)
+        return 1;
+    *value = strtoul(s, &end, 0);
+    return *end != '\0';
+}
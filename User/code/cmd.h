@@ -0,0 +1,78 @@
+/**
+ * @file cmd.h
+ * @brief 串口命令注册表
+ * @details 各模块用静态常量表描述自己的命令，在初始化时调用 Cmd_Register() 登记。
+ *          登记时按名称插入有序索引，执行时二分查找，命令再多查找也只要 log2(n) 次比较。
+ *          一行命令按空格切成 argv，argv[0] 是命令名，后面是参数。
+ *
+ *          用法：
+ *          @code
+ *          static void cmd_beep(uint8_t argc, char *argv[]) { ... }
+ *          static const Cmd beep_cmds[] = {
+ *              { "beep", cmd_beep, "beep [ms] - Sound the buzzer" },
+ *          };
+ *          Cmd_Register(beep_cmds, CMD_COUNT(beep_cmds));
+ *          @endcode
+ */
+
+#ifndef __CMD_H
+#define __CMD_H
+
+#include "stm32f4xx.h"
+
+// =============================================================================
+// 配置宏
+// =============================================================================
+#ifndef CMD_MAX
+#define CMD_MAX         48      ///< 最多登记的命令数
+#endif
+
+#ifndef CMD_MAX_ARGS
+#define CMD_MAX_ARGS    8       ///< 一行最多切出的单词数(含命令名)
+#endif
+
+/**
+ * @brief 命令处理函数，argv[0] 为命令名
+ */
+typedef void (*Cmd_Func)(uint8_t argc, char *argv[]);
+
+/**
+ * @brief 命令表项
+ */
+typedef struct
+{
+    const char *name;       ///< 命令名，小写，不含空格
+    Cmd_Func handler;       ///< 处理函数
+    const char *help;       ///< 帮助文字，NULL 表示不在 help 中列出(兼容旧写法的别名)
+} Cmd;
+
+#define CMD_COUNT(table)    ((uint8_t)(sizeof(table) / sizeof((table)[0])))
+
+/**
+ * @brief 登记一张命令表
+ * @param table 命令表，必须是静态常量(只保存指针)
+ * @param n     表项数
+ * @return 0: 成功；1: 注册表已满或有重名，多余/重名的表项被忽略
+ * @note 同一张表重复登记会被忽略，可以放在可能多次调用的初始化函数里
+ */
+uint8_t Cmd_Register(const Cmd *table, uint8_t n);
+
+/**
+ * @brief 执行一行命令
+ * @param line 命令行，会被原地切分
+ * @return 0: 已执行；1: 空行或未知命令
+ */
+uint8_t Cmd_Exec(char *line);
+
+/**
+ * @brief 按名称顺序打印所有带帮助的命令
+ */
+void Cmd_Help(void);
+
+/**
+ * @brief 解析数字参数，支持十进制和 0x 开头的十六进制
+ * @return 0: 成功；1: 不是数字
+ */
+uint8_t Cmd_Arg_U32(const char *s, uint32_t *value);
+
+#endif
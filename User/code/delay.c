@@ -1,29 +1,61 @@
 #include "delay.h"
+#include "dwt.h"
 
-__IO uint32_t TimingDelay = 0;        // 延时统计多少个10us
-__IO uint32_t Systick_count = 0;      // 统计系统运行时间单位ms
+// 时基：TIM2 32位自由计数，1MHz，不产生周期中断
+// 只有溢出(约71分钟一次)和 Timebase_Set_Wakeup() 设置的比较匹配会产生中断
+static uint32_t tb_ms = 0;      // 已折算的毫秒数
+static uint32_t tb_last = 0;    // tb_ms 对应的 TIM2 计数值
 
-// SysTick中断服务函数定义在 stm32f4xx_it.c 中
-
-// 启动系统滴答定时器 SysTick, 10us中断一次
+// 初始化时基定时器TIM2，1us计数一次
+// 保留原来的函数名，旧代码调用 SysTick_Init() 不需要修改
 void SysTick_Init(void)
 {
-    // SystemCoreClock == 168000 000
-    // SystemCoreClock / 1000    1ms中断一次
-    // SystemCoreClock / 100000  10us中断一次
-    // SystemCoreClock / 1000000 1us中断一次
-    // 注意：中断一次的时间1us时，整个程序的重心都花在进出中断上了，根本没有时间处理其他的任务，因此不推荐
-    if (SysTick_Config(SystemCoreClock / 100000)) {   // 1680
-        /* Capture error */
-        while (1);
-    }
+    TIM_TimeBaseInitTypeDef TIM_TimeBaseStructure;
+    NVIC_InitTypeDef NVIC_InitStructure;
+
+    // 已经初始化过就不再重置计数
+    if (TIM2->CR1 & TIM_CR1_CEN)
+        return;
+
+    DWT_Init();
+
+    // 不再使用10us一次的SysTick中断
+    SysTick->CTRL = 0;
+
+    RCC_APB1PeriphClockCmd(RCC_APB1Periph_TIM2, ENABLE);
+
+    // APB1 = 42MHz，定时器时钟 = 84MHz = SystemCoreClock / 2
+    TIM_TimeBaseStructure.TIM_Prescaler = SystemCoreClock / 2 / 1000000 - 1;
+    TIM_TimeBaseStructure.TIM_Period = 0xFFFFFFFF;
+    TIM_TimeBaseStructure.TIM_CounterMode = TIM_CounterMode_Up;
+    TIM_TimeBaseStructure.TIM_ClockDivision = TIM_CKD_DIV1;
+    TIM_TimeBaseStructure.TIM_RepetitionCounter = 0;
+    TIM_TimeBaseInit(TIM2, &TIM_TimeBaseStructure);
+
+    // TIM_TimeBaseInit 产生的更新事件会置位更新标志，先清掉
+    TIM_ClearITPendingBit(TIM2, TIM_IT_Update | TIM_IT_CC1);
+    TIM_ITConfig(TIM2, TIM_IT_Update, ENABLE);
+
+    NVIC_InitStructure.NVIC_IRQChannel = TIM2_IRQn;
+    NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = 0;
+    NVIC_InitStructure.NVIC_IRQChannelSubPriority = 0;
+    NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
+    NVIC_Init(&NVIC_InitStructure);
+
+    TIM_Cmd(TIM2, ENABLE);
 }
 
-// 延时函数单位us (精度10us）
+// 延时函数单位us，用DWT周期计数，精度为几个内核周期
+// 不依赖中断，关中断时也可以使用
 void delay_us(uint32_t us)
 {
-    TimingDelay = us / 10;    // TimingDelay变量每隔10us在中断服务函数-1
-    while (TimingDelay != 0);    // 等待TimingDelay减到0，即延时时间到
+    // CYCCNT 约25秒回绕，长延时分段
+    while (us > 1000000)
+    {
+        delay_cycles(1000000 * dwt_cycles_per_us);
+        us -= 1000000;
+    }
+    delay_cycles(us * dwt_cycles_per_us);
 }
 
 // 延时函数单位ms
@@ -36,28 +68,70 @@ void delay_ms(uint32_t ms)
 }
 
 // 获取系统运行时间单位ms
+// 把上次折算以来的整毫秒数累加到 tb_ms，不足1ms的部分留到下次
 uint32_t get_systick(void)
 {
-    return Systick_count;
+    uint32_t primask = __get_PRIMASK();
+    uint32_t ms;
+
+    __disable_irq();
+    ms = (TIM2->CNT - tb_last) / 1000;
+    tb_ms += ms;
+    tb_last += ms * 1000;
+    ms = tb_ms;
+    __set_PRIMASK(primask);
+
+    return ms;
 }
 
-// 不使用中断的微秒延时(精度1us)
-void delay_us_no_irq(uint32_t us)
+// 获取微秒时间戳(约71分钟回绕一次)，STOP模式期间不计数
+uint32_t micros(void)
 {
-    SysTick->CTRL = 0;
-    uint32_t ticks = us * (SystemCoreClock / 1000000);
-    
-    SysTick->LOAD = ticks - 1;
-    SysTick->VAL = 0UL;
-    SysTick->CTRL  = SysTick_CTRL_CLKSOURCE_Msk |   // 设置系统定时器的时钟源为内核时钟AHBCLK=168M
-                    SysTick_CTRL_ENABLE_Msk;        // 使能定时器;
-    // / 等待计数完成
-    while (!(SysTick->CTRL & SysTick_CTRL_COUNTFLAG_Msk))
+    return TIM2->CNT;
+}
+
+// 在 get_systick() 再过 ms 毫秒时产生一次TIM2比较中断，用于把CPU从WFI唤醒
+void Timebase_Set_Wakeup(uint32_t ms)
+{
+    if (ms > TIMEBASE_MAX_WAKEUP_MS)
+        ms = TIMEBASE_MAX_WAKEUP_MS;
+
+    get_systick();
+    TIM_SetCompare1(TIM2, tb_last + ms * 1000);
+    TIM_ClearITPendingBit(TIM2, TIM_IT_CC1);
+    TIM_ITConfig(TIM2, TIM_IT_CC1, ENABLE);
+}
+
+// STOP模式下TIM2停止计数，醒来后把睡眠的时间补到毫秒计数上
+void Timebase_Add_Ms(uint32_t ms)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    tb_ms += ms;
+    __set_PRIMASK(primask);
+}
+
+// TIM2中断：溢出时折算一次毫秒计数，比较匹配只用于唤醒
+void TIM2_IRQHandler(void)
+{
+    if (TIM_GetITStatus(TIM2, TIM_IT_Update) != RESET)
+    {
+        TIM_ClearITPendingBit(TIM2, TIM_IT_Update);
+        get_systick();
+    }
+    if (TIM_GetITStatus(TIM2, TIM_IT_CC1) != RESET)
     {
+        TIM_ClearITPendingBit(TIM2, TIM_IT_CC1);
+        TIM_ITConfig(TIM2, TIM_IT_CC1, DISABLE);
     }
-    
-    //SysTick->CTRL = 0; // 不使用中断方法
-    SysTick_Init(); //恢复中断方法    
+}
+
+// 不使用中断的微秒延时
+// delay_us 本身不依赖中断，保留这个函数兼容旧代码
+void delay_us_no_irq(uint32_t us)
+{
+    delay_us(us);
 }
 
 void delay_ms_no_irq(uint32_t ms)
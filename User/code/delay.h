@@ -2,14 +2,16 @@
 #define DELAY_H
 #include "stm32f4xx.h"
 
-// 声明全局变量供其他文件使用
-extern __IO uint32_t TimingDelay;
-extern __IO uint32_t Systick_count;
+// Timebase_Set_Wakeup() 一次最长的唤醒间隔(ms)
+#define TIMEBASE_MAX_WAKEUP_MS  60000
 
 void SysTick_Init(void);
 void delay_us(uint32_t us);
 void delay_ms(uint32_t ms);
 uint32_t get_systick(void);
+uint32_t micros(void);
+void Timebase_Set_Wakeup(uint32_t ms);
+void Timebase_Add_Ms(uint32_t ms);
 void delay_us_no_irq(uint32_t us);
 void delay_ms_no_irq(uint32_t ms);
 
@@ -1,6 +1,7 @@
 #include "dht11.h"
 #include "sys.h"
 #include "delay.h"
+#include "dwt.h"
 
 void DHT11_Init(void)
 {
@@ -43,18 +44,35 @@ void DHT11_Mode_IPU(void)
 	GPIO_Init(GPIOG, &GPIO_InitStruct);
 }
 
-// 读 8 位数据
-uint8_t Read_Byte(void)
+// 等待数据线变成 level，超时返回1
+static uint8_t DHT11_Wait(uint8_t level, uint32_t timeout_us)
+{
+	uint32_t start = DWT_Cycles();
+	uint32_t limit = timeout_us * dwt_cycles_per_us;
+
+	while (PGin(9) != level)
+	{
+		if (DWT_Elapsed(start) > limit)
+			return 1;
+	}
+	return 0;
+}
+
+// 读 8 位数据，超时返回-1
+// 用DWT测每一位高电平的宽度：数据0约26~28us，数据1约70us
+static int Read_Byte(uint8_t *byte)
 {
 	uint8_t temp = 0;
+	uint32_t start;
 	for (int i = 0; i < 8; i++)	// 高位先发,i=0高位的数据，i=7低位的数据
 	{
-		while(PGin(9) == 0);	// 等高电平
-		
-		delay_us_no_irq(40);	// 延时40us
-		if (PGin(9) == 1)		// 数据1
+		if (DHT11_Wait(1, 100))	// 等高电平
+			return -1;
+		start = DWT_Cycles();
+		if (DHT11_Wait(0, 100))	// 等变成低电平
+			return -1;
+		if (DWT_Elapsed(start) > 40 * dwt_cycles_per_us)	// 数据1
 		{
-			while(PGin(9) == 1);// 等变成低电平
 			temp |= (1 << (7 - i));
 		}
 		else					// 数据0
@@ -62,58 +80,42 @@ uint8_t Read_Byte(void)
 			//temp默认的所有位为 0，不用处理接收的0数据
 		}
 	}
-	return temp;
+	*byte = temp;
+	return 0;
 }
 
 
 // 返回值：失败-1，成功0
 int Read_DHT11(DHT11_Data_TypeDef* data)
 {
-	uint32_t count = 0;
 	//3.控制芯片引脚发出开始信号（输出模式）
 	DHT11_Mode_Out_PP();	
 	PGout(9) = 0;
 	delay_ms(20);	// 低电平至少18ms
 	PGout(9) = 1;
-	delay_us_no_irq(30);	// 拉高30us
+	delay_us(30);	// 拉高30us
 	
 	//4.判断DHT11响应信号对不对（输入模式）
 	DHT11_Mode_IPU();
-//	while(PGin(9) == 1);		// 等dht11控制低电平
-//	
-	while(PGin(9) == 0)	// 统计低电平的时间
+	// 响应信号：低电平约80us，再高电平约80us，1ms内没有变化就是读失败了
+	if (DHT11_Wait(1, 1000) || DHT11_Wait(0, 1000))
 	{
-		count++;
-		if (count > 100)	// 1ms一直是低电平读失败了
-		{
-			DHT11_Mode_Out_PP();	
-			PGout(9) = 1;
-			return -1;
-		}	
-		delay_us_no_irq(10);
-	}
-	
-	count = 0;
-	while(PGin(9) == 1)	// 统计高电平的时间
-	{
-		count++;
-		if (count > 100)	// 1ms一直是高电平读失败了
-		{
-			DHT11_Mode_Out_PP();	
-			PGout(9) = 1;
-			return -1;
-		}	
-		delay_us_no_irq(10);
+		DHT11_Mode_Out_PP();	
+		PGout(9) = 1;
+		return -1;
 	}
 	
 	//5.读40bit数据
 	//    1）怎么判断数据是0？怎么判断数据是1？
 	//    2）高位先发，你要处理接收到的0和1。
-	data->humi_int = Read_Byte();
-	data->humi_deci = Read_Byte();
-	data->temp_int = Read_Byte();
-	data->temp_deci = Read_Byte();
-	data->check_sum = Read_Byte();
+	if (Read_Byte(&data->humi_int) || Read_Byte(&data->humi_deci) ||
+		Read_Byte(&data->temp_int) || Read_Byte(&data->temp_deci) ||
+		Read_Byte(&data->check_sum))
+	{
+		DHT11_Mode_Out_PP();	
+		PGout(9) = 1;
+		return -1;
+	}
 	
 	DHT11_Mode_Out_PP();	
 	PGout(9) = 1;
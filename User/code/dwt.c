@@ -0,0 +1,16 @@
+/**
+ * @file dwt.c
+ * @brief DWT 周期计数器实现
+ */
+
+#include "dwt.h"
+
+uint32_t dwt_cycles_per_us = 168;
+
+void DWT_Init(void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    dwt_cycles_per_us = SystemCoreClock / 1000000;
+}
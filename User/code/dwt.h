@@ -0,0 +1,59 @@
+/**
+ * @file dwt.h
+ * @brief DWT 周期计数器：周期级延时和时间戳
+ * @details CYCCNT 每个内核时钟加1(168MHz 下约25.5秒回绕一次)，
+ *          读取只是一次寄存器访问，不关中断、不影响 get_systick() 时基。
+ *          短延时和短间隔测量都用它，长时间计时用 get_systick()/micros()(见 delay.h)。
+ */
+
+#ifndef __DWT_H
+#define __DWT_H
+
+#include "stm32f4xx.h"
+
+/**
+ * @brief 每微秒的周期数，由 DWT_Init() 按 SystemCoreClock 计算
+ */
+extern uint32_t dwt_cycles_per_us;
+
+/**
+ * @brief 打开跟踪单元并启动周期计数器
+ * @note SysTick_Init() 中已调用，一般不需要单独调用
+ */
+void DWT_Init(void);
+
+/**
+ * @brief 当前周期计数
+ */
+static inline uint32_t DWT_Cycles(void)
+{
+    return DWT->CYCCNT;
+}
+
+/**
+ * @brief 从 start 到现在经过的周期数(自动处理回绕，间隔需小于一次回绕)
+ */
+static inline uint32_t DWT_Elapsed(uint32_t start)
+{
+    return DWT->CYCCNT - start;
+}
+
+/**
+ * @brief 周期数换算成微秒
+ */
+static inline uint32_t DWT_Cycles_To_Us(uint32_t cycles)
+{
+    return cycles / dwt_cycles_per_us;
+}
+
+/**
+ * @brief 忙等 n 个内核周期
+ */
+static inline void delay_cycles(uint32_t n)
+{
+    uint32_t start = DWT->CYCCNT;
+    while (DWT->CYCCNT - start < n)
+        ;
+}
+
+#endif
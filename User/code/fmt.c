@@ -0,0 +1,475 @@
+/**
+ * @file fmt.c
+ * @brief 整数格式化输出实现
+ */
+
+#include "fmt.h"
+#include <stddef.h>
+#include <string.h>
+
+#define FMT_LEFT    0x01    ///< '-' 左对齐
+#define FMT_ZERO    0x02    ///< '0' 用0补足宽度
+#define FMT_PLUS    0x04    ///< '+' 正数也带符号
+#define FMT_SPACE   0x08    ///< ' ' 正数前留空格
+#define FMT_ALT     0x10    ///< '#' 十六进制加0x，八进制以0开头
+#define FMT_UPPER   0x20    ///< 大写十六进制
+
+/// 32位八进制最多11位，%f 整数部分10位 + 小数点 + 9位小数
+#define FMT_NUM_MAX 21
+
+#define FMT_PREC_MAX 9
+
+typedef struct
+{
+    Fmt_Out out;
+    void *ctx;
+    int n;
+} Fmt_Sink;
+
+static const uint32_t fmt_pow10[FMT_PREC_MAX + 1] = {
+    1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000,
+};
+
+static void fmt_put(Fmt_Sink *s, char c)
+{
+    s->out(s->ctx, c);
+    s->n++;
+}
+
+static void fmt_repeat(Fmt_Sink *s, char c, int n)
+{
+    while (n-- > 0)
+        fmt_put(s, c);
+}
+
+/**
+ * @brief 按宽度输出一个字段：前缀(符号、0x) + zeros个0 + 正文
+ */
+static void fmt_field(Fmt_Sink *s, const char *prefix, const char *body, int len,
+                      int zeros, int width, uint8_t flags)
+{
+    int plen = 0;
+    int pad;
+
+    while (prefix[plen])
+        plen++;
+    pad = width - plen - zeros - len;
+
+    if (!(flags & (FMT_LEFT | FMT_ZERO)))
+        fmt_repeat(s, ' ', pad);
+    while (*prefix)
+        fmt_put(s, *prefix++);
+    if ((flags & (FMT_LEFT | FMT_ZERO)) == FMT_ZERO)
+        fmt_repeat(s, '0', pad);
+    fmt_repeat(s, '0', zeros);
+    while (len-- > 0)
+        fmt_put(s, *body++);
+    if (flags & FMT_LEFT)
+        fmt_repeat(s, ' ', pad);
+}
+
+// 从 end 往前写数字，返回位数；v 为0时写一个0
+static int fmt_utoa(char *end, uint32_t v, uint8_t base, uint8_t upper)
+{
+    const char *digits = upper ? "0123456789ABCDEF" : "0123456789abcdef";
+    int n = 0;
+
+    do
+    {
+        *--end = digits[v % base];
+        v /= base;
+        n++;
+    } while (v);
+    return n;
+}
+
+static const char *fmt_sign(uint8_t neg, uint8_t flags)
+{
+    if (neg)
+        return "-";
+    if (flags & FMT_PLUS)
+        return "+";
+    if (flags & FMT_SPACE)
+        return " ";
+    return "";
+}
+
+static void fmt_integer(Fmt_Sink *s, uint32_t v, uint8_t neg, uint8_t base,
+                        int width, int prec, uint8_t flags)
+{
+    char buf[FMT_NUM_MAX];
+    char *end = buf + sizeof(buf);
+    const char *prefix = "";
+    int len = fmt_utoa(end, v, base, flags & FMT_UPPER);
+    int zeros = 0;
+
+    if (base == 10)
+        prefix = fmt_sign(neg, flags);
+    else if ((flags & FMT_ALT) && base == 16 && v)
+        prefix = (flags & FMT_UPPER) ? "0X" : "0x";
+
+    if (prec >= 0)
+    {
+        // 指定了精度：至少这么多位，'0' 标志不起作用；精度0的0不输出
+        flags &= ~FMT_ZERO;
+        if (prec == 0 && v == 0)
+            len = 0;
+        if (prec > len)
+            zeros = prec - len;
+    }
+    if ((flags & FMT_ALT) && base == 8 && zeros == 0 && (len == 0 || end[-len] != '0'))
+        zeros = 1;
+    fmt_field(s, prefix, end - len, len, zeros, width, flags);
+}
+
+// f*p/2^shift 的整数部分，余数和一半比较的结果放在 *half(-1 小于，0 等于，1 大于)
+// f < 2^shift，p < 2^30，21 <= shift <= 85：乘积最多83位，按 t:w0 两段(高64位、低32位)计算，只用整数运算
+static uint32_t fmt_scale(uint64_t f, uint32_t p, int shift, int *half)
+{
+    uint64_t a = (uint64_t)(uint32_t)f * p;
+    uint64_t t = (a >> 32) + (f >> 32) * p;
+    uint32_t w0 = (uint32_t)a;
+    uint32_t q;
+
+    if (shift >= 32)
+    {
+        int sh = shift - 32;
+        uint64_t rem = t & (((uint64_t)1 << sh) - 1);
+
+        q = (uint32_t)(t >> sh);
+        if (sh == 0)
+            *half = w0 > 0x80000000u ? 1 : w0 == 0x80000000u ? 0 : -1;
+        else if (rem != (uint64_t)1 << (sh - 1))
+            *half = rem > (uint64_t)1 << (sh - 1) ? 1 : -1;
+        else
+            *half = w0 ? 1 : 0;
+    }
+    else
+    {
+        uint32_t rem = w0 & ((1u << shift) - 1);
+
+        q = (uint32_t)(t << (32 - shift)) | (w0 >> shift);
+        *half = rem > 1u << (shift - 1) ? 1 : rem == 1u << (shift - 1) ? 0 : -1;
+    }
+    return q;
+}
+
+static void fmt_ovf(Fmt_Sink *s, uint8_t neg, int width, uint8_t flags)
+{
+    fmt_field(s, fmt_sign(neg, flags), "ovf", 3, 0, width, flags & ~FMT_ZERO);
+}
+
+// 定点输出：从 IEEE-754 双精度的位拆出尾数和指数，整数部分直接移位，
+// 小数部分乘 10^prec 后按精确的余数四舍五入，不用浮点运算(M4F 的 FPU 只有单精度，double 运算要链接软件库)
+static void fmt_fixed(Fmt_Sink *s, double d, int width, int prec, uint8_t flags)
+{
+    char buf[FMT_NUM_MAX];
+    char *end = buf + sizeof(buf);
+    uint64_t bits, m, f;
+    uint8_t neg;
+    uint32_t ip = 0, frac = 0;
+    int e, shift, half = -1;
+    int len;
+
+    memcpy(&bits, &d, sizeof(bits));
+    neg = (uint8_t)(bits >> 63);
+    e = (int)(bits >> 52) & 0x7FF;
+    m = bits & (((uint64_t)1 << 52) - 1);
+
+    if (e == 0x7FF && m)
+    {
+        fmt_field(s, "", "nan", 3, 0, width, flags & ~FMT_ZERO);
+        return;
+    }
+    if (prec < 0)
+        prec = 6;
+    if (prec > FMT_PREC_MAX)
+        prec = FMT_PREC_MAX;
+
+    // 值 = m * 2^-shift
+    if (e)
+        m |= (uint64_t)1 << 52;
+    else
+        e = 1;      // 非规格化数
+    shift = 1075 - e;
+
+    if (shift < 21)
+    {
+        fmt_ovf(s, neg, width, flags);      // 不小于 2^32(包括无穷大)
+        return;
+    }
+    if (shift > 85)
+    {
+        // 小于 2^-32，比最小的一位(10^-9)的一半还小，输出0
+        f = 0;
+    }
+    else if (shift >= 64)
+    {
+        f = m;
+    }
+    else
+    {
+        ip = (uint32_t)(m >> shift);
+        f = m & (((uint64_t)1 << shift) - 1);
+    }
+    if (f)
+        frac = fmt_scale(f, fmt_pow10[prec], shift, &half);
+    // 正好一半时舍入到偶数，和库里的 printf 一致
+    if (half > 0 || (half == 0 && ((prec > 0 ? frac : ip) & 1)))
+        frac++;
+    if (frac >= fmt_pow10[prec])
+    {
+        frac -= fmt_pow10[prec];
+        if (++ip == 0)
+        {
+            fmt_ovf(s, neg, width, flags);  // 舍入后到了 2^32
+            return;
+        }
+    }
+
+    len = 0;
+    if (prec > 0)
+    {
+        int n = fmt_utoa(end, frac, 10, 0);
+        while (n < prec)
+            end[-++n] = '0';
+        len = n;
+    }
+    if (prec > 0 || (flags & FMT_ALT))
+        end[-++len] = '.';
+    len += fmt_utoa(end - len, ip, 10, 0);
+
+    // -0.00 这样舍入成0的负数照常带负号，和库里的 printf 一致
+    fmt_field(s, fmt_sign(neg, flags), end - len, len, 0, width, flags);
+}
+
+int Fmt_Format(Fmt_Out out, void *ctx, const char *fmt, va_list ap)
+{
+    Fmt_Sink s;
+
+    s.out = out;
+    s.ctx = ctx;
+    s.n = 0;
+
+    while (*fmt)
+    {
+        uint8_t flags = 0;
+        int width = 0;
+        int prec = -1;
+        char len = 0;       // 'H' = hh, 'h', 'l', 'L' = ll, 'z'
+        char c;
+
+        if (*fmt != '%')
+        {
+            fmt_put(&s, *fmt++);
+            continue;
+        }
+        fmt++;
+
+        for (;; fmt++)
+        {
+            if (*fmt == '-')
+                flags |= FMT_LEFT;
+            else if (*fmt == '0')
+                flags |= FMT_ZERO;
+            else if (*fmt == '+')
+                flags |= FMT_PLUS;
+            else if (*fmt == ' ')
+                flags |= FMT_SPACE;
+            else if (*fmt == '#')
+                flags |= FMT_ALT;
+            else
+                break;
+        }
+
+        if (*fmt == '*')
+        {
+            width = va_arg(ap, int);
+            if (width < 0)
+            {
+                flags |= FMT_LEFT;
+                width = -width;
+            }
+            fmt++;
+        }
+        else
+        {
+            while (*fmt >= '0' && *fmt <= '9')
+                width = width * 10 + (*fmt++ - '0');
+        }
+
+        if (*fmt == '.')
+        {
+            fmt++;
+            prec = 0;
+            if (*fmt == '*')
+            {
+                prec = va_arg(ap, int);
+                fmt++;
+            }
+            else
+            {
+                while (*fmt >= '0' && *fmt <= '9')
+                    prec = prec * 10 + (*fmt++ - '0');
+            }
+        }
+
+        if (*fmt == 'h')
+        {
+            len = 'h';
+            if (*++fmt == 'h')
+            {
+                len = 'H';
+                fmt++;
+            }
+        }
+        else if (*fmt == 'l')
+        {
+            len = 'l';
+            if (*++fmt == 'l')
+            {
+                len = 'L';
+                fmt++;
+            }
+        }
+        else if (*fmt == 'z' || *fmt == 't' || *fmt == 'j')
+        {
+            len = *fmt == 'j' ? 'L' : 'z';
+            fmt++;
+        }
+
+        c = *fmt;
+        if (c == '\0')
+            break;
+        fmt++;
+
+        switch (c)
+        {
+        case 'd':
+        case 'i':
+        {
+            int32_t v;
+
+            if (len == 'L')
+                v = (int32_t)va_arg(ap, long long);
+            else if (len == 'l')
+                v = (int32_t)va_arg(ap, long);
+            else if (len == 'z')
+                v = (int32_t)va_arg(ap, ptrdiff_t);
+            else
+                v = va_arg(ap, int);
+            if (len == 'h')
+                v = (int16_t)v;
+            else if (len == 'H')
+                v = (int8_t)v;
+            fmt_integer(&s, v < 0 ? 0u - (uint32_t)v : (uint32_t)v, v < 0, 10, width, prec, flags);
+            break;
+        }
+
+        case 'u':
+        case 'x':
+        case 'X':
+        case 'o':
+        {
+            uint32_t v;
+
+            if (len == 'L')
+                v = (uint32_t)va_arg(ap, unsigned long long);
+            else if (len == 'l')
+                v = (uint32_t)va_arg(ap, unsigned long);
+            else if (len == 'z')
+                v = (uint32_t)va_arg(ap, size_t);
+            else
+                v = va_arg(ap, unsigned int);
+            if (len == 'h')
+                v = (uint16_t)v;
+            else if (len == 'H')
+                v = (uint8_t)v;
+            if (c == 'X')
+                flags |= FMT_UPPER;
+            fmt_integer(&s, v, 0, c == 'u' ? 10 : c == 'o' ? 8 : 16, width, prec, flags);
+            break;
+        }
+
+        case 'p':
+            fmt_integer(&s, (uint32_t)(uintptr_t)va_arg(ap, void *), 0, 16, width, prec, flags | FMT_ALT);
+            break;
+
+        case 'c':
+        {
+            char ch = (char)va_arg(ap, int);
+            fmt_field(&s, "", &ch, 1, 0, width, flags & ~FMT_ZERO);
+            break;
+        }
+
+        case 's':
+        {
+            const char *str = va_arg(ap, const char *);
+            int n = 0;
+
+            if (!str)
+                str = "(null)";
+            while (str[n] && (prec < 0 || n < prec))
+                n++;
+            fmt_field(&s, "", str, n, 0, width, flags & ~FMT_ZERO);
+            break;
+        }
+
+        case 'f':
+        case 'F':
+            fmt_fixed(&s, va_arg(ap, double), width, prec, flags);
+            break;
+
+        case '%':
+            fmt_put(&s, '%');
+            break;
+
+        default:
+            // 不支持的转换原样输出，方便发现
+            fmt_put(&s, '%');
+            fmt_put(&s, c);
+            break;
+        }
+    }
+    return s.n;
+}
+
+typedef struct
+{
+    char *buf;
+    uint16_t size;
+    uint16_t pos;
+} Fmt_Buf;
+
+static void fmt_buf_out(void *ctx, char c)
+{
+    Fmt_Buf *b = (Fmt_Buf *)ctx;
+
+    if (b->pos + 1 < b->size)
+        b->buf[b->pos++] = c;
+}
+
+int Fmt_Vsnprintf(char *buf, uint16_t size, const char *fmt, va_list ap)
+{
+    Fmt_Buf b;
+    int n;
+
+    b.buf = buf;
+    b.size = size;
+    b.pos = 0;
+    n = Fmt_Format(fmt_buf_out, &b, fmt, ap);
+    if (size)
+        buf[b.pos] = '\0';
+    return n;
+}
+
+int Fmt_Snprintf(char *buf, uint16_t size, const char *fmt, ...)
+{
+    va_list ap;
+    int n;
+
+    va_start(ap, fmt);
+    n = Fmt_Vsnprintf(buf, size, fmt, ap);
+    va_end(ap);
+    return n;
+}
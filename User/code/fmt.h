@@ -0,0 +1,45 @@
+/**
+ * @file fmt.h
+ * @brief 不分配内存、只用整数运算的格式化输出
+ * @details 代替库里的 vsnprintf：转换好的字符逐个交给输出函数，可以直接写进调用者的缓冲区、
+ *          串口的行缓冲，或者直接画到 OLED 上，不需要中间字符串。
+ *          没有静态变量，可重入；只用到项目里出现过的转换，链接进来的代码比库里支持浮点的格式化小得多。
+ *
+ *          支持：
+ *          - 转换：%d %i %u %x %X %o %c %s %p %% 和定点的 %f
+ *          - 标志：- 0 + 空格 #，宽度和精度(都可以是 *)
+ *          - 长度：hh h l z(l/z 和 int 一样按32位输出)
+ *
+ *          限制：%f 从 double 的位拆出尾数和指数，只用整数运算(不链接软件双精度库)，精度最多9位(默认6位)，
+ *          |值| 舍入后不小于 2^32 时输出 "ovf"；
+ *          不支持 %e %g %a %n；ll 参数按64位取出但只输出低32位。
+ */
+
+#ifndef __FMT_H
+#define __FMT_H
+
+#include <stdint.h>
+#include <stdarg.h>
+
+/**
+ * @brief 输出一个字符
+ * @param ctx 调用 Fmt_Format() 时传入的上下文
+ */
+typedef void (*Fmt_Out)(void *ctx, char c);
+
+/**
+ * @brief 按格式输出
+ * @param out 输出函数
+ * @param ctx 原样传给 out
+ * @return 输出的字符数
+ */
+int Fmt_Format(Fmt_Out out, void *ctx, const char *fmt, va_list ap);
+
+/**
+ * @brief 格式化到缓冲区，总是以 '\0' 结尾(size 为0时不写)
+ * @return 完整输出需要的字符数(不含 '\0')，大于等于 size 说明被截断
+ */
+int Fmt_Vsnprintf(char *buf, uint16_t size, const char *fmt, va_list ap);
+int Fmt_Snprintf(char *buf, uint16_t size, const char *fmt, ...);
+
+#endif
@@ -0,0 +1,415 @@
+#include "hard_i2c.h"
+#include "delay.h"
+
+// PB8->SCL, PB9->SDA, 复用功能 AF4 (I2C1)
+// I2C1_TX 使用 DMA1 Stream6 Channel1
+// 异步写流程: START -> SB中断发地址 -> ADDR中断发寄存器字节并打开DMA
+//             -> DMA TC中断重新打开事件中断 -> BTF中断发STOP并回调
+
+#define HI2C_IDLE   0   // 空闲
+#define HI2C_POLL   1   // 被阻塞读操作占用
+#define HI2C_DMA    2   // 异步DMA写进行中
+
+static volatile uint8_t hi2c_state = HI2C_IDLE;
+static volatile uint8_t hi2c_error = 0;
+static uint8_t hi2c_dev;
+static uint8_t hi2c_reg;
+static uint16_t hi2c_len;
+static Hard_I2C_Callback hi2c_cb;
+static volatile uint8_t hi2c_waiters = 0;		// 正在等总线的阻塞调用个数
+static Hard_I2C_Callback hi2c_parked;			// 为阻塞调用让出总线的异步回调链，等待者用完后接着执行
+
+// 原子地占用总线，可在中断里调用(保存/恢复PRIMASK)
+static uint8_t Hard_I2C_Try_Lock(uint8_t state)
+{
+	uint8_t ok = 0;
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+	if (hi2c_state == HI2C_IDLE)
+	{
+		hi2c_state = state;
+		ok = 1;
+	}
+	__set_PRIMASK(primask);
+	return ok;
+}
+
+// 等待某个I2C事件，超时返回1
+static uint8_t Hard_I2C_Wait_Event(uint32_t event)
+{
+	uint32_t timeout = HARD_I2C_TIMEOUT;
+	while (I2C_CheckEvent(I2C1, event) != SUCCESS)
+	{
+		if (--timeout == 0)
+			return 1;
+	}
+	return 0;
+}
+
+// 软件复位I2C1并重新配置，上电时和传输卡死后调用
+static void Hard_I2C_Config(void)
+{
+	I2C_InitTypeDef I2C_InitStruct;
+
+	I2C_SoftwareResetCmd(I2C1, ENABLE);
+	I2C_SoftwareResetCmd(I2C1, DISABLE);
+
+	I2C_InitStruct.I2C_Mode = I2C_Mode_I2C;
+	I2C_InitStruct.I2C_DutyCycle = I2C_DutyCycle_2;
+	I2C_InitStruct.I2C_OwnAddress1 = 0x00;
+	I2C_InitStruct.I2C_Ack = I2C_Ack_Enable;
+	I2C_InitStruct.I2C_AcknowledgedAddress = I2C_AcknowledgedAddress_7bit;
+	I2C_InitStruct.I2C_ClockSpeed = HARD_I2C_SPEED;
+	I2C_Init(I2C1, &I2C_InitStruct);
+	I2C_Cmd(I2C1, ENABLE);
+}
+
+// 引脚、I2C1和DMA初始化
+void Hard_I2C_Init(void)
+{
+	static uint8_t inited = 0;	// OLED 和 MPU6050 都会调用
+	GPIO_InitTypeDef GPIO_InitStruct;
+	DMA_InitTypeDef DMA_InitStruct;
+	NVIC_InitTypeDef NVIC_InitStruct;
+
+	if (inited)
+		return;
+	inited = 1;
+
+	RCC_AHB1PeriphClockCmd(RCC_AHB1Periph_GPIOB | RCC_AHB1Periph_DMA1, ENABLE);
+	RCC_APB1PeriphClockCmd(RCC_APB1Periph_I2C1, ENABLE);
+
+	GPIO_InitStruct.GPIO_Pin = GPIO_Pin_8 | GPIO_Pin_9;
+	GPIO_InitStruct.GPIO_Mode = GPIO_Mode_AF;
+	GPIO_InitStruct.GPIO_Speed = GPIO_High_Speed;
+	GPIO_InitStruct.GPIO_OType = GPIO_OType_OD;		// 开漏输出
+	GPIO_InitStruct.GPIO_PuPd = GPIO_PuPd_UP;
+	GPIO_Init(GPIOB, &GPIO_InitStruct);
+	GPIO_PinAFConfig(GPIOB, GPIO_PinSource8, GPIO_AF_I2C1);
+	GPIO_PinAFConfig(GPIOB, GPIO_PinSource9, GPIO_AF_I2C1);
+
+	// 软件复位一次，防止上电时总线残留BUSY
+	Hard_I2C_Config();
+
+	DMA_StructInit(&DMA_InitStruct);
+	DMA_InitStruct.DMA_Channel = DMA_Channel_1;
+	DMA_InitStruct.DMA_PeripheralBaseAddr = (uint32_t)&I2C1->DR;
+	DMA_InitStruct.DMA_Memory0BaseAddr = 0;
+	DMA_InitStruct.DMA_DIR = DMA_DIR_MemoryToPeripheral;
+	DMA_InitStruct.DMA_BufferSize = 0;
+	DMA_InitStruct.DMA_PeripheralInc = DMA_PeripheralInc_Disable;
+	DMA_InitStruct.DMA_MemoryInc = DMA_MemoryInc_Enable;
+	DMA_InitStruct.DMA_PeripheralDataSize = DMA_PeripheralDataSize_Byte;
+	DMA_InitStruct.DMA_MemoryDataSize = DMA_MemoryDataSize_Byte;
+	DMA_InitStruct.DMA_Mode = DMA_Mode_Normal;
+	DMA_InitStruct.DMA_Priority = DMA_Priority_Medium;
+	DMA_InitStruct.DMA_FIFOMode = DMA_FIFOMode_Disable;
+	DMA_Init(DMA1_Stream6, &DMA_InitStruct);
+	DMA_ITConfig(DMA1_Stream6, DMA_IT_TC, ENABLE);
+
+	NVIC_InitStruct.NVIC_IRQChannel = I2C1_EV_IRQn;
+	NVIC_InitStruct.NVIC_IRQChannelPreemptionPriority = 2;
+	NVIC_InitStruct.NVIC_IRQChannelSubPriority = 2;
+	NVIC_InitStruct.NVIC_IRQChannelCmd = ENABLE;
+	NVIC_Init(&NVIC_InitStruct);
+
+	NVIC_InitStruct.NVIC_IRQChannel = I2C1_ER_IRQn;
+	NVIC_Init(&NVIC_InitStruct);
+
+	NVIC_InitStruct.NVIC_IRQChannel = DMA1_Stream6_IRQn;
+	NVIC_InitStruct.NVIC_IRQChannelSubPriority = 3;
+	NVIC_Init(&NVIC_InitStruct);
+}
+
+uint8_t Hard_I2C_Is_Busy(void)
+{
+	return hi2c_state != HI2C_IDLE;
+}
+
+// 最近一次异步传输是否出错(NACK/总线错误)
+uint8_t Hard_I2C_Get_Error(void)
+{
+	return hi2c_error;
+}
+
+// 结束异步传输：发STOP，释放总线，回调
+static void Hard_I2C_Finish(void)
+{
+	uint32_t timeout = HARD_I2C_TIMEOUT;
+	Hard_I2C_Callback cb = hi2c_cb;
+
+	I2C_ITConfig(I2C1, I2C_IT_EVT | I2C_IT_ERR, DISABLE);
+	I2C_GenerateSTOP(I2C1, ENABLE);
+	while ((I2C1->CR1 & I2C_CR1_STOP) && --timeout)	// STOP发完才能接着发下一个START
+		;
+	hi2c_state = HI2C_IDLE;
+	if (cb)
+		cb();
+}
+
+// 异步传输超时没有结束(总线卡死、中断丢失)：停掉DMA，复位I2C1，按出错结束并回调
+static void Hard_I2C_Abort(void)
+{
+	Hard_I2C_Callback cb = 0;
+	uint32_t primask = __get_PRIMASK();
+
+	__disable_irq();
+	if (hi2c_state == HI2C_DMA)		// 关中断后再确认一次，传输可能刚好结束
+	{
+		DMA_Cmd(DMA1_Stream6, DISABLE);
+		I2C_DMACmd(I2C1, DISABLE);
+		I2C_ITConfig(I2C1, I2C_IT_EVT | I2C_IT_ERR, DISABLE);
+		I2C_GenerateSTOP(I2C1, ENABLE);
+		Hard_I2C_Config();
+		hi2c_error = 1;
+		hi2c_state = HI2C_IDLE;
+		cb = hi2c_cb;
+	}
+	__set_PRIMASK(primask);
+	if (cb)
+		cb();
+}
+
+// 阻塞调用开始等总线，异步回调链看到后会在传输之间让出总线(Hard_I2C_Yield)
+static void Hard_I2C_Wait_Begin(void)
+{
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+	hi2c_waiters++;
+	__set_PRIMASK(primask);
+}
+
+// 阻塞调用用完总线，最后一个等待者负责接着执行让出总线的回调链
+static void Hard_I2C_Wait_End(void)
+{
+	Hard_I2C_Callback resume = 0;
+	uint32_t primask = __get_PRIMASK();
+
+	__disable_irq();
+	if (--hi2c_waiters == 0)
+	{
+		resume = hi2c_parked;
+		hi2c_parked = 0;
+	}
+	__set_PRIMASK(primask);
+	if (resume)
+		resume();
+}
+
+// 等待获得总线，超过 HARD_I2C_TIMEOUT_MS 时中止卡住的异步传输再试一次
+static uint8_t Hard_I2C_Lock_Wait(uint8_t state)
+{
+	uint32_t start = get_systick();
+
+	while (!Hard_I2C_Try_Lock(state))
+	{
+		if (get_systick() - start > HARD_I2C_TIMEOUT_MS)
+		{
+			Hard_I2C_Abort();
+			return !Hard_I2C_Try_Lock(state);
+		}
+	}
+	return 0;
+}
+
+// 在异步完成回调里调用：有阻塞调用在等总线时记下 resume 并返回1，
+// 回调链应就此返回；等待者用完总线后在它的上下文里调用 resume
+uint8_t Hard_I2C_Yield(Hard_I2C_Callback resume)
+{
+	uint8_t yield = 0;
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+	if (hi2c_waiters)
+	{
+		hi2c_parked = resume;
+		yield = 1;
+	}
+	__set_PRIMASK(primask);
+	return yield;
+}
+
+// 启动DMA写，调用前已占用总线
+static void Hard_I2C_Start_DMA(uint8_t dev_addr, uint8_t reg_addr, uint16_t len, const uint8_t *data, Hard_I2C_Callback cb)
+{
+	hi2c_dev = dev_addr;
+	hi2c_reg = reg_addr;
+	hi2c_len = len;
+	hi2c_cb = cb;
+	hi2c_error = 0;
+
+	if (len)
+	{
+		DMA_ClearFlag(DMA1_Stream6, DMA_FLAG_TCIF6 | DMA_FLAG_HTIF6 | DMA_FLAG_TEIF6 | DMA_FLAG_DMEIF6 | DMA_FLAG_FEIF6);
+		DMA_MemoryTargetConfig(DMA1_Stream6, (uint32_t)data, DMA_Memory_0);
+		DMA_SetCurrDataCounter(DMA1_Stream6, len);
+	}
+
+	I2C_ITConfig(I2C1, I2C_IT_EVT | I2C_IT_ERR, ENABLE);
+	I2C_GenerateSTART(I2C1, ENABLE);
+}
+
+uint8_t Hard_I2C_Write_Bytes_DMA(uint8_t dev_addr, uint8_t reg_addr, uint16_t len, const uint8_t *data, Hard_I2C_Callback cb)
+{
+	if (!Hard_I2C_Try_Lock(HI2C_DMA))
+		return 1;
+
+	Hard_I2C_Start_DMA(dev_addr, reg_addr, len, data, cb);
+	return 0;
+}
+
+// 阻塞写：借用DMA通道，等待传输结束，超过 HARD_I2C_TIMEOUT_MS 中止并返回失败
+uint8_t Hard_I2C_Write_Bytes(uint8_t dev_addr, uint8_t reg_addr, uint32_t len, uint8_t *data)
+{
+	uint32_t start;
+	uint8_t res = 1;
+
+	Hard_I2C_Wait_Begin();
+	if (Hard_I2C_Lock_Wait(HI2C_DMA) == 0)
+	{
+		Hard_I2C_Start_DMA(dev_addr, reg_addr, len, data, 0);
+		start = get_systick();
+		while (hi2c_state == HI2C_DMA)
+		{
+			if (get_systick() - start > HARD_I2C_TIMEOUT_MS)
+			{
+				Hard_I2C_Abort();
+				break;
+			}
+		}
+		res = hi2c_error;
+	}
+	Hard_I2C_Wait_End();
+	return res;
+}
+
+uint8_t Hard_I2C_Write_Byte(uint8_t dev_addr, uint8_t reg_addr, uint8_t data)
+{
+	return Hard_I2C_Write_Bytes(dev_addr, reg_addr, 1, &data);
+}
+
+// 轮询方式读，调用前已占用总线
+static uint8_t Hard_I2C_Poll_Read(uint8_t dev_addr, uint8_t reg_addr, uint32_t len, uint8_t *data)
+{
+	uint32_t timeout = HARD_I2C_TIMEOUT;
+
+	while (I2C_GetFlagStatus(I2C1, I2C_FLAG_BUSY))
+	{
+		if (--timeout == 0)
+			return 1;
+	}
+
+	I2C_AcknowledgeConfig(I2C1, ENABLE);
+
+	I2C_GenerateSTART(I2C1, ENABLE);
+	if (Hard_I2C_Wait_Event(I2C_EVENT_MASTER_MODE_SELECT))
+		return 1;
+	I2C_Send7bitAddress(I2C1, dev_addr << 1, I2C_Direction_Transmitter);	// 发送从机地址（写）
+	if (Hard_I2C_Wait_Event(I2C_EVENT_MASTER_TRANSMITTER_MODE_SELECTED))
+		return 1;
+	I2C_SendData(I2C1, reg_addr);	// 发送寄存器地址
+	if (Hard_I2C_Wait_Event(I2C_EVENT_MASTER_BYTE_TRANSMITTED))
+		return 1;
+
+	I2C_GenerateSTART(I2C1, ENABLE);	// 重复起始
+	if (Hard_I2C_Wait_Event(I2C_EVENT_MASTER_MODE_SELECT))
+		return 1;
+	I2C_Send7bitAddress(I2C1, dev_addr << 1, I2C_Direction_Receiver);	// 发送从机地址（读）
+	if (Hard_I2C_Wait_Event(I2C_EVENT_MASTER_RECEIVER_MODE_SELECTED))
+		return 1;
+
+	while (len)
+	{
+		if (len == 1)	// 最后一个字节，回NACK并发STOP
+		{
+			I2C_AcknowledgeConfig(I2C1, DISABLE);
+			I2C_GenerateSTOP(I2C1, ENABLE);
+		}
+		if (Hard_I2C_Wait_Event(I2C_EVENT_MASTER_BYTE_RECEIVED))
+			return 1;
+		*data++ = I2C_ReceiveData(I2C1);
+		len--;
+	}
+
+	I2C_AcknowledgeConfig(I2C1, ENABLE);
+	return 0;
+}
+
+uint8_t Hard_I2C_Read_Bytes_From_Reg(uint8_t dev_addr, uint8_t reg_addr, uint32_t len, uint8_t *data)
+{
+	uint8_t res;
+
+	if (len == 0)
+		return 0;
+
+	Hard_I2C_Wait_Begin();
+	if (Hard_I2C_Lock_Wait(HI2C_POLL))	// 等待异步传输结束
+	{
+		Hard_I2C_Wait_End();
+		return 1;
+	}
+
+	res = Hard_I2C_Poll_Read(dev_addr, reg_addr, len, data);
+	if (res)
+	{
+		I2C_ClearFlag(I2C1, I2C_FLAG_AF);
+		I2C_GenerateSTOP(I2C1, ENABLE);
+		I2C_AcknowledgeConfig(I2C1, ENABLE);
+	}
+
+	hi2c_state = HI2C_IDLE;
+	Hard_I2C_Wait_End();
+	return res;
+}
+
+uint8_t Hard_I2C_Read_Byte_From_Reg(uint8_t dev_addr, uint8_t reg_addr, uint8_t *data)
+{
+	return Hard_I2C_Read_Bytes_From_Reg(dev_addr, reg_addr, 1, data);
+}
+
+void I2C1_EV_IRQHandler(void)
+{
+	uint32_t sr1 = I2C1->SR1;
+
+	if (sr1 & I2C_SR1_SB)
+	{
+		I2C_Send7bitAddress(I2C1, hi2c_dev << 1, I2C_Direction_Transmitter);
+	}
+	else if (sr1 & I2C_SR1_ADDR)
+	{
+		(void)I2C1->SR2;	// 读SR1后读SR2清ADDR
+		I2C_SendData(I2C1, hi2c_reg);
+		if (hi2c_len)
+		{
+			I2C_ITConfig(I2C1, I2C_IT_EVT, DISABLE);	// 数据阶段交给DMA
+			I2C_DMACmd(I2C1, ENABLE);
+			DMA_Cmd(DMA1_Stream6, ENABLE);
+		}
+	}
+	else if (sr1 & I2C_SR1_BTF)
+	{
+		Hard_I2C_Finish();
+	}
+}
+
+void I2C1_ER_IRQHandler(void)
+{
+	I2C_ClearFlag(I2C1, I2C_FLAG_AF | I2C_FLAG_BERR | I2C_FLAG_ARLO | I2C_FLAG_OVR);
+	hi2c_error = 1;
+	if (hi2c_state == HI2C_DMA)
+	{
+		DMA_Cmd(DMA1_Stream6, DISABLE);
+		I2C_DMACmd(I2C1, DISABLE);
+		Hard_I2C_Finish();
+	}
+}
+
+void DMA1_Stream6_IRQHandler(void)
+{
+	if (DMA_GetITStatus(DMA1_Stream6, DMA_IT_TCIF6) != RESET)
+	{
+		DMA_ClearITPendingBit(DMA1_Stream6, DMA_IT_TCIF6);
+		DMA_Cmd(DMA1_Stream6, DISABLE);
+		I2C_DMACmd(I2C1, DISABLE);
+		I2C_ITConfig(I2C1, I2C_IT_EVT, ENABLE);	// 等最后一个字节移出(BTF)后再发STOP
+	}
+}
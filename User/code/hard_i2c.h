@@ -0,0 +1,45 @@
+#ifndef HARD_I2C_H
+#define HARD_I2C_H
+
+#include "stm32f4xx.h"
+#include "sys.h"
+
+// 1: OLED/MPU6050 走硬件I2C1(PB8/PB9 AF4) + DMA1_Stream6; 0: 回退到 soft_i2c 软件模拟
+// OLED 和 MPU6050 挂在同一组引脚上，两者必须使用同一种方式
+#ifndef USE_HARD_I2C
+#define USE_HARD_I2C    1
+#endif
+
+#define HARD_I2C_SPEED      400000      // 快速模式 400kHz
+#define HARD_I2C_TIMEOUT    10000       // 轮询等待事件的超时计数
+#ifndef HARD_I2C_TIMEOUT_MS
+#define HARD_I2C_TIMEOUT_MS 10          // 阻塞调用等总线、等DMA写完的超时(ms)，超时中止传输并返回失败
+#endif
+
+// 异步传输完成回调(在中断上下文中调用)
+typedef void (*Hard_I2C_Callback)(void);
+
+void Hard_I2C_Init(void);
+uint8_t Hard_I2C_Is_Busy(void);
+uint8_t Hard_I2C_Get_Error(void);
+
+// 阻塞接口，与 soft_i2c 的同名函数参数一致，返回 0:成功, 1:失败
+uint8_t Hard_I2C_Write_Byte(uint8_t dev_addr, uint8_t reg_addr, uint8_t data);
+uint8_t Hard_I2C_Write_Bytes(uint8_t dev_addr, uint8_t reg_addr, uint32_t len, uint8_t *data);
+uint8_t Hard_I2C_Read_Byte_From_Reg(uint8_t dev_addr, uint8_t reg_addr, uint8_t *data);
+uint8_t Hard_I2C_Read_Bytes_From_Reg(uint8_t dev_addr, uint8_t reg_addr, uint32_t len, uint8_t *data);
+
+// 非阻塞DMA写：立即返回，传输结束(成功或出错)后在中断里调用 cb
+// 返回 0:已启动, 1:总线忙
+// 注意：data 在回调到来之前必须保持有效
+uint8_t Hard_I2C_Write_Bytes_DMA(uint8_t dev_addr, uint8_t reg_addr, uint16_t len, const uint8_t *data, Hard_I2C_Callback cb);
+
+// 在异步完成回调里调用：有阻塞调用在等总线时返回1，回调链应就此返回，不再发起下一次传输；
+// 阻塞调用用完总线后(在它的上下文里)调用 resume 接着执行回调链。返回0时照常继续
+uint8_t Hard_I2C_Yield(Hard_I2C_Callback resume);
+
+void I2C1_EV_IRQHandler(void);
+void I2C1_ER_IRQHandler(void);
+void DMA1_Stream6_IRQHandler(void);
+
+#endif
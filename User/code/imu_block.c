@@ -0,0 +1,247 @@
+/**
+ * @file imu_block.c
+ * @brief 按块处理 int16 加速度数组实现
+ */
+
+#include "imu_block.h"
+#include <string.h>
+
+#if IMU_BLOCK_SIMD
+#include "stm32f4xx.h"      // core_cmSimd.h
+#endif
+
+// =============================================================================
+// 逐个样本的参考实现，没有 SIMD 时也是正式实现
+// =============================================================================
+
+void Imu_Block_SumSq_Ref(const int16_t *x, const int16_t *y, const int16_t *z, uint32_t *sq, uint16_t n)
+{
+    uint16_t i;
+
+    for (i = 0; i < n; i++)
+        sq[i] = (uint32_t)((int32_t)x[i] * x[i]) + (uint32_t)((int32_t)y[i] * y[i]) +
+                (uint32_t)((int32_t)z[i] * z[i]);
+}
+
+void Imu_Block_MinMax_Ref(const int16_t *v, uint16_t n, int16_t *min, int16_t *max)
+{
+    int16_t lo = 32767, hi = -32768;
+    uint16_t i;
+
+    for (i = 0; i < n; i++)
+    {
+        if (v[i] < lo)
+            lo = v[i];
+        if (v[i] > hi)
+            hi = v[i];
+    }
+    *min = lo;
+    *max = hi;
+}
+
+// n*sum(v^2) - sum(v)^2 = n*sum((v-mean)^2)：sum 在 n<=65535 时不超过 int32，平方和用64位
+static uint64_t imu_energy(int32_t sum, uint64_t sq, uint16_t n)
+{
+    return (uint64_t)n * sq - (uint64_t)((int64_t)sum * sum);
+}
+
+uint64_t Imu_Block_Energy_Ref(const int16_t *v, uint16_t n)
+{
+    int32_t sum = 0;
+    uint64_t sq = 0;
+    uint16_t i;
+
+    for (i = 0; i < n; i++)
+    {
+        sum += v[i];
+        sq += (uint32_t)((int32_t)v[i] * v[i]);
+    }
+    return imu_energy(sum, sq, n);
+}
+
+void Imu_Fir_Init(Imu_Fir *f, const int16_t *coef, uint8_t taps)
+{
+    uint8_t t;
+
+    if (taps > IMU_FIR_MAX_TAPS)
+        taps = IMU_FIR_MAX_TAPS;
+    memset(f, 0, sizeof(*f));
+    // 倒序：coef[t] 乘 buf[i+t]，buf 里越往后越新；奇数个时最老的一端补0
+    f->taps = (taps + 1) & ~1;
+    for (t = 0; t < taps; t++)
+        f->coef[f->taps - 1 - t] = coef[t];
+}
+
+static int16_t imu_q15_sat(int64_t acc)
+{
+    acc = (acc + (1 << 14)) >> 15;
+    if (acc > 32767)
+        return 32767;
+    if (acc < -32768)
+        return -32768;
+    return (int16_t)acc;
+}
+
+// 本块接在历史输入后面；滤完把最后 taps-1 个输入移到开头
+static int16_t *imu_fir_load(Imu_Fir *f, const int16_t *in, uint16_t n)
+{
+    int16_t *b = f->buf + f->taps - 1;
+
+    memcpy(b, in, n * sizeof(int16_t));
+    return f->buf;
+}
+
+static void imu_fir_keep(Imu_Fir *f, uint16_t n)
+{
+    memmove(f->buf, f->buf + n, (f->taps - 1) * sizeof(int16_t));
+}
+
+void Imu_Fir_Process_Ref(Imu_Fir *f, const int16_t *in, int16_t *out, uint16_t n)
+{
+    const int16_t *b;
+    uint16_t i;
+    uint8_t t;
+
+    if (n > IMU_BLOCK_MAX)
+        n = IMU_BLOCK_MAX;
+    b = imu_fir_load(f, in, n);
+    for (i = 0; i < n; i++)
+    {
+        int64_t acc = 0;
+
+        for (t = 0; t < f->taps; t++)
+            acc += (int32_t)f->coef[t] * b[i + t];
+        out[i] = imu_q15_sat(acc);
+    }
+    imu_fir_keep(f, n);
+}
+
+#if IMU_BLOCK_SIMD
+
+// =============================================================================
+// 双16位 SIMD 实现：一次读两个相邻的 int16，低半字是下标小的那个
+// =============================================================================
+
+__STATIC_INLINE uint32_t imu_pair(const int16_t *p)
+{
+    uint32_t v;
+
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+void Imu_Block_SumSq(const int16_t *x, const int16_t *y, const int16_t *z, uint32_t *sq, uint16_t n)
+{
+    uint16_t i;
+
+    for (i = 0; i + 1 < n; i += 2)
+    {
+        uint32_t xx = imu_pair(x + i);
+        uint32_t yy = imu_pair(y + i);
+        uint32_t zz = imu_pair(z + i);
+        uint32_t xy0 = __PKHBT(xx, yy, 16);     // (x[i], y[i])
+        uint32_t xy1 = __PKHTB(yy, xx, 16);     // (x[i+1], y[i+1])
+        int32_t z0 = (int16_t)zz;
+        int32_t z1 = (int32_t)zz >> 16;
+
+        // 两个乘积都非负，按 uint32_t 看累加结果没有截断
+        sq[i] = __SMLAD(xy0, xy0, (uint32_t)(z0 * z0));
+        sq[i + 1] = __SMLAD(xy1, xy1, (uint32_t)(z1 * z1));
+    }
+    if (i < n)
+        Imu_Block_SumSq_Ref(x + i, y + i, z + i, sq + i, 1);
+}
+
+void Imu_Block_MinMax(const int16_t *v, uint16_t n, int16_t *min, int16_t *max)
+{
+    uint32_t lo = 0x7FFF7FFF, hi = 0x80008000;
+    int16_t lo2, hi2;
+    uint16_t i;
+
+    // __SSUB16 按半字置 GE 标志，__SEL 按 GE 逐个半字挑选
+    for (i = 0; i + 1 < n; i += 2)
+    {
+        uint32_t p = imu_pair(v + i);
+
+        __SSUB16(p, hi);
+        hi = __SEL(p, hi);
+        __SSUB16(lo, p);
+        lo = __SEL(p, lo);
+    }
+    *min = (int16_t)lo < (int16_t)(lo >> 16) ? (int16_t)lo : (int16_t)(lo >> 16);
+    *max = (int16_t)hi > (int16_t)(hi >> 16) ? (int16_t)hi : (int16_t)(hi >> 16);
+    if (i < n)
+    {
+        Imu_Block_MinMax_Ref(v + i, 1, &lo2, &hi2);
+        if (lo2 < *min)
+            *min = lo2;
+        if (hi2 > *max)
+            *max = hi2;
+    }
+}
+
+uint64_t Imu_Block_Energy(const int16_t *v, uint16_t n)
+{
+    int32_t sum = 0;
+    uint64_t sq = 0;
+    uint16_t i;
+
+    for (i = 0; i + 1 < n; i += 2)
+    {
+        uint32_t p = imu_pair(v + i);
+
+        sum = (int32_t)__SMLAD(p, 0x00010001, (uint32_t)sum);      // 两个半字乘1相加
+        sq = __SMLALD(p, p, sq);
+    }
+    if (i < n)
+    {
+        sum += v[i];
+        sq += (uint32_t)((int32_t)v[i] * v[i]);
+    }
+    return imu_energy(sum, sq, n);
+}
+
+void Imu_Fir_Process(Imu_Fir *f, const int16_t *in, int16_t *out, uint16_t n)
+{
+    const int16_t *b;
+    uint16_t i;
+    uint8_t t;
+
+    if (n > IMU_BLOCK_MAX)
+        n = IMU_BLOCK_MAX;
+    b = imu_fir_load(f, in, n);
+    for (i = 0; i < n; i++)
+    {
+        uint64_t acc = 0;
+
+        // 抽头数已补成偶数，每次两个抽头
+        for (t = 0; t < f->taps; t += 2)
+            acc = __SMLALD(imu_pair(f->coef + t), imu_pair(b + i + t), acc);
+        out[i] = imu_q15_sat((int64_t)acc);
+    }
+    imu_fir_keep(f, n);
+}
+
+#else
+
+void Imu_Block_SumSq(const int16_t *x, const int16_t *y, const int16_t *z, uint32_t *sq, uint16_t n)
+{
+    Imu_Block_SumSq_Ref(x, y, z, sq, n);
+}
+
+void Imu_Block_MinMax(const int16_t *v, uint16_t n, int16_t *min, int16_t *max)
+{
+    Imu_Block_MinMax_Ref(v, n, min, max);
+}
+
+uint64_t Imu_Block_Energy(const int16_t *v, uint16_t n)
+{
+    return Imu_Block_Energy_Ref(v, n);
+}
+
+void Imu_Fir_Process(Imu_Fir *f, const int16_t *in, int16_t *out, uint16_t n)
+{
+    Imu_Fir_Process_Ref(f, in, out, n);
+}
+
+#endif
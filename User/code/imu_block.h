@@ -0,0 +1,83 @@
+/**
+ * @file imu_block.h
+ * @brief 按块处理 int16 加速度数组：平方和、FIR 滤波、最值、能量
+ * @details FIFO 一次读出一批样本，把 x/y/z 拆成三个 int16 数组后整块处理。
+ *          Cortex-M4 上用 core_cmSimd.h 的双16位指令(__SMLAD/__SMLALD/__SSUB16/__SEL 等)
+ *          一条指令处理两个样本；没有 DSP 扩展时(主机编译)用逐个样本的C代码，结果逐位相同。
+ *          每个函数都有 _Ref 版本，总是逐个样本计算，用来对拍和测周期数
+ *          (固件串口命令 "imubench"，主机 User/OLED/simulator 的 imu_block_bench)。
+ *
+ *          数组不要求4字节对齐：成对读取用 memcpy，M4 上编译成一条非对齐 LDR。
+ *          不分配内存、没有静态变量，可重入。
+ */
+
+#ifndef __IMU_BLOCK_H
+#define __IMU_BLOCK_H
+
+#include <stdint.h>
+
+// =============================================================================
+// 配置宏
+// =============================================================================
+#ifndef IMU_BLOCK_SIMD
+#if defined(__ARM_FEATURE_DSP) || defined(__TARGET_FEATURE_DSPMUL)
+#define IMU_BLOCK_SIMD      1       ///< 1: 用双16位 SIMD 指令；0: 逐个样本的C代码
+#else
+#define IMU_BLOCK_SIMD      0
+#endif
+#endif
+
+#ifndef IMU_BLOCK_MAX
+#define IMU_BLOCK_MAX       32      ///< Imu_Fir_Process 一次最多处理的样本数，和 MPU_FIFO_BURST_MAX 一致
+#endif
+
+#define IMU_FIR_MAX_TAPS    16      ///< FIR 最多抽头数
+
+/**
+ * @brief FIR 滤波器状态，块与块之间保留最后 taps-1 个输入
+ */
+typedef struct
+{
+    int16_t coef[IMU_FIR_MAX_TAPS];                         ///< 系数(Q15)，倒序存放并补到偶数个
+    int16_t buf[IMU_FIR_MAX_TAPS - 1 + IMU_BLOCK_MAX];      ///< 历史输入 + 本块输入
+    uint8_t taps;                                           ///< 补齐后的抽头数
+} Imu_Fir;
+
+/**
+ * @brief 逐样本的平方和 sq[i] = x[i]^2 + y[i]^2 + z[i]^2
+ * @note 三个 int16 的平方和最大 3*2^30，uint32_t 放得下，没有截断
+ */
+void Imu_Block_SumSq(const int16_t *x, const int16_t *y, const int16_t *z, uint32_t *sq, uint16_t n);
+void Imu_Block_SumSq_Ref(const int16_t *x, const int16_t *y, const int16_t *z, uint32_t *sq, uint16_t n);
+
+/**
+ * @brief 最小值和最大值，n 为0时 min = 32767、max = -32768
+ */
+void Imu_Block_MinMax(const int16_t *v, uint16_t n, int16_t *min, int16_t *max);
+void Imu_Block_MinMax_Ref(const int16_t *v, uint16_t n, int16_t *min, int16_t *max);
+
+/**
+ * @brief 去掉均值后的能量 sum((v[i] - mean)^2) * n，避免除法带来的舍入
+ * @note 除以 n^2 得到方差；n 不大于65535，结果不会溢出
+ */
+uint64_t Imu_Block_Energy(const int16_t *v, uint16_t n);
+uint64_t Imu_Block_Energy_Ref(const int16_t *v, uint16_t n);
+
+/**
+ * @brief 初始化 FIR
+ * @param coef 系数(Q15)，coef[k] 乘 x[i-k]，抽头数为奇数时补一个0
+ * @param taps 抽头数，1~IMU_FIR_MAX_TAPS
+ * @note 系数绝对值之和应不超过1(32768)，否则输出会饱和
+ */
+void Imu_Fir_Init(Imu_Fir *f, const int16_t *coef, uint8_t taps);
+
+/**
+ * @brief 滤波一块
+ * @param in 输入，out 输出，可以是同一个数组
+ * @param n 样本数，不大于 IMU_BLOCK_MAX
+ * @note 64位累加，四舍五入后饱和到 int16
+ */
+void Imu_Fir_Process(Imu_Fir *f, const int16_t *in, int16_t *out, uint16_t n);
+void Imu_Fir_Process_Ref(Imu_Fir *f, const int16_t *in, int16_t *out, uint16_t n);
+
+#endif
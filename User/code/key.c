@@ -23,6 +23,7 @@ Key_State_t keys[NUM_KEYS]; // 全局变量，存储所有按键状态
 volatile uint8_t key_interrupt_flag = 0;   // 按键中断标志
 volatile uint8_t key_interrupt_value = 0;  // 按键中断值
 volatile uint8_t key_trig_flag = 0;         // 哪个按键触发了（位标志：bit0~bit3）
+void (*key_event_hook)(void) = 0;            // 按键事件回调
 
 // ==================================
 // 定时器中断消抖全局变量
@@ -646,7 +647,8 @@ void TIM5_IRQHandler(void)
             if (current_level == 0)  // 仍然是低电平 → 确认有效按下
             {
                 key_trig_flag |= (1 << key_pending_check);   // 打事件标志
-                // 也可以直接放消息队列、事件标志组等
+                if (key_event_hook)
+                    key_event_hook();
             }
             
             // 重新打开对应线的外部中断
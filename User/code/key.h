@@ -210,6 +210,13 @@ int8_t KEY_Debounce_Timer_Init(void);
 // ==================================
 
 extern volatile uint8_t key_trig_flag;        // 按键触发标志
+extern volatile uint8_t key_debounce_active;  // TIM5 正在消抖，此时不能进入STOP
+
+/**
+ * @brief 按键事件回调，消抖确认后在 TIM5 中断里调用，为NULL时不调用
+ * @note 用于唤醒等待按键的任务，不要在里面做耗时操作
+ */
+extern void (*key_event_hook)(void);
 
 // ==================================
 // 按键中断服务程序声明
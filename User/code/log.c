@@ -0,0 +1,130 @@
+/**
+ * @file log.c
+ * @brief 二进制延迟日志的记录编码
+ */
+
+#include "log.h"
+#include "proto.h"
+#include "uart_dma.h"
+#include "delay.h"
+#include "cmd.h"
+#include <string.h>
+
+// 编号、时间戳、每个参数都是 varint，各最多5字节
+#define LOG_REC_MAX     (5 + 5 + LOG_MAX_ARGS * 5)
+
+#if LOG_REC_MAX > PROTO_MAX_PAYLOAD
+#error "LOG_MAX_ARGS too large for one PROTO_LOG frame"
+#endif
+
+uint8_t Log_Levels[LOG_MOD_COUNT] = {
+    [LOG_MOD_MAIN]  = LOG_LEVEL_RUNTIME,
+    [LOG_MOD_FLASH] = LOG_LEVEL_RUNTIME,
+    [LOG_MOD_ALARM] = LOG_LEVEL_RUNTIME,
+    [LOG_MOD_STEP]  = LOG_LEVEL_RUNTIME,
+    [LOG_MOD_PEDO]  = LOG_LEVEL_RUNTIME,
+    [LOG_MOD_TEST]  = LOG_LEVEL_RUNTIME,
+};
+
+static const char *const log_mod_names[LOG_MOD_COUNT] = {
+    [LOG_MOD_MAIN]  = "main",
+    [LOG_MOD_FLASH] = "flash",
+    [LOG_MOD_ALARM] = "alarm",
+    [LOG_MOD_STEP]  = "step",
+    [LOG_MOD_PEDO]  = "pedo",
+    [LOG_MOD_TEST]  = "test",
+};
+
+static const char log_level_chars[] = "-ewid";
+
+// 编号的基准：和格式串放在同一个段里，编号是格式串相对它的偏移，解码工具从 ELF 符号表查它的地址
+const char Log_Fmt_Base[] __attribute__((section("logfmt"), used)) = "";
+
+static uint32_t log_last_us;    // 上一条发出去的记录的时间戳
+static uint8_t log_sync_left;   // 再发这么多条增量记录后发一条完整时间戳，0 表示下一条就发
+
+// 无符号 LEB128：每字节7位，最高位为1表示后面还有
+static uint8_t log_put_varint(uint8_t *p, uint32_t v)
+{
+    uint8_t n = 0;
+
+    while (v >= 0x80)
+    {
+        p[n++] = (uint8_t)(v | 0x80);
+        v >>= 7;
+    }
+    p[n++] = (uint8_t)v;
+    return n;
+}
+
+void Log_Emit(const char *fmt, const uint32_t *args, uint8_t n)
+{
+    uint8_t rec[LOG_REC_MAX];
+    uint8_t len = 0;
+    uint8_t i;
+    int32_t off = (int32_t)((uint32_t)fmt - (uint32_t)Log_Fmt_Base);
+    uint32_t now = micros();
+    uint8_t sync = log_sync_left == 0;
+
+    if (n > LOG_MAX_ARGS)
+        n = LOG_MAX_ARGS;
+
+    // 段里的先后次序由链接器决定，偏移可正可负，zigzag 后小偏移只占1~2字节；最低位标记完整时间戳
+    len += log_put_varint(&rec[len], ((((uint32_t)off << 1) ^ (uint32_t)(off >> 31)) << 1) | sync);
+    len += log_put_varint(&rec[len], sync ? now : now - log_last_us);
+    for (i = 0; i < n; i++)
+        len += log_put_varint(&rec[len], args[i]);
+
+    // 整帧进缓冲区或整帧丢弃，半条记录无法解码；丢掉的记录主机收不到，下一条要带完整时间戳
+    if (Proto_Send(PROTO_LOG, rec, len))
+    {
+        log_sync_left = 0;
+        return;
+    }
+    log_last_us = now;
+    log_sync_left = sync ? LOG_SYNC_EVERY - 1 : log_sync_left - 1;
+}
+
+// log [<模块|all> <e|w|i|d|off>]
+static void cmd_log(uint8_t argc, char *argv[])
+{
+    uint8_t i, level, all;
+    uint8_t found = 0;
+    const char *p;
+
+    if (argc < 3)
+    {
+        for (i = 0; i < LOG_MOD_COUNT; i++)
+            printf("%-6s %c\r\n", log_mod_names[i], log_level_chars[Log_Levels[i]]);
+        return;
+    }
+
+    p = strcmp(argv[2], "off") == 0 ? log_level_chars : strchr(log_level_chars + 1, argv[2][0]);
+    if (!p || (p != log_level_chars && argv[2][1] != '\0'))
+    {
+        printf("usage: log [<module|all> <e|w|i|d|off>]\r\n");
+        return;
+    }
+    level = (uint8_t)(p - log_level_chars);
+
+    all = strcmp(argv[1], "all") == 0;
+    for (i = 0; i < LOG_MOD_COUNT; i++)
+    {
+        if (all || strcmp(argv[1], log_mod_names[i]) == 0)
+        {
+            Log_Levels[i] = level;
+            found = 1;
+        }
+    }
+    if (!found)
+        printf("log: unknown module %s\r\n", argv[1]);
+}
+
+static const Cmd log_cmds[] = {
+    { "log", cmd_log, "log [<module|all> <e|w|i|d|off>] - Show/set runtime log levels" },
+};
+
+void Log_Init(void)
+{
+    Cmd_Register(log_cmds, CMD_COUNT(log_cmds));
+}
@@ -0,0 +1,161 @@
+/**
+ * @file log.h
+ * @brief 二进制延迟日志
+ * @details LOG(fmt, ...) 不在单片机上格式化：格式串放在专门的 "logfmt" 段里留在Flash中，
+ *          串口只发送一条紧凑的记录，由上位机工具 tools/log_decode.py 对照 ELF(.axf) 还原文本。
+ *
+ *          记录格式，各字段都按无符号 LEB128 变长编码(varint)，小数值只占1字节：
+ *          @code
+ *          编号 varint | 时间 varint | 参数1 varint | 参数2 varint | ...
+ *          编号 = zigzag(fmt地址 - Log_Fmt_Base) << 1 | 完整时间戳标记
+ *          时间 = 标记为1时是 micros() 本身，为0时是距上一条记录的微秒数
+ *          @endcode
+ *          格式串都在同一个段里，编号只有1~2字节；每 LOG_SYNC_EVERY 条、上电后第一条和
+ *          发送缓冲区满丢过记录之后带完整时间戳，其余只发增量。记录里会有 0x00，
+ *          所以用 Proto_Send() 装成 PROTO_LOG 帧发送(见 proto.h)，和 printf 文本、其它帧混在同一个串口上；
+ *          解码工具和 proto_host.py 都按帧分开，其余字节原样输出。
+ *
+ *          限制：参数只能是不超过32位的整数(%d %u %x %c 等)，不支持 %s、%f 和64位整数；
+ *          浮点请先换成定点整数再记录。
+ *          LOG_DEFERRED 为 0 时 LOG 直接展开成 uart_printf，输出可读文本。
+ *
+ *          分级：LOG_E/LOG_W/LOG_I/LOG_D。每个 .c 在包含本文件之前可以定义
+ *          @code
+ *          #define LOG_MODULE  LOG_MOD_FLASH       // 运行时按模块开关，默认 LOG_MOD_MAIN
+ *          #define LOG_LEVEL   LOG_LEVEL_DEBUG     // 本文件编译进去的最低级别，默认 LOG_LEVEL_DEFAULT
+ *          #include "log.h"
+ *          @endcode
+ *          低于 LOG_LEVEL 的调用展开成空语句，格式串和参数都不会编译进去(参数也不会求值)。
+ *          编译进去的还要过运行时级别 Log_Levels[模块]，用命令 "log <模块|all> <e|w|i|d|off>" 调整，
+ *          被滤掉的调用只多一次比较。正式版本在工程里定义 LOG_LEVEL_DEFAULT=LOG_LEVEL_WARN 即可。
+ *          本文件只能在 .c 里包含，不要放进头文件，否则各模块的 LOG_LEVEL 会失效。
+ */
+
+#ifndef __LOG_H
+#define __LOG_H
+
+#include "stm32f4xx.h"
+#include <stdio.h>
+
+// =============================================================================
+// 配置宏
+// =============================================================================
+#ifndef LOG_DEFERRED
+#define LOG_DEFERRED    1       ///< 1: 发送二进制记录；0: 退回 printf
+#endif
+
+#ifndef LOG_MAX_ARGS
+#define LOG_MAX_ARGS    8       ///< 每条记录最多参数个数，多余的丢弃
+#endif
+
+#ifndef LOG_SYNC_EVERY
+#define LOG_SYNC_EVERY  16      ///< 每隔多少条记录发一次完整时间戳，主机漏收记录后最多这么多条时间不准
+#endif
+
+#define LOG_LEVEL_OFF   0
+#define LOG_LEVEL_ERROR 1
+#define LOG_LEVEL_WARN  2
+#define LOG_LEVEL_INFO  3
+#define LOG_LEVEL_DEBUG 4
+
+#ifndef LOG_LEVEL_DEFAULT
+#define LOG_LEVEL_DEFAULT   LOG_LEVEL_DEBUG ///< 各模块编译进去的最低级别
+#endif
+
+#ifndef LOG_LEVEL_RUNTIME
+#define LOG_LEVEL_RUNTIME   LOG_LEVEL_INFO  ///< 上电时各模块的运行时级别，调试信息默认不输出
+#endif
+
+#ifndef LOG_LEVEL
+#define LOG_LEVEL       LOG_LEVEL_DEFAULT
+#endif
+
+#ifndef LOG_MODULE
+#define LOG_MODULE      LOG_MOD_MAIN
+#endif
+
+/**
+ * @brief 日志模块，名字见 log.c 的 log_mod_names
+ */
+typedef enum
+{
+    LOG_MOD_MAIN = 0,
+    LOG_MOD_FLASH,      ///< spi.c (W25Q128)
+    LOG_MOD_ALARM,      ///< ui/alarm_all.c
+    LOG_MOD_STEP,       ///< ui/step.c
+    LOG_MOD_PEDO,       ///< simple_pedometer.c
+    LOG_MOD_TEST,       ///< ui/testlist.c
+    LOG_MOD_COUNT
+} Log_Module;
+
+/// 各模块的运行时级别，高于它的日志不输出
+extern uint8_t Log_Levels[LOG_MOD_COUNT];
+
+/// 格式串编号的基准，放在 "logfmt" 段里
+extern const char Log_Fmt_Base[];
+
+#if LOG_DEFERRED
+
+/**
+ * @brief 记录一条日志
+ * @note 只能在主循环(线程)中调用；参数会被转换成 uint32_t
+ */
+#define LOG(fmt, ...) do {                                                      \
+    static const char _log_fmt[] __attribute__((section("logfmt"), used)) = fmt; \
+    const uint32_t _log_args[] = { 0, ##__VA_ARGS__ };                          \
+    Log_Emit(_log_fmt, &_log_args[1],                                           \
+             sizeof(_log_args) / sizeof(_log_args[0]) - 1);                     \
+} while (0)
+
+#else
+
+#include "uart_dma.h"
+
+#define LOG(fmt, ...)   uart_printf(fmt, ##__VA_ARGS__)
+
+#endif
+
+/// 运行时级别够才记录；级别字母拼进格式串，二进制记录里不多占字节
+#define LOG_AT(lvl, tag, fmt, ...) do {                                         \
+    if (Log_Levels[LOG_MODULE] >= (lvl))                                        \
+        LOG(tag fmt, ##__VA_ARGS__);                                            \
+} while (0)
+
+#if LOG_LEVEL >= LOG_LEVEL_ERROR
+#define LOG_E(fmt, ...) LOG_AT(LOG_LEVEL_ERROR, "E ", fmt, ##__VA_ARGS__)
+#else
+#define LOG_E(fmt, ...) do { } while (0)
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_WARN
+#define LOG_W(fmt, ...) LOG_AT(LOG_LEVEL_WARN, "W ", fmt, ##__VA_ARGS__)
+#else
+#define LOG_W(fmt, ...) do { } while (0)
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_INFO
+#define LOG_I(fmt, ...) LOG_AT(LOG_LEVEL_INFO, "I ", fmt, ##__VA_ARGS__)
+#else
+#define LOG_I(fmt, ...) do { } while (0)
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_DEBUG
+#define LOG_D(fmt, ...) LOG_AT(LOG_LEVEL_DEBUG, "D ", fmt, ##__VA_ARGS__)
+#else
+#define LOG_D(fmt, ...) do { } while (0)
+#endif
+
+/**
+ * @brief 登记 "log" 命令
+ */
+void Log_Init(void);
+
+/**
+ * @brief 编码并发送一条记录，由 LOG 宏调用
+ * @param fmt  格式串，必须在 "logfmt" 段里(编号是它相对 Log_Fmt_Base 的偏移)
+ * @param args 参数
+ * @param n    参数个数
+ */
+void Log_Emit(const char *fmt, const uint32_t *args, uint8_t n);
+
+#endif
@@ -4,6 +4,7 @@
 #include "stm32f4xx.h"
 #include "music.h"
 #include <stdio.h>
+#include "uart_dma.h"
 // 函数声明
 void play_example_melody(void);
 void play_timing_demo(void);
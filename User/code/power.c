@@ -0,0 +1,222 @@
+/**
+ * @file power.c
+ * @brief 空闲低功耗管理实现
+ */
+
+#include "power.h"
+#include "delay.h"
+#include "uart_dma.h"
+#include "key.h"
+#include "hard_i2c.h"
+#include "oled.h"
+#include "stm32f4xx_rtc.h"
+#include "stm32f4xx_pwr.h"
+#include "stm32f4xx_exti.h"
+#include "misc.h"
+#include <stdio.h>
+
+// RTC同步分频为 255(见 rtc_date.c)，子秒计数 256Hz
+#define POWER_RTC_SUBSEC    256
+// RTC唤醒定时器时钟 RTCCLK/16 = 2048Hz
+#define POWER_WUT_HZ        2048
+
+static uint8_t power_stop_allowed = 0;
+
+static uint32_t power_idle_us = 0;      ///< 统计窗口内WFI睡眠的时间(us)
+static uint32_t power_stop_ms = 0;      ///< 统计窗口内STOP的时间(ms)
+static uint32_t power_window_start = 0; ///< 统计窗口起点(ms)
+static uint32_t power_stop_frac = 0;    ///< RTC子秒换算成毫秒时留下的余数
+static uint32_t power_rx_count = 0;     ///< 上次看到的串口接收字节数
+static uint32_t power_rx_time = 0;      ///< 最近一次串口有接收的时间(ms)
+
+void Power_Init(void)
+{
+    EXTI_InitTypeDef EXTI_InitStructure;
+    NVIC_InitTypeDef NVIC_InitStructure;
+
+    RCC_APB1PeriphClockCmd(RCC_APB1Periph_PWR, ENABLE);
+    PWR_BackupAccessCmd(ENABLE);
+
+    // RTC唤醒中断接在EXTI线22上，STOP模式下也能唤醒
+    EXTI_ClearITPendingBit(EXTI_Line22);
+    EXTI_InitStructure.EXTI_Line = EXTI_Line22;
+    EXTI_InitStructure.EXTI_Mode = EXTI_Mode_Interrupt;
+    EXTI_InitStructure.EXTI_Trigger = EXTI_Trigger_Rising;
+    EXTI_InitStructure.EXTI_LineCmd = ENABLE;
+    EXTI_Init(&EXTI_InitStructure);
+
+    NVIC_InitStructure.NVIC_IRQChannel = RTC_WKUP_IRQn;
+    NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = 1;
+    NVIC_InitStructure.NVIC_IRQChannelSubPriority = 0;
+    NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
+    NVIC_Init(&NVIC_InitStructure);
+
+    RTC_WakeUpCmd(DISABLE);
+    RTC_WakeUpClockConfig(RTC_WakeUpClock_RTCCLK_Div16);
+    RTC_ITConfig(RTC_IT_WUT, ENABLE);
+
+    power_window_start = get_systick();
+}
+
+void Power_Allow_Stop(uint8_t enable)
+{
+    power_stop_allowed = enable;
+}
+
+/**
+ * @brief 读取RTC当天的时间，单位 1/256 秒
+ */
+static uint32_t Power_RTC_Ticks(void)
+{
+    // 先读SSR会锁住TR/DR的影子寄存器，读DR后解锁
+    uint32_t ss = RTC->SSR;
+    uint32_t tr = RTC->TR;
+    uint32_t sec;
+    (void)RTC->DR;
+
+    sec = (((tr >> 20) & 0x3) * 10 + ((tr >> 16) & 0xF)) * 3600
+        + (((tr >> 12) & 0x7) * 10 + ((tr >> 8) & 0xF)) * 60
+        + (((tr >> 4) & 0x7) * 10 + (tr & 0xF));
+    return sec * POWER_RTC_SUBSEC + (POWER_RTC_SUBSEC - 1 - (ss & 0xFFFF));
+}
+
+/**
+ * @brief STOP模式唤醒后HSI为系统时钟，重新打开HSE和PLL
+ */
+static void Power_Restore_Clock(void)
+{
+    RCC_HSEConfig(RCC_HSE_ON);
+    while (RCC_GetFlagStatus(RCC_FLAG_HSERDY) == RESET)
+        ;
+    RCC_PLLCmd(ENABLE);
+    while (RCC_GetFlagStatus(RCC_FLAG_PLLRDY) == RESET)
+        ;
+    RCC_SYSCLKConfig(RCC_SYSCLKSource_PLLCLK);
+    while (RCC_GetSYSCLKSource() != 0x08)
+        ;
+}
+
+/**
+ * @brief 进入STOP模式最多 ms 毫秒
+ * @return 实际睡眠的毫秒数
+ */
+static uint32_t Power_Stop(uint32_t ms)
+{
+    uint32_t before, after, ticks;
+
+    if (ms > POWER_STOP_MAX_MS)
+        ms = POWER_STOP_MAX_MS;
+
+    before = Power_RTC_Ticks();
+
+    RTC_WakeUpCmd(DISABLE);
+    RTC_SetWakeUpCounter(ms * POWER_WUT_HZ / 1000 - 1);
+    RTC_ClearITPendingBit(RTC_IT_WUT);
+    EXTI_ClearITPendingBit(EXTI_Line22);
+    RTC_WakeUpCmd(ENABLE);
+
+    PWR_EnterSTOPMode(PWR_Regulator_LowPower, PWR_STOPEntry_WFI);
+
+    Power_Restore_Clock();
+
+    // 唤醒定时器到期就是睡满了，直接用设定值，比子秒计数更准
+    if (RTC_GetFlagStatus(RTC_FLAG_WUTF) != RESET)
+    {
+        RTC_WakeUpCmd(DISABLE);
+        return ms;
+    }
+    RTC_WakeUpCmd(DISABLE);
+
+    // 被其他中断(按键等)提前唤醒，用RTC子秒计数量出睡了多久
+    RTC_WaitForSynchro();
+    after = Power_RTC_Ticks();
+    if (after < before)
+        after += 24UL * 3600 * POWER_RTC_SUBSEC; // 跨过了零点
+    ticks = (after - before) * 1000 + power_stop_frac;
+    power_stop_frac = ticks % POWER_RTC_SUBSEC;
+    return ticks / POWER_RTC_SUBSEC;
+}
+
+/**
+ * @brief 串口最近有没有收到数据
+ * @note STOP模式下串口收不到数据，有人在用命令行时暂时不进STOP
+ */
+static uint8_t Power_Uart_Active(void)
+{
+    uint32_t count = get_usart_rx_count();
+    uint32_t now = get_systick();
+
+    if (count != power_rx_count)
+    {
+        power_rx_count = count;
+        power_rx_time = now;
+    }
+    return now - power_rx_time < POWER_RX_HOLD_MS;
+}
+
+void Power_Idle(uint32_t ms)
+{
+    uint32_t start = micros();
+    uint32_t slept;
+
+    // STOP模式下TIM5停止，按键消抖期间不能进入；
+    // I2C1/DMA1 的传输(包括 OLED 还没发完的帧)在STOP里会停在半路，也不能进入
+    if (power_stop_allowed && ms >= POWER_STOP_MIN_MS &&
+        !key_debounce_active && uart_tx_idle() && !Power_Uart_Active() &&
+        !Hard_I2C_Is_Busy() && !OLED_Is_Busy())
+    {
+        slept = Power_Stop(ms);
+        Timebase_Add_Ms(slept);
+        power_stop_ms += slept;
+        return;
+    }
+
+    Timebase_Set_Wakeup(ms);
+    __WFI();
+    power_idle_us += micros() - start;
+}
+
+uint16_t Power_Idle_Permille(uint16_t *stop_permille)
+{
+    uint32_t now = get_systick();
+    uint32_t window = now - power_window_start;
+    uint32_t idle = power_idle_us / 1000 + power_stop_ms;
+    uint16_t permille = 0;
+
+    if (window)
+    {
+        permille = idle * 1000 / window;
+        if (stop_permille)
+            *stop_permille = power_stop_ms * 1000 / window;
+    }
+    else if (stop_permille)
+    {
+        *stop_permille = 0;
+    }
+
+    power_idle_us = 0;
+    power_stop_ms = 0;
+    power_window_start = now;
+    return permille;
+}
+
+void Power_Report_Task(void)
+{
+    uint16_t stop;
+    uint16_t idle = Power_Idle_Permille(&stop);
+
+    printf("idle %u.%u%% (stop %u.%u%%)\r\n",
+           idle / 10, idle % 10, stop / 10, stop % 10);
+}
+
+/**
+ * @brief RTC唤醒中断，只负责清标志
+ */
+void RTC_WKUP_IRQHandler(void)
+{
+    if (RTC_GetITStatus(RTC_IT_WUT) != RESET)
+    {
+        RTC_ClearITPendingBit(RTC_IT_WUT);
+    }
+    EXTI_ClearITPendingBit(EXTI_Line22);
+}
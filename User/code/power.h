@@ -0,0 +1,68 @@
+/**
+ * @file power.h
+ * @brief 空闲低功耗管理
+ * @details 调度器没有任务到期时由 Sched_Idle() 调用 Power_Idle()：
+ *          - 短时间空闲：用TIM2比较中断定时，WFI 睡眠模式等待
+ *          - 允许STOP且空闲足够长：用RTC唤醒定时器定时，进入STOP模式，
+ *            醒来后恢复PLL时钟，并把睡眠的时间补到 get_systick() 上
+ *          同时统计空闲时间占比，由 Power_Report_Task() 定期从串口输出。
+ */
+
+#ifndef __POWER_H
+#define __POWER_H
+
+#include "stm32f4xx.h"
+
+// =============================================================================
+// 配置宏
+// =============================================================================
+#ifndef POWER_STOP_MIN_MS
+#define POWER_STOP_MIN_MS       20      ///< 空闲不少于这个时间(ms)才进入STOP，否则只WFI
+#endif
+
+#ifndef POWER_STOP_MAX_MS
+#define POWER_STOP_MAX_MS       30000   ///< 一次STOP最长时间(ms)，受RTC唤醒计数器16位限制
+#endif
+
+#ifndef POWER_RX_HOLD_MS
+#define POWER_RX_HOLD_MS        30000   ///< 串口收到数据后这段时间(ms)内不进STOP
+#endif
+
+#ifndef POWER_REPORT_PERIOD
+#define POWER_REPORT_PERIOD     10000   ///< Power_Report_Task() 建议的调用周期(ms)
+#endif
+
+/**
+ * @brief 配置RTC唤醒定时器和中断
+ * @note 需在 RTC_Date_Init() 之后调用
+ */
+void Power_Init(void);
+
+/**
+ * @brief 是否允许空闲时进入STOP模式
+ * @param enable 1: 允许；0: 只使用WFI
+ * @note STOP模式下串口不能接收，只在不需要串口交互的界面(如表盘)打开
+ */
+void Power_Allow_Stop(uint8_t enable);
+
+/**
+ * @brief 休眠最多 ms 毫秒，期间有中断会提前醒来
+ * @param ms 距离下一个任务到期的时间
+ * @note 由 Sched_Idle() 在关中断状态下调用，返回后由调用者开中断
+ */
+void Power_Idle(uint32_t ms);
+
+/**
+ * @brief 从上次调用以来的空闲时间占比(千分比)
+ * @param stop_permille 输出STOP模式所占的千分比，可以为NULL
+ * @return 空闲(WFI + STOP)所占的千分比
+ * @note 调用后重新开始统计
+ */
+uint16_t Power_Idle_Permille(uint16_t *stop_permille);
+
+/**
+ * @brief 周期任务：通过串口打印空闲时间占比
+ */
+void Power_Report_Task(void);
+
+#endif
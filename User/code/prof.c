@@ -0,0 +1,119 @@
+/**
+ * @file prof.c
+ * @brief 热点代码周期计数分析实现
+ */
+
+#include "prof.h"
+#include "dwt.h"
+#include "uart_dma.h"
+#include "cmd.h"
+#include <string.h>
+#include <stdio.h>
+
+#if PROF_ENABLE
+
+Prof_Stat prof_stats[PROF_ZONE_COUNT];
+
+#define PROF_ZONE_NAME(id, name) name,
+static const char *const prof_names[PROF_ZONE_COUNT] = {
+    PROF_ZONE_LIST(PROF_ZONE_NAME)
+};
+#undef PROF_ZONE_NAME
+
+static uint32_t prof_overhead = 0;  ///< 一对空的 PROF_BEGIN/PROF_END 的周期数
+
+void Prof_Reset(void)
+{
+    uint8_t i;
+
+    for (i = 0; i < PROF_ZONE_COUNT; i++)
+    {
+        prof_stats[i].count = 0;
+        prof_stats[i].min = 0xFFFFFFFF;
+        prof_stats[i].max = 0;
+        prof_stats[i].total = 0;
+    }
+
+    // 借第一个区段量一次空区段，再清掉
+    PROF_BEGIN(0);
+    PROF_END(0);
+    prof_overhead = prof_stats[0].min;
+    prof_stats[0].count = 0;
+    prof_stats[0].min = 0xFFFFFFFF;
+    prof_stats[0].max = 0;
+    prof_stats[0].total = 0;
+}
+
+// 表比发送缓冲区大，每行之后等缓冲区腾出一半再继续
+static void Prof_Flush(void)
+{
+    while (uart_get_tx_buf_usage() > UART_TX_BUF_SIZE / 2)
+        ;
+}
+
+static uint32_t Prof_Net(uint32_t cycles)
+{
+    return cycles > prof_overhead ? cycles - prof_overhead : 0;
+}
+
+void Prof_Dump(void)
+{
+    uint8_t i;
+    uint32_t avg;
+
+    printf("zone            count      min      avg      max   avg_us\r\n");
+    Prof_Flush();
+    for (i = 0; i < PROF_ZONE_COUNT; i++)
+    {
+        const Prof_Stat *z = &prof_stats[i];
+        if (z->count == 0)
+        {
+            printf("%-14s %6d        -        -        -        -\r\n", prof_names[i], 0);
+            Prof_Flush();
+            continue;
+        }
+        avg = Prof_Net((uint32_t)(z->total / z->count));
+        printf("%-14s %6lu %8lu %8lu %8lu %8lu\r\n", prof_names[i],
+               (unsigned long)z->count, (unsigned long)Prof_Net(z->min),
+               (unsigned long)avg, (unsigned long)Prof_Net(z->max),
+               (unsigned long)DWT_Cycles_To_Us(avg));
+        Prof_Flush();
+    }
+    printf("(overhead %lu cycles per zone subtracted, %lu cycles/us)\r\n",
+           (unsigned long)prof_overhead, (unsigned long)dwt_cycles_per_us);
+}
+
+#else
+
+void Prof_Reset(void)
+{
+}
+
+void Prof_Dump(void)
+{
+    printf("profiler disabled, build with PROF_ENABLE=1\r\n");
+}
+
+#endif
+
+// prof [reset]
+static void cmd_prof(uint8_t argc, char *argv[])
+{
+    if (argc > 1 && strcmp(argv[1], "reset") == 0)
+    {
+        Prof_Reset();
+        printf("prof reset\r\n");
+        return;
+    }
+    Prof_Dump();
+}
+
+static const Cmd prof_cmds[] = {
+    { "prof", cmd_prof, "prof [reset] - Show/clear profiling zones" },
+};
+
+void Prof_Init(void)
+{
+    Prof_Reset();
+    Cmd_Register(prof_cmds, CMD_COUNT(prof_cmds));
+}
@@ -0,0 +1,102 @@
+/**
+ * @file prof.h
+ * @brief 热点代码周期计数分析
+ * @details 用 DWT 周期计数器给代码段计时，每个区段统计次数、最小、最大和平均周期数，
+ *          串口命令 "prof" 打印统计表，"prof reset" 清零(Prof_Init() 登记)。
+ *          PROF_ENABLE 为 0 时 PROF_BEGIN/PROF_END 展开为空，不产生任何代码。
+ *
+ *          用法：
+ *          @code
+ *          PROF_BEGIN(PROF_MPU_ACCEL);
+ *          MPU_Get_Accelerometer(&ax, &ay, &az);
+ *          PROF_END(PROF_MPU_ACCEL);
+ *          @endcode
+ *          同一区段不能嵌套，不同区段可以嵌套。
+ */
+
+#ifndef __PROF_H
+#define __PROF_H
+
+#include "stm32f4xx.h"
+
+// =============================================================================
+// 配置宏
+// =============================================================================
+#ifndef PROF_ENABLE
+#define PROF_ENABLE     0       ///< 1: 编译分析代码；0: 全部去掉
+#endif
+
+/**
+ * @brief 区段列表，新增区段在这里加一行：X(编号, 打印名称)
+ */
+#define PROF_ZONE_LIST(X)                       \
+    X(PROF_WATCH_UPDATE,  "watch_update")       \
+    X(PROF_OLED_FORMAT,   "oled_format")        \
+    X(PROF_OLED_DRAW,     "oled_draw")          \
+    X(PROF_OLED_REFRESH,  "oled_refresh")       \
+    X(PROF_RTC_GET,       "rtc_get")            \
+    X(PROF_MPU_ACCEL,     "mpu_accel")          \
+    X(PROF_PEDOMETER,     "pedometer")          \
+    X(PROF_ALARM_CHECK,   "alarm_check")
+
+#define PROF_ZONE_ENUM(id, name) id,
+typedef enum
+{
+    PROF_ZONE_LIST(PROF_ZONE_ENUM)
+    PROF_ZONE_COUNT
+} Prof_Zone;
+#undef PROF_ZONE_ENUM
+
+/**
+ * @brief 单个区段的统计
+ */
+typedef struct
+{
+    uint32_t start;     ///< 本次开始时的周期计数
+    uint32_t count;     ///< 执行次数
+    uint32_t min;       ///< 最短周期数
+    uint32_t max;       ///< 最长周期数
+    uint64_t total;     ///< 累计周期数
+} Prof_Stat;
+
+#if PROF_ENABLE
+
+extern Prof_Stat prof_stats[PROF_ZONE_COUNT];
+
+static inline void Prof_Record(Prof_Stat *z, uint32_t cycles)
+{
+    z->count++;
+    z->total += cycles;
+    if (cycles < z->min)
+        z->min = cycles;
+    if (cycles > z->max)
+        z->max = cycles;
+}
+
+#define PROF_BEGIN(id)  (prof_stats[id].start = DWT->CYCCNT)
+#define PROF_END(id)    Prof_Record(&prof_stats[id], DWT->CYCCNT - prof_stats[id].start)
+
+#else
+
+#define PROF_BEGIN(id)  ((void)0)
+#define PROF_END(id)    ((void)0)
+
+#endif
+
+/**
+ * @brief 清零统计并登记 "prof" 串口命令
+ */
+void Prof_Init(void);
+
+/**
+ * @brief 清零所有区段，并测量一次空区段的开销
+ */
+void Prof_Reset(void);
+
+/**
+ * @brief 通过串口打印统计表
+ * @note 表中的周期数已减去空区段本身的开销
+ */
+void Prof_Dump(void);
+
+#endif
@@ -0,0 +1,376 @@
+/**
+ * @file proto.c
+ * @brief USART1 二进制帧协议实现
+ */
+
+#include "proto.h"
+#include "uart_dma.h"
+#include "sched.h"
+#include "delay.h"
+#include "spi.h"
+#include "oled.h"
+#include "MPU6050.h"
+#include "simple_pedometer.h"
+#include "ui/alarm_all.h"
+#include <string.h>
+
+/**
+ * @brief 批量传输：fill 每次装一帧数据，返回0表示传完
+ */
+typedef struct
+{
+    uint8_t type;           ///< 数据帧类型
+    uint8_t req_type;       ///< 请求类型，DONE 里带回
+    uint8_t req_seq;        ///< 请求序号，DONE 里带回
+    uint32_t pos;           ///< 下一段的位置
+    uint32_t end;           ///< 结束位置
+    uint16_t (*fill)(uint8_t *payload);
+    uint16_t pending;       ///< 已装好、因缓冲区满还没发出的数据长度
+} Proto_Job;
+
+static const uint16_t crc16_table[256] = {
+    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+    0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF,
+    0x1231, 0x0210, 0x3273, 0x2252, 0x52B5, 0x4294, 0x72F7, 0x62D6,
+    0x9339, 0x8318, 0xB37B, 0xA35A, 0xD3BD, 0xC39C, 0xF3FF, 0xE3DE,
+    0x2462, 0x3443, 0x0420, 0x1401, 0x64E6, 0x74C7, 0x44A4, 0x5485,
+    0xA56A, 0xB54B, 0x8528, 0x9509, 0xE5EE, 0xF5CF, 0xC5AC, 0xD58D,
+    0x3653, 0x2672, 0x1611, 0x0630, 0x76D7, 0x66F6, 0x5695, 0x46B4,
+    0xB75B, 0xA77A, 0x9719, 0x8738, 0xF7DF, 0xE7FE, 0xD79D, 0xC7BC,
+    0x48C4, 0x58E5, 0x6886, 0x78A7, 0x0840, 0x1861, 0x2802, 0x3823,
+    0xC9CC, 0xD9ED, 0xE98E, 0xF9AF, 0x8948, 0x9969, 0xA90A, 0xB92B,
+    0x5AF5, 0x4AD4, 0x7AB7, 0x6A96, 0x1A71, 0x0A50, 0x3A33, 0x2A12,
+    0xDBFD, 0xCBDC, 0xFBBF, 0xEB9E, 0x9B79, 0x8B58, 0xBB3B, 0xAB1A,
+    0x6CA6, 0x7C87, 0x4CE4, 0x5CC5, 0x2C22, 0x3C03, 0x0C60, 0x1C41,
+    0xEDAE, 0xFD8F, 0xCDEC, 0xDDCD, 0xAD2A, 0xBD0B, 0x8D68, 0x9D49,
+    0x7E97, 0x6EB6, 0x5ED5, 0x4EF4, 0x3E13, 0x2E32, 0x1E51, 0x0E70,
+    0xFF9F, 0xEFBE, 0xDFDD, 0xCFFC, 0xBF1B, 0xAF3A, 0x9F59, 0x8F78,
+    0x9188, 0x81A9, 0xB1CA, 0xA1EB, 0xD10C, 0xC12D, 0xF14E, 0xE16F,
+    0x1080, 0x00A1, 0x30C2, 0x20E3, 0x5004, 0x4025, 0x7046, 0x6067,
+    0x83B9, 0x9398, 0xA3FB, 0xB3DA, 0xC33D, 0xD31C, 0xE37F, 0xF35E,
+    0x02B1, 0x1290, 0x22F3, 0x32D2, 0x4235, 0x5214, 0x6277, 0x7256,
+    0xB5EA, 0xA5CB, 0x95A8, 0x8589, 0xF56E, 0xE54F, 0xD52C, 0xC50D,
+    0x34E2, 0x24C3, 0x14A0, 0x0481, 0x7466, 0x6447, 0x5424, 0x4405,
+    0xA7DB, 0xB7FA, 0x8799, 0x97B8, 0xE75F, 0xF77E, 0xC71D, 0xD73C,
+    0x26D3, 0x36F2, 0x0691, 0x16B0, 0x6657, 0x7676, 0x4615, 0x5634,
+    0xD94C, 0xC96D, 0xF90E, 0xE92F, 0x99C8, 0x89E9, 0xB98A, 0xA9AB,
+    0x5844, 0x4865, 0x7806, 0x6827, 0x18C0, 0x08E1, 0x3882, 0x28A3,
+    0xCB7D, 0xDB5C, 0xEB3F, 0xFB1E, 0x8BF9, 0x9BD8, 0xABBB, 0xBB9A,
+    0x4A75, 0x5A54, 0x6A37, 0x7A16, 0x0AF1, 0x1AD0, 0x2AB3, 0x3A92,
+    0xFD2E, 0xED0F, 0xDD6C, 0xCD4D, 0xBDAA, 0xAD8B, 0x9DE8, 0x8DC9,
+    0x7C26, 0x6C07, 0x5C64, 0x4C45, 0x3CA2, 0x2C83, 0x1CE0, 0x0CC1,
+    0xEF1F, 0xFF3E, 0xCF5D, 0xDF7C, 0xAF9B, 0xBFBA, 0x8FD9, 0x9FF8,
+    0x6E17, 0x7E36, 0x4E55, 0x5E74, 0x2E93, 0x3EB2, 0x0ED1, 0x1EF0,
+};
+
+static uint8_t proto_tx_seq = 0;
+static uint8_t proto_frame[PROTO_FRAME_MAX];
+
+static Proto_Job proto_job;
+static uint8_t proto_job_payload[PROTO_MAX_PAYLOAD];
+static uint8_t proto_job_id = SCHED_INVALID;
+
+static uint8_t proto_sensor_id = SCHED_INVALID;
+
+uint16_t Proto_Crc16(uint16_t crc, const uint8_t *data, uint16_t len)
+{
+    while (len--)
+        crc = (crc << 8) ^ crc16_table[(crc >> 8) ^ *data++];
+    return crc;
+}
+
+// ====================== 发送 ======================
+
+/**
+ * @brief COBS 编码器：code 指向当前段的长度字节
+ */
+typedef struct
+{
+    uint8_t *out;
+    uint16_t len;
+    uint16_t code;
+} Cobs_Enc;
+
+static void cobs_begin(Cobs_Enc *e, uint8_t *out)
+{
+    e->out = out;
+    e->code = 0;
+    e->len = 1;
+    out[0] = 1;
+}
+
+static void cobs_put(Cobs_Enc *e, uint8_t b)
+{
+    if (b != 0)
+    {
+        e->out[e->len++] = b;
+        e->out[e->code]++;
+    }
+    if (b == 0 || e->out[e->code] == 0xFF)
+    {
+        // 一段结束(遇到0或满254个非零字节)，开始下一段
+        e->code = e->len++;
+        e->out[e->code] = 1;
+    }
+}
+
+static void cobs_write(Cobs_Enc *e, const uint8_t *data, uint16_t len)
+{
+    while (len--)
+        cobs_put(e, *data++);
+}
+
+uint8_t Proto_Send(uint8_t type, const uint8_t *payload, uint16_t len)
+{
+    Cobs_Enc e;
+    uint8_t head[2];
+    uint8_t tail[2];
+    uint16_t crc;
+
+    if (len > PROTO_MAX_PAYLOAD)
+        return 1;
+
+    head[0] = type;
+    head[1] = proto_tx_seq;
+    crc = Proto_Crc16(0xFFFF, head, 2);
+    crc = Proto_Crc16(crc, payload, len);
+    tail[0] = (uint8_t)crc;
+    tail[1] = (uint8_t)(crc >> 8);
+
+    proto_frame[0] = 0x00;
+    cobs_begin(&e, &proto_frame[1]);
+    cobs_write(&e, head, 2);
+    cobs_write(&e, payload, len);
+    cobs_write(&e, tail, 2);
+    proto_frame[1 + e.len] = 0x00;
+
+    // 发不出去的帧也占一个序号，主机才能从序号的空缺统计到丢帧
+    proto_tx_seq++;
+
+    // 整帧放得下才写，帧中间不会插进文本
+    if (Usart1_Send_Policy(proto_frame, e.len + 2, UART_TX_LINE) == 0)
+        return 1;
+    return 0;
+}
+
+static void proto_done(uint8_t req_type, uint8_t req_seq, uint8_t status)
+{
+    uint8_t p[3] = { req_type, req_seq, status };
+    Proto_Send(PROTO_DONE, p, sizeof(p));
+}
+
+static void put_u16(uint8_t *p, uint16_t v)
+{
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+}
+
+static void put_u32(uint8_t *p, uint32_t v)
+{
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    p[2] = (uint8_t)(v >> 16);
+    p[3] = (uint8_t)(v >> 24);
+}
+
+static uint32_t get_u32(const uint8_t *p)
+{
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+// ====================== 批量传输 ======================
+
+// 发送缓冲区有空就发下一帧，传完发 DONE 并删除自己
+static void proto_job_task(void)
+{
+    while (uart_tx_free() >= PROTO_FRAME_MAX)
+    {
+        if (proto_job.pending == 0)
+        {
+            proto_job.pending = proto_job.fill(proto_job_payload);
+            if (proto_job.pending == 0)
+            {
+                proto_done(proto_job.req_type, proto_job.req_seq, PROTO_OK);
+                Sched_Cancel(proto_job_id);
+                proto_job_id = SCHED_INVALID;
+                return;
+            }
+        }
+        if (Proto_Send(proto_job.type, proto_job_payload, proto_job.pending))
+            return;
+        proto_job.pending = 0;
+    }
+}
+
+static uint8_t proto_job_start(uint8_t type, uint8_t req_type, uint8_t req_seq,
+                               uint32_t pos, uint32_t end, uint16_t (*fill)(uint8_t *))
+{
+    if (proto_job_id != SCHED_INVALID)
+        return PROTO_ERR_BUSY;
+
+    proto_job.type = type;
+    proto_job.req_type = req_type;
+    proto_job.req_seq = req_seq;
+    proto_job.pos = pos;
+    proto_job.end = end;
+    proto_job.fill = fill;
+    proto_job.pending = 0;
+    proto_job_id = Sched_Add_Periodic(proto_job_task, PROTO_JOB_PERIOD);
+    if (proto_job_id == SCHED_INVALID)
+        return PROTO_ERR_BUSY;
+    proto_job_task();
+    return PROTO_OK;
+}
+
+// FLASH_DATA {地址, 数据}
+static uint16_t proto_fill_flash(uint8_t *p)
+{
+    uint32_t n = proto_job.end - proto_job.pos;
+
+    if (n == 0)
+        return 0;
+    if (n > PROTO_CHUNK)
+        n = PROTO_CHUNK;
+    put_u32(p, proto_job.pos);
+    W25Q128_ReadData(p + 4, proto_job.pos, n);
+    proto_job.pos += n;
+    return 4 + n;
+}
+
+// SCREEN_DATA {偏移, 数据}，显存按页排列，每页128字节
+static uint16_t proto_fill_screen(uint8_t *p)
+{
+    uint32_t n = proto_job.end - proto_job.pos;
+
+    if (n == 0)
+        return 0;
+    if (n > PROTO_CHUNK)
+        n = PROTO_CHUNK;
+    put_u16(p, proto_job.pos);
+    memcpy(p + 2, OLED_Get_GRAM() + proto_job.pos, n);
+    proto_job.pos += n;
+    return 2 + n;
+}
+
+// ====================== 传感器数据流 ======================
+
+static void proto_sensor_task(void)
+{
+    uint8_t p[14];
+    short ax, ay, az;
+
+    MPU_Get_Accelerometer(&ax, &ay, &az);
+    put_u32(p, get_systick());
+    put_u16(p + 4, ax);
+    put_u16(p + 6, ay);
+    put_u16(p + 8, az);
+    put_u32(p + 10, simple_pedometer_get_steps());
+    // 数据流允许丢帧，主机按序号统计
+    Proto_Send(PROTO_SENSOR_DATA, p, sizeof(p));
+}
+
+static uint8_t proto_sensor_set(uint16_t period_ms)
+{
+    Sched_Cancel(proto_sensor_id);
+    proto_sensor_id = SCHED_INVALID;
+    if (period_ms == 0)
+        return PROTO_OK;
+    if (period_ms < 10)
+        return PROTO_ERR_ARGS;
+    proto_sensor_id = Sched_Add_Periodic(proto_sensor_task, period_ms);
+    return proto_sensor_id == SCHED_INVALID ? PROTO_ERR_BUSY : PROTO_OK;
+}
+
+// ====================== 接收 ======================
+
+// 原地 COBS 解码，返回解码后的长度，格式错误返回0
+static uint16_t cobs_decode(uint8_t *buf, uint16_t len)
+{
+    uint16_t in = 0, out = 0;
+
+    while (in < len)
+    {
+        uint8_t code = buf[in++];
+        uint8_t i;
+
+        if (code == 0 || in + code - 1 > len)
+            return 0;
+        for (i = 1; i < code; i++)
+            buf[out++] = buf[in++];
+        if (code != 0xFF && in < len)
+            buf[out++] = 0;
+    }
+    return out;
+}
+
+static void proto_dispatch(uint8_t type, uint8_t seq, const uint8_t *p, uint16_t len)
+{
+    uint8_t status = PROTO_OK;
+    uint8_t reply[2 + MAX_ALARMS * sizeof(Alarm_TypeDef)];
+
+    switch (type)
+    {
+    case PROTO_PING:
+        reply[0] = seq;
+        reply[1] = PROTO_VERSION;
+        Proto_Send(PROTO_PONG, reply, 2);
+        return;
+
+    case PROTO_FLASH_READ:
+        if (len != 8 || get_u32(p) >= W25Q128_CAPACITY ||
+            get_u32(p + 4) > W25Q128_CAPACITY - get_u32(p))
+        {
+            status = PROTO_ERR_ARGS;
+            break;
+        }
+        status = proto_job_start(PROTO_FLASH_DATA, type, seq, get_u32(p),
+                                 get_u32(p) + get_u32(p + 4), proto_fill_flash);
+        if (status == PROTO_OK)
+            return;
+        break;
+
+    case PROTO_ALARMS:
+        reply[0] = g_alarm_count;
+        memcpy(&reply[1], g_alarms, g_alarm_count * sizeof(Alarm_TypeDef));
+        Proto_Send(PROTO_ALARM_TABLE, reply, 1 + g_alarm_count * sizeof(Alarm_TypeDef));
+        return;
+
+    case PROTO_SCREEN:
+        status = proto_job_start(PROTO_SCREEN_DATA, type, seq, 0, 8 * 128, proto_fill_screen);
+        if (status == PROTO_OK)
+            return;
+        break;
+
+    case PROTO_SENSOR:
+        status = len == 2 ? proto_sensor_set(p[0] | (p[1] << 8)) : PROTO_ERR_ARGS;
+        break;
+
+    case PROTO_BAUD:
+        // 同一个请求既是切换也是确认：已经是这个波特率就是确认，DONE 按新波特率回去
+        if (len != 4)
+            status = PROTO_ERR_ARGS;
+        else if (uart_baud_confirm(get_u32(p)) != 0 && uart_baud_begin(get_u32(p)) != 0)
+            status = PROTO_ERR_ARGS;
+        break;
+
+    default:
+        status = PROTO_ERR_TYPE;
+        break;
+    }
+    proto_done(type, seq, status);
+}
+
+// 串口收到 0x00 定界的帧：解码、校验后分发，坏帧直接丢弃
+static void proto_on_frame(uint8_t *frame, uint16_t len)
+{
+    uint16_t n = cobs_decode(frame, len);
+
+    if (n < 4 || Proto_Crc16(0xFFFF, frame, n - 2) != (frame[n - 2] | (frame[n - 1] << 8)))
+        return;
+    proto_dispatch(frame[0], frame[1], frame + 2, n - 4);
+}
+
+void Proto_Init(void)
+{
+    uart_rx_frame_hook = proto_on_frame;
+}
@@ -0,0 +1,97 @@
+/**
+ * @file proto.h
+ * @brief USART1 上的二进制帧协议(COBS + CRC-16)
+ * @details 和命令行、printf 文本共用一个串口。每帧在线上的格式：
+ *          @code
+ *          0x00 | COBS( 类型(1) | 序号(1) | 数据(0~PROTO_MAX_PAYLOAD) | CRC16(2, 小端) ) | 0x00
+ *          @endcode
+ *          CRC-16/CCITT-FALSE(多项式0x1021，初值0xFFFF)，覆盖类型、序号和数据。
+ *          COBS 保证帧内没有 0x00，printf 文本里也没有 0x00，接收方按 0x00 就能把两者分开。
+ *          二进制日志(log.h)的参数里会有 0x00，所以每条日志也装在一个 PROTO_LOG 帧里发送，
+ *          串口上除了文本就只有帧。
+ *
+ *          序号：每个方向各自递增，主机可以据此发现丢帧；设备的应答帧里带着请求的序号。
+ *          请求类型 0x01~0x7F，设备发出的数据/应答为 请求类型|0x80，
+ *          批量传输和出错以 PROTO_DONE 结束。上位机工具见 tools/proto_host.py。
+ *
+ *          批量传输(Flash 读取、截屏)由一个只在传输期间存在的调度任务推进，
+ *          发送缓冲区有空就装下一帧，按串口线速发送，不阻塞主循环。
+ *          大量数据先用 PROTO_BAUD 把波特率提到几 Mbaud(见 uart_baud_begin())。
+ */
+
+#ifndef __PROTO_H
+#define __PROTO_H
+
+#include "stm32f4xx.h"
+
+// =============================================================================
+// 配置宏
+// =============================================================================
+#ifndef PROTO_MAX_PAYLOAD
+#define PROTO_MAX_PAYLOAD   160     ///< 每帧数据最大字节数
+#endif
+
+#ifndef PROTO_CHUNK
+#define PROTO_CHUNK         128     ///< 批量传输每帧携带的数据字节数
+#endif
+
+#ifndef PROTO_JOB_PERIOD
+#define PROTO_JOB_PERIOD    5       ///< 批量传输任务检查发送缓冲区的周期(ms)
+#endif
+
+#define PROTO_VERSION       1
+
+/// 帧在线上的最大长度：定界符2 + COBS开销 + 类型/序号2 + 数据 + CRC2
+#define PROTO_FRAME_MAX     (2 + 1 + (PROTO_MAX_PAYLOAD + 4) / 254 + 4 + PROTO_MAX_PAYLOAD)
+
+/**
+ * @brief 消息类型
+ */
+typedef enum
+{
+    PROTO_PING          = 0x01,     ///< 无数据 -> PONG {请求序号, 版本}
+    PROTO_FLASH_READ    = 0x02,     ///< {地址u32, 长度u32} -> 若干 FLASH_DATA，最后 DONE
+    PROTO_ALARMS        = 0x03,     ///< 无数据 -> ALARM_TABLE {个数, 闹钟[个数]}
+    PROTO_SCREEN        = 0x04,     ///< 无数据 -> 若干 SCREEN_DATA(128x64 显存，按页)，最后 DONE
+    PROTO_SENSOR        = 0x05,     ///< {周期ms u16，0为停止} -> DONE，之后周期发送 SENSOR_DATA
+    PROTO_BAUD          = 0x06,     ///< {波特率u32} -> DONE 后切换；主机在新波特率下再发一次同样的请求确认
+
+    PROTO_PONG          = 0x81,
+    PROTO_FLASH_DATA    = 0x82,     ///< {地址u32, 数据}
+    PROTO_ALARM_TABLE   = 0x83,
+    PROTO_SCREEN_DATA   = 0x84,     ///< {偏移u16, 数据}
+    PROTO_SENSOR_DATA   = 0x85,     ///< {时间ms u32, ax s16, ay s16, az s16, 步数u32}
+    PROTO_LOG           = 0xFD,     ///< 设备主动发出的日志记录 {fmt地址u32, 时间戳us u32, 参数varint...}，见 log.h
+    PROTO_DONE          = 0xFE,     ///< {请求类型, 请求序号, 状态}
+} Proto_Type;
+
+/**
+ * @brief PROTO_DONE 里的状态
+ */
+typedef enum
+{
+    PROTO_OK = 0,
+    PROTO_ERR_BUSY,         ///< 已有批量传输在进行
+    PROTO_ERR_ARGS,         ///< 参数长度或取值不对
+    PROTO_ERR_TYPE,         ///< 不认识的请求类型
+} Proto_Status;
+
+/**
+ * @brief 挂接串口接收帧回调
+ */
+void Proto_Init(void);
+
+/**
+ * @brief 发送一帧(整帧写入发送缓冲区，不会和文本交错)
+ * @return 0: 成功；1: 发送缓冲区放不下或数据太长，本帧未发送
+ *         (缓冲区放不下时序号照样递增，主机看到序号空缺就知道丢了帧；要重发的调用者应先检查 uart_tx_free())
+ * @note 只能在主循环中调用
+ */
+uint8_t Proto_Send(uint8_t type, const uint8_t *payload, uint16_t len);
+
+/**
+ * @brief CRC-16/CCITT-FALSE
+ */
+uint16_t Proto_Crc16(uint16_t crc, const uint8_t *data, uint16_t len);
+
+#endif
@@ -0,0 +1,87 @@
+/**
+ * @file ring.c
+ * @brief 单生产者/单消费者无锁环形缓冲区实现
+ */
+
+#include "ring.h"
+#include <string.h>
+
+void ring_init(Ring *r, uint8_t *buf, uint16_t size)
+{
+    r->buf = buf;
+    r->mask = size - 1;
+    r->head = 0;
+    r->tail = 0;
+}
+
+uint16_t ring_write(Ring *r, const uint8_t *data, uint16_t len)
+{
+    uint16_t head = r->head;
+    uint16_t room = (uint16_t)(r->mask + 1 - (uint16_t)(head - r->tail));
+    uint16_t pos, first;
+
+    if (len > room)
+        len = room;
+    if (len == 0)
+        return 0;
+
+    // 一次预留，最多分成两段拷贝
+    pos = head & r->mask;
+    first = r->mask + 1 - pos;
+    if (first > len)
+        first = len;
+    memcpy(&r->buf[pos], data, first);
+    memcpy(r->buf, data + first, len - first);
+
+    __DMB();    // 数据写完再发布 head
+    r->head = head + len;
+    return len;
+}
+
+void ring_commit(Ring *r, uint16_t n)
+{
+    __DMB();
+    r->head = r->head + n;
+}
+
+uint16_t ring_read(Ring *r, uint8_t *out, uint16_t len)
+{
+    uint16_t tail = r->tail;
+    uint16_t count = (uint16_t)(r->head - tail);
+    uint16_t pos, first;
+
+    __DMB();    // 先看到 head，再读它保护的数据
+    if (len > count)
+        len = count;
+    if (len == 0)
+        return 0;
+
+    pos = tail & r->mask;
+    first = r->mask + 1 - pos;
+    if (first > len)
+        first = len;
+    memcpy(out, &r->buf[pos], first);
+    memcpy(out + first, r->buf, len - first);
+
+    __DMB();    // 数据读完再释放空间
+    r->tail = tail + len;
+    return len;
+}
+
+uint16_t ring_peek(Ring *r, uint8_t **ptr)
+{
+    uint16_t tail = r->tail;
+    uint16_t count = (uint16_t)(r->head - tail);
+    uint16_t pos = tail & r->mask;
+    uint16_t contig = r->mask + 1 - pos;
+
+    __DMB();
+    *ptr = &r->buf[pos];
+    return count < contig ? count : contig;
+}
+
+void ring_skip(Ring *r, uint16_t n)
+{
+    __DMB();
+    r->tail = r->tail + n;
+}
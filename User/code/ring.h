@@ -0,0 +1,91 @@
+/**
+ * @file ring.h
+ * @brief 单生产者/单消费者无锁环形缓冲区
+ * @details 生产者只改 head，消费者只改 tail，双方都不需要关中断：
+ *          - 生产者：先写数据，__DMB() 之后再发布 head(release)
+ *          - 消费者：读到 head 之后 __DMB() 再读数据(acquire)，用完再发布 tail
+ *          容量必须是2的幂，下标自由递增(16位回绕)，用掩码取模，不浪费1字节判满。
+ *          生产者和消费者各自只能有一个(例如主循环写、中断读)。
+ */
+
+#ifndef __RING_H
+#define __RING_H
+
+#include "stm32f4xx.h"
+
+/**
+ * @brief 环形缓冲区
+ */
+typedef struct
+{
+    uint8_t *buf;               ///< 数据区
+    uint16_t mask;              ///< 容量-1，容量为2的幂且不超过32768
+    volatile uint16_t head;     ///< 写下标，只由生产者修改
+    volatile uint16_t tail;     ///< 读下标，只由消费者修改
+} Ring;
+
+/**
+ * @brief 静态初始化，例如 static Ring r = RING_INIT(buf, sizeof(buf));
+ */
+#define RING_INIT(buf, size)    { (buf), (size) - 1, 0, 0 }
+
+/**
+ * @brief 编译期检查容量是否为2的幂
+ */
+#define RING_SIZE_OK(size)      ((size) > 0 && ((size) & ((size) - 1)) == 0 && (size) <= 32768)
+
+void ring_init(Ring *r, uint8_t *buf, uint16_t size);
+
+/**
+ * @brief 已写入、还没被读走的字节数
+ */
+static inline uint16_t ring_count(const Ring *r)
+{
+    return (uint16_t)(r->head - r->tail);
+}
+
+/**
+ * @brief 还能写入的字节数
+ */
+static inline uint16_t ring_free(const Ring *r)
+{
+    return (uint16_t)(r->mask + 1 - ring_count(r));
+}
+
+static inline uint8_t ring_is_empty(const Ring *r)
+{
+    return r->head == r->tail;
+}
+
+/**
+ * @brief 生产者：写入数据，空间不足时只写能放下的部分
+ * @return 实际写入的字节数
+ */
+uint16_t ring_write(Ring *r, const uint8_t *data, uint16_t len);
+
+/**
+ * @brief 生产者：数据已经由DMA等写进 buf，只发布 n 字节
+ * @note 用于DMA循环接收，调用者保证 n 不超过空闲空间(或自行处理覆盖)
+ */
+void ring_commit(Ring *r, uint16_t n);
+
+/**
+ * @brief 消费者：读出最多 len 字节
+ * @return 实际读出的字节数
+ */
+uint16_t ring_read(Ring *r, uint8_t *out, uint16_t len);
+
+/**
+ * @brief 消费者：不拷贝，取得从读下标开始的连续可读区
+ * @param ptr 输出连续区的起始地址
+ * @return 连续可读的字节数(数据跨过末尾时只到末尾)
+ * @note 用完后调用 ring_skip() 释放，适合DMA直接从缓冲区发送
+ */
+uint16_t ring_peek(Ring *r, uint8_t **ptr);
+
+/**
+ * @brief 消费者：释放 n 字节
+ */
+void ring_skip(Ring *r, uint16_t n);
+
+#endif
@@ -1,4 +1,7 @@
 #include "rtc_date.h"
+#include "prof.h"
+#include "cmd.h"
+#include <string.h>
 #include <stdio.h>
 
 #define RTC_BKP_DR0_DATA ((uint32_t)0x32F3) // 标记RTC已初始化的标志
@@ -7,8 +10,12 @@
 RTC_TimeTypeDef g_RTC_Time;
 RTC_DateTypeDef g_RTC_Date;
 
+static void RTC_Cmd_Init(void);
+
 void RTC_Date_Init(void)
 {
+    RTC_Cmd_Init();
+
     // 1) 使能PWR和备份寄存器时钟
     RCC_APB1PeriphClockCmd(RCC_APB1Periph_PWR, ENABLE);
 
@@ -69,11 +76,13 @@ void RTC_Date_Init(void)
 
 void RTC_Date_Get(void)
 {
+    PROF_BEGIN(PROF_RTC_GET);
     // 1）读取时间并存储到全局变量
     RTC_GetTime(RTC_Format_BIN, &g_RTC_Time);
 
     // 2）读取日期并存储到全局变量
     RTC_GetDate(RTC_Format_BIN, &g_RTC_Date);
+    PROF_END(PROF_RTC_GET);
 
     // 3）输出时间
     // printf("Time: %02d:%02d:%02d\n", g_RTC_Time.RTC_Hours, g_RTC_Time.RTC_Minutes, g_RTC_Time.RTC_Seconds);
@@ -158,3 +167,74 @@ void RTC_SetDateTime_Manual(uint8_t year, uint8_t month, uint8_t day, uint8_t we
     
     printf("RTC DateTime set complete!\n");
 }
+
+// ====================== 串口命令 ======================
+
+// 读出 argv[first] 开始的 n 个数字参数
+static uint8_t rtc_cmd_args(uint8_t argc, char *argv[], uint8_t first, uint8_t n, uint32_t *v)
+{
+    uint8_t i;
+
+    if (argc < first + n)
+        return 1;
+    for (i = 0; i < n; i++)
+    {
+        if (Cmd_Arg_U32(argv[first + i], &v[i]))
+            return 1;
+    }
+    return 0;
+}
+
+// time / time set hh mm ss
+static void cmd_time(uint8_t argc, char *argv[])
+{
+    uint32_t v[3];
+
+    if (argc > 1 && strcmp(argv[1], "set") == 0)
+    {
+        if (rtc_cmd_args(argc, argv, 2, 3, v))
+            printf("usage: time set <hh> <mm> <ss>\r\n");
+        else
+            RTC_SetTime_Manual(v[0], v[1], v[2]);
+        return;
+    }
+
+    RTC_Date_Get();
+    printf("%04d-%02d-%02d %02d:%02d:%02d (Weekday: %d)\r\n",
+           g_RTC_Date.RTC_Year + 2000, g_RTC_Date.RTC_Month, g_RTC_Date.RTC_Date,
+           g_RTC_Time.RTC_Hours, g_RTC_Time.RTC_Minutes, g_RTC_Time.RTC_Seconds,
+           g_RTC_Date.RTC_WeekDay);
+}
+
+// date set yy mm dd weekday
+static void cmd_date(uint8_t argc, char *argv[])
+{
+    uint32_t v[4];
+
+    if (argc > 1 && strcmp(argv[1], "set") == 0 && !rtc_cmd_args(argc, argv, 2, 4, v))
+    {
+        RTC_SetDate_Manual(v[0], v[1], v[2], v[3]);
+        return;
+    }
+    printf("usage: date set <yy> <mm> <dd> <weekday 1-7>\r\n");
+}
+
+// 旧写法 get time
+static void cmd_get(uint8_t argc, char *argv[])
+{
+    if (argc > 1 && strcmp(argv[1], "time") == 0)
+        cmd_time(1, argv);
+    else
+        printf("usage: get time\r\n");
+}
+
+static const Cmd rtc_cmds[] = {
+    { "time", cmd_time, "time [set <hh> <mm> <ss>] - Show/set RTC time" },
+    { "date", cmd_date, "date set <yy> <mm> <dd> <wd> - Set RTC date" },
+    { "get",  cmd_get,  NULL },
+};
+
+static void RTC_Cmd_Init(void)
+{
+    Cmd_Register(rtc_cmds, CMD_COUNT(rtc_cmds));
+}
@@ -0,0 +1,173 @@
+/**
+ * @file sched.c
+ * @brief 协作式任务调度器实现
+ */
+
+#include "sched.h"
+#include "delay.h"
+#include "power.h"
+
+/**
+ * @brief 任务表项
+ */
+typedef struct
+{
+    Sched_Func fn;          ///< 任务函数，为NULL表示空闲表项
+    uint32_t next;          ///< 下一次到期时间(ms)
+    uint32_t period;        ///< 周期(ms)，0 表示一次性任务
+    uint8_t running;        ///< 正在执行，防止嵌套调度时重入
+    volatile uint8_t wake;  ///< 由 Sched_Wake() 置位，要求尽快执行一次
+} Sched_Task;
+
+static Sched_Task sched_tasks[SCHED_MAX_TASKS];
+static uint8_t sched_nest;     ///< 正在执行的任务层数，任务里嵌套调用 Sched_Run() 时大于1
+
+/**
+ * @brief 判断时间点 t 是否已经到达(处理计数回绕)
+ */
+static uint8_t Sched_Due(uint32_t now, uint32_t t)
+{
+    return (int32_t)(now - t) >= 0;
+}
+
+void Sched_Init(void)
+{
+    uint8_t i;
+    for (i = 0; i < SCHED_MAX_TASKS; i++)
+    {
+        sched_tasks[i].fn = 0;
+    }
+}
+
+static uint8_t Sched_Add(Sched_Func fn, uint32_t delay, uint32_t period)
+{
+    uint8_t i;
+    for (i = 0; i < SCHED_MAX_TASKS; i++)
+    {
+        if (sched_tasks[i].fn == 0)
+        {
+            sched_tasks[i].next = get_systick() + delay;
+            sched_tasks[i].period = period;
+            sched_tasks[i].running = 0;
+            sched_tasks[i].wake = 0;
+            sched_tasks[i].fn = fn;
+            return i;
+        }
+    }
+    return SCHED_INVALID;
+}
+
+uint8_t Sched_Add_Periodic(Sched_Func fn, uint32_t period_ms)
+{
+    if (period_ms == 0)
+        period_ms = 1;
+    return Sched_Add(fn, period_ms, period_ms);
+}
+
+uint8_t Sched_Add_Oneshot(Sched_Func fn, uint32_t delay_ms)
+{
+    return Sched_Add(fn, delay_ms, 0);
+}
+
+void Sched_Cancel(uint8_t id)
+{
+    if (id < SCHED_MAX_TASKS)
+    {
+        sched_tasks[id].fn = 0;
+    }
+}
+
+void Sched_Wake(uint8_t id)
+{
+    if (id < SCHED_MAX_TASKS)
+    {
+        sched_tasks[id].wake = 1;
+    }
+}
+
+void Sched_Set_Period(uint8_t id, uint32_t period_ms)
+{
+    if (id >= SCHED_MAX_TASKS || sched_tasks[id].fn == 0)
+        return;
+    if (period_ms == 0)
+        period_ms = 1;
+    sched_tasks[id].period = period_ms;
+    sched_tasks[id].next = get_systick() + period_ms;
+}
+
+void Sched_Run(void)
+{
+    uint8_t i;
+    uint32_t now;
+    Sched_Func fn;
+
+    for (i = 0; i < SCHED_MAX_TASKS; i++)
+    {
+        Sched_Task *t = &sched_tasks[i];
+        now = get_systick();
+        if (t->fn == 0 || t->running || !(t->wake || Sched_Due(now, t->next)))
+            continue;
+
+        fn = t->fn;
+        t->wake = 0;
+        if (t->period == 0)
+        {
+            t->fn = 0; // 一次性任务先删除，任务函数里可以重新添加自己
+        }
+        else if (Sched_Due(now, t->next)) // 被 Sched_Wake() 提前唤醒时到期时间不变
+        {
+            t->next += t->period;
+            // 落后超过一个周期(例如被阻塞的界面卡住)，不补跑，从现在重新对齐
+            if (Sched_Due(now, t->next))
+                t->next = now + t->period;
+        }
+
+        t->running = 1;
+        sched_nest++;
+        fn();
+        sched_nest--;
+        t->running = 0;
+    }
+}
+
+uint8_t Sched_In_Task(void)
+{
+    return sched_nest != 0;
+}
+
+uint32_t Sched_Next_Deadline(void)
+{
+    uint8_t i;
+    uint32_t now = get_systick();
+    uint32_t best = SCHED_NO_DEADLINE;
+    int32_t left;
+
+    for (i = 0; i < SCHED_MAX_TASKS; i++)
+    {
+        if (sched_tasks[i].fn == 0 || sched_tasks[i].running)
+            continue;
+        if (sched_tasks[i].wake)
+            return 0;
+        left = (int32_t)(sched_tasks[i].next - now);
+        if (left <= 0)
+            return 0;
+        if ((uint32_t)left < best)
+            best = left;
+    }
+    return best;
+}
+
+void Sched_Idle(void)
+{
+    uint32_t wait;
+
+    // 关中断后再检查一次，避免检查之后、休眠之前到来的中断被错过；
+    // PRIMASK 置位时 WFI 仍会被挂起的中断唤醒，中断在 __enable_irq() 之后才执行
+    __disable_irq();
+    wait = Sched_Next_Deadline();
+    if (wait != 0)
+    {
+        Power_Idle(wait);
+    }
+    __enable_irq();
+}
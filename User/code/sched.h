@@ -0,0 +1,92 @@
+/**
+ * @file sched.h
+ * @brief 协作式任务调度器
+ * @details 以 get_systick() 的毫秒计数为时基，支持周期任务和一次性任务。
+ *          任务在主循环中按到期顺序依次执行，不抢占，任务函数必须尽快返回；
+ *          没有任务到期时主循环进入 Sched_Idle() 休眠到下一个任务到期。
+ */
+
+#ifndef __SCHED_H
+#define __SCHED_H
+
+#include "stm32f4xx.h"
+
+// =============================================================================
+// 配置宏
+// =============================================================================
+#ifndef SCHED_MAX_TASKS
+#define SCHED_MAX_TASKS     12      ///< 任务表容量
+#endif
+
+#define SCHED_INVALID       0xFF    ///< 无效任务编号
+#define SCHED_NO_DEADLINE   0xFFFFFFFFUL ///< Sched_Next_Deadline() 在没有任务时的返回值
+
+/**
+ * @brief 任务函数类型
+ */
+typedef void (*Sched_Func)(void);
+
+/**
+ * @brief 清空任务表
+ */
+void Sched_Init(void);
+
+/**
+ * @brief 添加周期任务
+ * @param fn 任务函数
+ * @param period_ms 周期(ms)，第一次在 period_ms 之后执行
+ * @return 任务编号，任务表满时返回 SCHED_INVALID
+ * @note 下一次到期时间按 上次到期时间+周期 计算，周期不随任务耗时漂移
+ */
+uint8_t Sched_Add_Periodic(Sched_Func fn, uint32_t period_ms);
+
+/**
+ * @brief 添加一次性任务，执行后自动删除
+ * @param fn 任务函数
+ * @param delay_ms 延时(ms)
+ * @return 任务编号，任务表满时返回 SCHED_INVALID
+ */
+uint8_t Sched_Add_Oneshot(Sched_Func fn, uint32_t delay_ms);
+
+/**
+ * @brief 删除任务
+ * @param id 任务编号，SCHED_INVALID 时忽略
+ */
+void Sched_Cancel(uint8_t id);
+
+/**
+ * @brief 让任务在下一次 Sched_Run() 时执行一次，可以在中断中调用
+ * @note 周期任务的下一次到期时间不受影响
+ */
+void Sched_Wake(uint8_t id);
+
+/**
+ * @brief 修改周期任务的周期，并从现在开始重新计时
+ */
+void Sched_Set_Period(uint8_t id, uint32_t period_ms);
+
+/**
+ * @brief 执行所有已到期的任务
+ * @note 正在执行中的任务不会被嵌套调用的 Sched_Run() 再次执行
+ */
+void Sched_Run(void);
+
+/**
+ * @brief 当前是否在某个任务函数里(包括任务里嵌套的 Sched_Run())
+ * @return 1: 在任务里，调用者不能阻塞等待该任务之后才会发生的事情
+ */
+uint8_t Sched_In_Task(void);
+
+/**
+ * @brief 距离最近一个任务到期还有多少毫秒
+ * @return 0 表示已有任务到期；没有任务时返回 SCHED_NO_DEADLINE
+ */
+uint32_t Sched_Next_Deadline(void);
+
+/**
+ * @brief 没有任务到期时让CPU休眠，直到下一个任务到期或有中断
+ * @note 休眠方式由 Power_Idle() 决定(WFI 或 STOP)
+ */
+void Sched_Idle(void);
+
+#endif
@@ -1,4 +1,11 @@
 #include "spi.h"
+#include "cmd.h"
+#define LOG_MODULE  LOG_MOD_FLASH
+#include "log.h"
+#include <stdio.h>
+#include <string.h>
+
+static void W25Q128_Cmd_Init(void);
 
 // SPI
 void SPI1_Init(void)
@@ -45,6 +52,8 @@ void SPI1_Init(void)
 	
 	// 5) ʹSPI
 	SPI_Cmd(SPI1, ENABLE);
+
+	W25Q128_Cmd_Init();
 }
 
 uint8_t SPI1_ReadWriteByte(uint8_t txData)
@@ -68,7 +77,6 @@ uint32_t W25Q128_ReadID(void)
     uint8_t capacity_id = 0;
     uint32_t JedecDeviceID = 0;
 	
-    printf("Reading W25Q128 ID...\r\n");
     SPI_NSS_L;	// Ƭѡ
     SPI1_ReadWriteByte(W25X_JedecDeviceID);
     manufacturer_id = SPI1_ReadWriteByte(W25X_Dummy);
@@ -77,9 +85,9 @@ uint32_t W25Q128_ReadID(void)
     SPI_NSS_H;
     JedecDeviceID = manufacturer_id << 16 | memory_type_id << 8 | capacity_id;
     
-    printf("W25Q128 bytes: Mfg=0x%02X, Type=0x%02X, Cap=0x%02X\r\n", 
-           manufacturer_id, memory_type_id, capacity_id);
-    printf("W25Q128 ID: 0x%06X\r\n", JedecDeviceID);
+    // ӡȡʱÿζIDʱŴӡ
+    LOG_D("W25Q128 ID: 0x%06X (Mfg=0x%02X, Type=0x%02X, Cap=0x%02X)\r\n",
+          JedecDeviceID, manufacturer_id, memory_type_id, capacity_id);
     
     return JedecDeviceID;
 }
@@ -198,3 +206,45 @@ void W25Q128_ReadData(uint8_t *pBuffer, uint32_t ReadAddr, uint16_t NumByteToRea
     }
     SPI_NSS_H;
 }
+
+// : flash id / flash read <addr> [len]
+static void cmd_flash(uint8_t argc, char *argv[])
+{
+    uint8_t buf[64];
+    uint32_t addr, len = 16;
+
+    if (argc > 1 && strcmp(argv[1], "id") == 0)
+    {
+        uint32_t id = W25Q128_ReadID();
+        printf("W25Q128 ID: 0x%06lX (%s)\r\n", (unsigned long)id, id == W25X_JEDECID ? "OK" : "mismatch");
+        return;
+    }
+    if (argc > 2 && strcmp(argv[1], "read") == 0 && !Cmd_Arg_U32(argv[2], &addr) &&
+        (argc < 4 || !Cmd_Arg_U32(argv[3], &len)) && addr < W25Q128_CAPACITY)
+    {
+        if (len > sizeof(buf))
+            len = sizeof(buf);
+        if (len > W25Q128_CAPACITY - addr)
+            len = W25Q128_CAPACITY - addr;
+        W25Q128_ReadData(buf, addr, len);
+        for (uint32_t i = 0; i < len; i++)
+        {
+            if (i % 16 == 0)
+                printf("%06lX:", (unsigned long)(addr + i));
+            printf(" %02X", buf[i]);
+            if (i % 16 == 15 || i == len - 1)
+                printf("\r\n");
+        }
+        return;
+    }
+    printf("usage: flash id | flash read <addr> [len<=64]\r\n");
+}
+
+static const Cmd flash_cmds[] = {
+    { "flash", cmd_flash, "flash id | read <addr> [len] - W25Q128 ID / hex dump" },
+};
+
+static void W25Q128_Cmd_Init(void)
+{
+    Cmd_Register(flash_cmds, CMD_COUNT(flash_cmds));
+}
@@ -0,0 +1,241 @@
+/**
+ * @file step_detect.c
+ * @brief 定点计步流水线实现
+ */
+
+#include "step_detect.h"
+#include <string.h>
+
+// 0.5~3Hz 带通(中心 sqrt(0.5*3) = 1.22Hz，Q = 1.22/2.5)，RBJ 双二阶，系数 Q14：
+// y = B0*(x[n] - x[n-2]) + A1*y[n-1] + A2*y[n-2]
+// 输入限幅在 ±2g，32位累加不会溢出
+#if STEP_FS == 100
+#define STEP_B0         1192
+#define STEP_A1         30294
+#define STEP_A2         (-14000)
+#define STEP_GRAV_SHIFT 7       ///< 重力低通时间常数 2^7 个样本(1.28s)
+#elif STEP_FS == 50
+#define STEP_B0         2217
+#define STEP_A1         28000
+#define STEP_A2         (-11951)
+#define STEP_GRAV_SHIFT 6
+#else
+#error "STEP_FS must be 50 or 100"
+#endif
+
+#define STEP_IN_MAX     (2 * STEP_1G - 1)
+
+uint16_t Step_Isqrt(uint32_t x)
+{
+    uint32_t res = 0;
+    uint32_t bit = 1UL << 30;
+    uint8_t i;
+
+    for (i = 0; i < 16; i++)
+    {
+        if (x >= res + bit)
+        {
+            x -= res + bit;
+            res = (res >> 1) + bit;
+        }
+        else
+        {
+            res >>= 1;
+        }
+        bit >>= 2;
+    }
+    return (uint16_t)res;
+}
+
+void Step_Init(Step_Detect *sd)
+{
+    memset(sd, 0, sizeof(*sd));
+}
+
+static int16_t step_sat16(int32_t v)
+{
+    if (v > 32767)
+        return 32767;
+    if (v < -32768)
+        return -32768;
+    return (int16_t)v;
+}
+
+// 峰峰值 -> 步长(mm)：两次开方得到 (p2p/g)^(1/4)，Q15
+static uint16_t step_stride(int32_t p2p)
+{
+    uint32_t s;
+
+    if (p2p <= 0)
+        return 0;
+    if (p2p > 65535)
+        p2p = 65535;
+    s = Step_Isqrt((uint32_t)p2p << 16);    // sqrt(p2p) * 256
+    s = Step_Isqrt(s << 16);                // p2p^(1/4) * 4096 = (p2p/g)^(1/4) * 32768
+    return (uint16_t)((STEP_STRIDE_K_MM * s) >> 15);
+}
+
+// 窗口滑过一块：更新阈值中线、回差和是否允许判步
+static void step_window(Step_Detect *sd)
+{
+    int16_t wmax, wmin;
+    uint8_t i;
+
+    sd->win_max[sd->blk_idx] = sd->blk_max;
+    sd->win_min[sd->blk_idx] = sd->blk_min;
+    if (++sd->blk_idx >= STEP_WIN_BLOCKS)
+        sd->blk_idx = 0;
+
+    wmax = sd->win_max[0];
+    wmin = sd->win_min[0];
+    for (i = 1; i < STEP_WIN_BLOCKS; i++)
+    {
+        if (sd->win_max[i] > wmax)
+            wmax = sd->win_max[i];
+        if (sd->win_min[i] < wmin)
+            wmin = sd->win_min[i];
+    }
+    sd->mid = (int16_t)(((int32_t)wmax + wmin) / 2);
+    sd->hyst = (int16_t)(((int32_t)wmax - wmin) / 4);
+    sd->active = (int32_t)wmax - wmin >= STEP_MIN_P2P;
+
+    sd->blk_n = 0;
+    sd->blk_max = -32768;
+    sd->blk_min = 32767;
+}
+
+// 候选步：检查间隔，规律的候选步攒够 STEP_CONFIRM 个才计数，返回新计的步数
+static uint8_t step_candidate(Step_Detect *sd, uint32_t t_ms)
+{
+    uint32_t dt = t_ms - sd->last_ms;
+    uint8_t n = 0;
+
+    sd->last_ms = t_ms;
+
+    // 过零太密(振动、抖动)不是走路；回差是峰峰值的1/4，正常走路一步里不会来回穿过两次
+    if (!sd->active || dt < STEP_MIN_INTERVAL_MS)
+    {
+        sd->run = 0;
+        return 0;
+    }
+    if (sd->run == 0 || dt > STEP_MAX_INTERVAL_MS)
+    {
+        // 停了一阵之后的第一步
+        sd->run = 1;
+        sd->interval_ms = 0;
+        return 0;
+    }
+    if (sd->interval_ms)
+    {
+        // 和平滑后的间隔相差超过1/3：节奏乱了，从这一步重新开始数
+        uint32_t iv = sd->interval_ms;
+        uint32_t diff = dt > iv ? dt - iv : iv - dt;
+
+        if (diff * 3 > iv)
+        {
+            sd->run = 1;
+            sd->interval_ms = 0;
+            return 0;
+        }
+        sd->interval_ms = (uint16_t)(iv + ((int32_t)dt - (int32_t)iv) / 4);
+    }
+    else
+    {
+        sd->interval_ms = (uint16_t)dt;
+    }
+
+    if (sd->run < STEP_CONFIRM)
+    {
+        if (++sd->run == STEP_CONFIRM)
+            n = STEP_CONFIRM;       // 确认在走路，补上前面的候选步
+    }
+    else
+    {
+        n = 1;
+    }
+    if (n)
+    {
+        sd->stride_mm = step_stride((int32_t)sd->peak - sd->valley);
+        sd->steps += n;
+        sd->distance_mm += (uint32_t)sd->stride_mm * n;
+    }
+    return n;
+}
+
+uint8_t Step_Update(Step_Detect *sd, int16_t ax, int16_t ay, int16_t az, uint32_t t_ms)
+{
+    uint32_t sq = (uint32_t)((int32_t)ax * ax) + (uint32_t)((int32_t)ay * ay) + (uint32_t)((int32_t)az * az);
+
+    return Step_Update_Sq(sd, sq, t_ms);
+}
+
+uint8_t Step_Update_Sq(Step_Detect *sd, uint32_t sq, uint32_t t_ms)
+{
+    int32_t mag = Step_Isqrt(sq) >> 2;
+    int32_t x, acc;
+    int16_t y;
+    uint8_t n = 0;
+
+    if (!sd->started)
+    {
+        sd->grav_q8 = mag << 8;
+        sd->blk_max = -32768;
+        sd->blk_min = 32767;
+        sd->started = 1;
+    }
+
+    // 去重力
+    sd->grav_q8 += ((mag << 8) - sd->grav_q8) >> STEP_GRAV_SHIFT;
+    x = mag - (sd->grav_q8 >> 8);
+    if (x > STEP_IN_MAX)
+        x = STEP_IN_MAX;
+    if (x < -STEP_IN_MAX)
+        x = -STEP_IN_MAX;
+
+    // 带通
+    acc = STEP_B0 * (x - sd->x2) + STEP_A1 * sd->y1 + STEP_A2 * sd->y2;
+    y = step_sat16((acc + (1 << 13)) >> 14);
+    sd->x2 = sd->x1;
+    sd->x1 = (int16_t)x;
+    sd->y2 = sd->y1;
+    sd->y1 = y;
+
+    // 动态阈值窗口
+    if (y > sd->blk_max)
+        sd->blk_max = y;
+    if (y < sd->blk_min)
+        sd->blk_min = y;
+    if (++sd->blk_n >= STEP_BLOCK)
+        step_window(sd);
+
+    // 中线上下带回差的过零：上去再下来算一个候选步
+    if (!sd->above)
+    {
+        if (y < sd->valley)
+            sd->valley = y;
+        if (y > sd->mid + sd->hyst)
+        {
+            sd->above = 1;
+            sd->peak = y;
+        }
+    }
+    else
+    {
+        if (y > sd->peak)
+            sd->peak = y;
+        if (y < sd->mid - sd->hyst)
+        {
+            sd->above = 0;
+            n = step_candidate(sd, t_ms);
+            sd->valley = y;
+        }
+    }
+    return n;
+}
+
+uint16_t Step_Cadence(const Step_Detect *sd, uint32_t now_ms)
+{
+    if (sd->run < STEP_CONFIRM || sd->interval_ms == 0 || now_ms - sd->last_ms > STEP_MAX_INTERVAL_MS)
+        return 0;
+    return (uint16_t)(60000UL / sd->interval_ms);
+}
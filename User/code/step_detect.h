@@ -0,0 +1,107 @@
+/**
+ * @file step_detect.h
+ * @brief 定点计步流水线
+ * @details 每个加速度样本依次经过：
+ *          1. 合加速度：32位整数开方(固定16轮移位减法)，换算成 1g = STEP_1G
+ *          2. 去重力：合加速度的一阶低通作为重力估计，从合加速度里减掉
+ *          3. 带通：0.5~3Hz 双二阶滤波器(Q14系数，32位状态)，只留下走路、跑步的频段
+ *          4. 动态阈值：最近 STEP_WIN_BLOCKS 个半秒块的最大、最小值，中线为阈值，1/4峰峰值为回差
+ *          5. 判步：信号越过中线上方再回到下方算一个候选步；候选步间隔要在合理范围内且前后一致，
+ *             连续 STEP_CONFIRM 个才开始计数(补上这几步)，偶尔甩手、拿起放下不计
+ *          6. 步频由平滑后的步间隔得到，步长按 Weinberg 公式 K*(峰峰值)^(1/4) 估计，累加成距离
+ *
+ *          每个样本的工作量固定：一次开方、5次乘加和常数次比较，块边界多一次 STEP_WIN_BLOCKS 项的最值，
+ *          没有随数据变化的循环；不用浮点、不分配内存，状态全部在 Step_Detect 里。
+ *          不依赖硬件，固件和主机(User/OLED/simulator 的 step_replay)编译同一份代码。
+ */
+
+#ifndef __STEP_DETECT_H
+#define __STEP_DETECT_H
+
+#include <stdint.h>
+
+// =============================================================================
+// 配置宏
+// =============================================================================
+#ifndef STEP_FS
+#define STEP_FS                 100     ///< 采样率(Hz)，支持50和100，和 MPU_FIFO_RATE 一致
+#endif
+
+#ifndef STEP_MIN_INTERVAL_MS
+#define STEP_MIN_INTERVAL_MS    250     ///< 最短步间隔(ms)，对应每秒4步
+#endif
+
+#ifndef STEP_MAX_INTERVAL_MS
+#define STEP_MAX_INTERVAL_MS    2000    ///< 最长步间隔(ms)，超过就认为停下了
+#endif
+
+#ifndef STEP_CONFIRM
+#define STEP_CONFIRM            4       ///< 连续这么多个规律的候选步才开始计数
+#endif
+
+#ifndef STEP_MIN_P2P
+#define STEP_MIN_P2P            200     ///< 带通后峰峰值的下限(1/STEP_1G g)，低于它不判步
+#endif
+
+#ifndef STEP_STRIDE_K_MM
+#define STEP_STRIDE_K_MM        800     ///< Weinberg 系数(mm)：步长 = K * (峰峰值/g)^(1/4)
+#endif
+
+#define STEP_1G                 4096    ///< 内部单位：1g(原始读数 ±2g 量程 16384/g 右移2位)
+#define STEP_WIN_BLOCKS         4       ///< 动态阈值的窗口：块数
+#define STEP_BLOCK              (STEP_FS / 2)   ///< 每块的样本数(半秒)
+
+/**
+ * @brief 计步器状态
+ */
+typedef struct
+{
+    int32_t grav_q8;                    ///< 重力估计，Q8
+    int16_t x1, x2, y1, y2;             ///< 带通滤波器的历史输入、输出
+    int16_t blk_max, blk_min;           ///< 当前块的最值
+    uint16_t blk_n;                     ///< 当前块已有样本数
+    uint8_t blk_idx;                    ///< 下一个写入的窗口块
+    int16_t win_max[STEP_WIN_BLOCKS];   ///< 窗口内各块的最大值
+    int16_t win_min[STEP_WIN_BLOCKS];   ///< 窗口内各块的最小值
+    int16_t mid;                        ///< 阈值中线
+    int16_t hyst;                       ///< 回差
+    uint8_t active;                     ///< 窗口峰峰值够大，允许判步
+    uint8_t above;                      ///< 信号在中线上方
+    int16_t peak, valley;               ///< 本周期的峰、谷
+    uint8_t run;                        ///< 连续规律的候选步数(到 STEP_CONFIRM 为止)
+    uint32_t last_ms;                   ///< 上一个候选步的时刻
+    uint16_t interval_ms;               ///< 平滑后的步间隔，0表示还没有
+    uint16_t stride_mm;                 ///< 最近一步的步长
+    uint32_t steps;                     ///< 步数
+    uint32_t distance_mm;               ///< 距离
+    uint8_t started;                    ///< 已经收到过样本
+} Step_Detect;
+
+void Step_Init(Step_Detect *sd);
+
+/**
+ * @brief 送入一个样本
+ * @param ax,ay,az 原始加速度(±2g 量程)
+ * @param t_ms 采样时刻(ms)，按 STEP_FS 等间隔
+ * @return 这个样本新计的步数：一般为0或1，刚确认开始走路时一次补上 STEP_CONFIRM 步
+ */
+uint8_t Step_Update(Step_Detect *sd, int16_t ax, int16_t ay, int16_t az, uint32_t t_ms);
+
+/**
+ * @brief 送入一个样本的三轴平方和，整块样本先用 Imu_Block_SumSq() 算好时用
+ * @param sq ax^2 + ay^2 + az^2
+ */
+uint8_t Step_Update_Sq(Step_Detect *sd, uint32_t sq, uint32_t t_ms);
+
+/**
+ * @brief 步频(步/分钟)
+ * @param now_ms 当前时刻，距上一步超过 STEP_MAX_INTERVAL_MS 时返回0
+ */
+uint16_t Step_Cadence(const Step_Detect *sd, uint32_t now_ms);
+
+/**
+ * @brief 32位整数开方(向下取整)，固定16轮
+ */
+uint16_t Step_Isqrt(uint32_t x);
+
+#endif
@@ -0,0 +1,253 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+还原 LOG() 发出的二进制日志记录 (见 User/code/log.h)
+
+用法:
+  python log_decode.py 工程.axf [日志文件]          解码保存下来的串口数据(省略则读 stdin)
+  python log_decode.py 工程.axf -p COM3 [-b 115200]  直接读串口(需要 pyserial)
+
+每条记录装在一个 PROTO_LOG 帧里(见 User/code/proto.h)，帧的拆分和校验用 proto_host.py 的 FrameReader。
+记录里的编号是格式串相对 Log_Fmt_Base 的偏移，这里从 ELF 符号表查出 Log_Fmt_Base 的地址，
+再从可加载段按地址取出格式串，用记录里的参数格式化。帧之外的字节(普通 printf 文本)原样输出，
+其它类型的帧跳过。固件重新编译后格式串地址会变，要用和固件同一次编译出来的 ELF。
+时间戳大多是距上一条记录的增量，漏收帧(序号不连续)后到下一条完整时间戳之前的记录时间显示为 ?。
+"""
+import argparse
+import re
+import struct
+import sys
+
+from proto_host import LOG, FrameReader
+
+BASE_SYMBOL = "Log_Fmt_Base"
+
+SPEC_RE = re.compile(r"%([-+ #0]*)(\d+|\*)?(?:\.(\d+))?(hh|h|ll|l|z|j|t)?([diuxXocp%])")
+
+
+class Elf:
+    """只读取 32 位小端 ELF 的可加载段和符号表，够用来按地址取字符串"""
+
+    def __init__(self, path):
+        with open(path, "rb") as f:
+            data = f.read()
+        if data[:4] != b"\x7fELF" or data[4] != 1 or data[5] != 1:
+            raise ValueError("%s: 不是32位小端 ELF" % path)
+        phoff, = struct.unpack_from("<I", data, 0x1C)
+        phentsize, phnum = struct.unpack_from("<HH", data, 0x2A)
+        self.segments = []
+        for i in range(phnum):
+            p_type, p_offset, p_vaddr, p_paddr, p_filesz = struct.unpack_from(
+                "<IIIII", data, phoff + i * phentsize)
+            if p_type == 1 and p_filesz:    # PT_LOAD
+                seg = data[p_offset:p_offset + p_filesz]
+                self.segments.append((p_vaddr, seg))
+                if p_paddr != p_vaddr:
+                    self.segments.append((p_paddr, seg))
+        self.symbols = self._read_symbols(data)
+        self.cache = {}
+
+    @staticmethod
+    def _read_symbols(data):
+        shoff, = struct.unpack_from("<I", data, 0x20)
+        shentsize, shnum = struct.unpack_from("<HH", data, 0x2E)
+        sections = [struct.unpack_from("<IIIIIIIIII", data, shoff + i * shentsize)
+                    for i in range(shnum)]
+        symbols = {}
+        for sh in sections:
+            if sh[1] != 2:      # SHT_SYMTAB
+                continue
+            strtab = sections[sh[6]]
+            strs = data[strtab[4]:strtab[4] + strtab[5]]
+            for off in range(sh[4], sh[4] + sh[5], 16):
+                st_name, st_value = struct.unpack_from("<II", data, off)
+                name = strs[st_name:strs.find(b"\0", st_name)].decode("ascii", "replace")
+                if name:
+                    symbols[name] = st_value
+        return symbols
+
+    def symbol(self, name):
+        if name not in self.symbols:
+            raise ValueError("ELF 里没有符号 %s，固件是不是没有链接 log.c" % name)
+        return self.symbols[name]
+
+    def string(self, addr):
+        """取地址处以 0 结尾的字符串，地址不在任何段里返回 None"""
+        if addr in self.cache:
+            return self.cache[addr]
+        s = None
+        for base, seg in self.segments:
+            if base <= addr < base + len(seg):
+                end = seg.find(b"\0", addr - base)
+                if end >= 0:
+                    s = seg[addr - base:end].decode("utf-8", "replace")
+                break
+        self.cache[addr] = s
+        return s
+
+
+def count_args(fmt):
+    return sum(1 for m in SPEC_RE.finditer(fmt) if m.group(5) != "%")
+
+
+def format_c(fmt, args):
+    """按 C printf 的规则格式化，参数都是32位整数"""
+    it = iter(args)
+
+    def repl(m):
+        flags, width, prec, length, conv = m.groups()
+        if conv == "%":
+            return "%"
+        v = next(it)
+        if width == "*":
+            width = str(v)
+            v = next(it)
+        if length == "hh":
+            v &= 0xFF
+        elif length == "h":
+            v &= 0xFFFF
+        if conv in "di":
+            bits = 8 if length == "hh" else 16 if length == "h" else 32
+            if v >= 1 << (bits - 1):
+                v -= 1 << bits
+        elif conv == "p":
+            conv, flags = "x", "#" + flags
+        spec = "%" + flags + (width or "") + ("." + prec if prec else "")
+        if conv == "c":
+            return (spec + "c") % chr(v & 0xFF)
+        if conv == "u":
+            conv = "d"
+        return (spec + conv) % v
+
+    return SPEC_RE.sub(repl, fmt)
+
+
+def unzigzag(v):
+    return (v >> 1) ^ -(v & 1)
+
+
+def read_varints(buf):
+    args, v, shift = [], 0, 0
+    for b in buf:
+        v |= (b & 0x7F) << shift
+        shift += 7
+        if not b & 0x80:
+            args.append(v & 0xFFFFFFFF)
+            v, shift = 0, 0
+        elif shift > 28:
+            return None
+    return args if shift == 0 else None
+
+
+class Decoder:
+    def __init__(self, elf, out):
+        self.elf = elf
+        self.out = out
+        self.base = elf.symbol(BASE_SYMBOL)
+        self.reader = FrameReader()
+        self.rx_seq = None
+        self.now = None     # 上一条记录的时间(us)，展开了 micros() 的32位回绕
+        self.synced = False # now 是否可以加增量；漏收帧后要等下一条完整时间戳
+        self.at_line_start = True
+
+    def resync(self):
+        """漏收了帧，增量时间接不上了，等下一条完整时间戳"""
+        self.synced = False
+
+    def timestamp(self, sync, ts):
+        if sync:
+            # micros() 32位回绕(约71分钟)，按和上一条的差展开成单调时间
+            self.now = ts if self.now is None else self.now + ((ts - self.now) & 0xFFFFFFFF)
+            self.synced = True
+        elif self.synced:
+            self.now += ts
+        return "%12.6f" % (self.now / 1e6) if self.synced else "%12s" % "?"
+
+    def text(self, data):
+        s = data.decode("utf-8", "replace").replace("\r", "")
+        if s:
+            self.out.write(s)
+            self.at_line_start = s.endswith("\n")
+
+    def record(self, body):
+        """校验并输出一条记录，不是有效记录返回 False"""
+        fields = read_varints(body)
+        if fields is None or len(fields) < 2:
+            return False
+        fid, ts, args = fields[0], fields[1], fields[2:]
+        fmt = self.elf.string((self.base + unzigzag(fid >> 1)) & 0xFFFFFFFF)
+        if fmt is None or len(args) != count_args(fmt):
+            self.resync()
+            return False
+        try:
+            msg = format_c(fmt, args)
+        except (ValueError, TypeError, StopIteration, OverflowError):
+            self.resync()
+            return False
+        if not self.at_line_start:
+            self.out.write("\n")
+        msg = msg.replace("\r", "").rstrip("\n")
+        self.out.write("[%s] %s\n" % (self.timestamp(fid & 1, ts), msg))
+        self.at_line_start = True
+        return True
+
+    def log_frame(self, body):
+        """输出一个 PROTO_LOG 帧的内容；帧的 CRC 对但对不上 ELF 时多半是 ELF 不是同一次编译的"""
+        if not self.record(body):
+            if not self.at_line_start:
+                self.out.write("\n")
+            self.out.write("[unknown log record %s]\n" % body.hex())
+            self.at_line_start = True
+
+    def feed(self, data):
+        for item in self.reader.feed(data):
+            if isinstance(item, bytes):
+                self.text(item)
+            else:
+                # 日志帧和其它帧共用序号，序号不连续说明中间漏了帧
+                if self.rx_seq is not None and item[1] != (self.rx_seq + 1) & 0xFF:
+                    self.resync()
+                self.rx_seq = item[1]
+                if item[0] == LOG:
+                    self.log_frame(item[2])
+
+    def finish(self):
+        # 没收完的帧丢弃
+        self.reader.reset()
+        self.rx_seq = None
+        self.out.flush()
+
+
+def main():
+    ap = argparse.ArgumentParser(description="解码 LOG() 二进制日志")
+    ap.add_argument("elf", help="与固件同一次编译生成的 .axf/.elf")
+    ap.add_argument("input", nargs="?", help="保存的串口数据，省略则读 stdin")
+    ap.add_argument("-p", "--port", help="直接读串口，例如 COM3 或 /dev/ttyUSB0")
+    ap.add_argument("-b", "--baud", type=int, default=115200)
+    a = ap.parse_args()
+
+    dec = Decoder(Elf(a.elf), sys.stdout)
+    if a.port:
+        import serial
+        with serial.Serial(a.port, a.baud, timeout=0.1) as ser:
+            try:
+                while True:
+                    data = ser.read(256)
+                    if data:
+                        dec.feed(data)
+                        sys.stdout.flush()
+            except KeyboardInterrupt:
+                pass
+    else:
+        f = open(a.input, "rb") if a.input else sys.stdin.buffer
+        with f:
+            while True:
+                data = f.read(4096)
+                if not data:
+                    break
+                dec.feed(data)
+    dec.finish()
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,380 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+USART1 二进制帧协议的上位机 (见 User/code/proto.h)
+
+用法 (需要 pyserial):
+  python proto_host.py -p COM3 ping
+  python proto_host.py -p COM3 flash 0 0x1000 dump.bin     读 W25Q128 到文件
+  python proto_host.py -p COM3 alarms                      打印闹钟表
+  python proto_host.py -p COM3 screen shot.png             截屏(.png 或 .pbm)
+  python proto_host.py -p COM3 sensor 50 [-n 100]          以50ms周期打印传感器数据
+  python proto_host.py -p COM3 -B 2000000 flash 0 0x1000000 all.bin
+                                                           先协商到2Mbaud，结束后切回
+
+帧和普通文本共用串口，收到的文本照常打印到 stderr。
+设备的 LOG() 日志以 PROTO_LOG 帧发出，加 -e 工程.axf 时还原成文本(同 log_decode.py)，
+否则只打印格式串编号和时间字段。
+"""
+import argparse
+import struct
+import sys
+import time
+import zlib
+
+PING, FLASH_READ, ALARMS, SCREEN, SENSOR, BAUD = 0x01, 0x02, 0x03, 0x04, 0x05, 0x06
+PONG, FLASH_DATA, ALARM_TABLE, SCREEN_DATA, SENSOR_DATA = 0x81, 0x82, 0x83, 0x84, 0x85
+LOG, DONE = 0xFD, 0xFE
+STATUS = {0: "ok", 1: "busy", 2: "bad args", 3: "unknown type"}
+
+
+def crc16(data, crc=0xFFFF):
+    """CRC-16/CCITT-FALSE"""
+    for b in data:
+        crc ^= b << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) & 0xFFFF if crc & 0x8000 else (crc << 1) & 0xFFFF
+    return crc
+
+
+def cobs_encode(data):
+    out = bytearray([1])
+    code_pos = 0
+    for b in data:
+        if b:
+            out.append(b)
+            out[code_pos] += 1
+        if not b or out[code_pos] == 0xFF:
+            code_pos = len(out)
+            out.append(1)
+    return bytes(out)
+
+
+def cobs_decode(data):
+    out = bytearray()
+    i = 0
+    while i < len(data):
+        code = data[i]
+        i += 1
+        if code == 0 or i + code - 1 > len(data):
+            return None
+        out += data[i:i + code - 1]
+        i += code - 1
+        if code != 0xFF and i < len(data):
+            out.append(0)
+    return bytes(out)
+
+
+def parse_frame(raw):
+    """COBS 解码并校验 CRC，返回 (类型, 序号, 数据)，不是有效帧返回 None"""
+    body = cobs_decode(bytes(raw))
+    if body is None or len(body) < 4:
+        return None
+    if crc16(body[:-2]) != struct.unpack_from("<H", body, len(body) - 2)[0]:
+        return None
+    return body[0], body[1], body[2:-2]
+
+
+class FrameReader:
+    """把串口字节流分成文本和帧，log_decode.py 也用它"""
+
+    def __init__(self):
+        self.in_frame = False
+        self.buf = bytearray()
+
+    def reset(self):
+        self.in_frame = False
+        self.buf.clear()
+
+    def feed(self, data):
+        """按串口上的先后顺序返回 bytes(文本) 和 (类型, 序号, 数据)(帧)；校验不过的帧当文本"""
+        out = []
+        text = bytearray()
+        for b in data:
+            if b == 0:
+                # 帧外的0是帧头；帧内的0是帧尾(空帧当作帧头)
+                if self.in_frame and self.buf:
+                    f = parse_frame(self.buf)
+                    if f is None:
+                        text += self.buf
+                    else:
+                        if text:
+                            out.append(bytes(text))
+                            text.clear()
+                        out.append(f)
+                    self.in_frame = False
+                else:
+                    self.in_frame = True
+                self.buf.clear()
+            elif self.in_frame:
+                self.buf.append(b)
+            else:
+                text.append(b)
+        if text:
+            out.append(bytes(text))
+        return out
+
+
+class Link:
+    def __init__(self, port, baud):
+        import serial
+        self.ser = serial.Serial(port, baud, timeout=0.05)
+        self.seq = 0
+        self.reader = FrameReader()
+        self.frames = []
+        self.rx_seq = None
+        self.lost = 0
+        self.on_log = self._log_raw
+        self.on_lost = lambda: None
+
+    def send(self, ftype, payload=b""):
+        seq = self.seq
+        body = bytes([ftype, seq]) + payload
+        body += struct.pack("<H", crc16(body))
+        self.ser.write(b"\0" + cobs_encode(body) + b"\0")
+        self.seq = (self.seq + 1) & 0xFF
+        return seq
+
+    @staticmethod
+    def _log_raw(payload):
+        # 编号和时间两个 varint，格式见 User/code/log.h
+        fields, v, shift = [], 0, 0
+        for b in payload:
+            v |= (b & 0x7F) << shift
+            shift += 7
+            if not b & 0x80:
+                fields.append(v)
+                v, shift = 0, 0
+                if len(fields) == 2:
+                    break
+        if len(fields) == 2:
+            fid, ts = fields
+            off = (fid >> 2) ^ -((fid >> 1) & 1)
+            sys.stderr.write("[log fmt %+d, %s %d us, %d bytes]\n" % (
+                off, "at" if fid & 1 else "+", ts, len(payload)))
+
+    def _feed(self, data):
+        for item in self.reader.feed(data):
+            if isinstance(item, bytes):
+                sys.stderr.write(item.decode("utf-8", "replace"))
+                continue
+            ftype, seq, payload = item
+            # 日志帧和其它帧共用序号
+            if self.rx_seq is not None and seq != (self.rx_seq + 1) & 0xFF:
+                self.lost += (seq - self.rx_seq - 1) & 0xFF
+                self.on_lost()
+            self.rx_seq = seq
+            if ftype == LOG:
+                self.on_log(payload)
+            else:
+                self.frames.append(item)
+        sys.stderr.flush()
+
+    def recv(self, timeout=2.0):
+        """返回下一帧 (类型, 序号, 数据)，超时返回 None"""
+        end = time.time() + timeout
+        while not self.frames:
+            if time.time() > end:
+                return None
+            self._feed(self.ser.read(4096))
+        return self.frames.pop(0)
+
+    def _done(self, ftype, seq, timeout):
+        """等 ftype/seq 的 DONE，返回状态，超时返回 None"""
+        end = time.time() + timeout
+        while True:
+            f = self.recv(max(0.0, end - time.time()))
+            if f is None:
+                return None
+            t, _, data = f
+            if t == DONE and data[0] == ftype and data[1] == seq:
+                return data[2]
+
+    def set_baud(self, baud):
+        """协商波特率：旧波特率下请求，切换后用同样的请求确认；失败切回原波特率"""
+        old = self.ser.baudrate
+        payload = struct.pack("<I", baud)
+        status = self._done(BAUD, self.send(BAUD, payload), 2.0)
+        if status is None:
+            raise TimeoutError("no reply to baud request")
+        if status:
+            raise RuntimeError("baud %d rejected: %s" % (baud, STATUS.get(status, status)))
+        # 等设备发完应答并切换(设备每10ms检查一次)
+        self.ser.flush()
+        time.sleep(0.03)
+        self.ser.baudrate = baud
+        self.ser.reset_input_buffer()
+        self.reader.reset()
+        self.rx_seq = None
+        self.on_lost()
+        # 设备等确认 1s，这里重试几次，切换时刻的乱码帧会被 CRC 挡掉
+        for _ in range(5):
+            if self._done(BAUD, self.send(BAUD, payload), 0.15) == 0:
+                return
+        self.ser.baudrate = old
+        self.ser.reset_input_buffer()
+        self.reader.reset()
+        self.rx_seq = None
+        self.on_lost()
+        raise RuntimeError("no confirmation at %d baud, back to %d" % (baud, old))
+
+    def request(self, ftype, payload, want):
+        """发请求，收集 want 类型的数据帧直到 DONE(或单帧应答)"""
+        seq = self.send(ftype, payload)
+        while True:
+            f = self.recv()
+            if f is None:
+                raise TimeoutError("no reply to request 0x%02X" % ftype)
+            t, _, data = f
+            if t == DONE and data[0] == ftype and data[1] == seq:
+                if data[2]:
+                    raise RuntimeError("request 0x%02X failed: %s" % (ftype, STATUS.get(data[2], data[2])))
+                return
+            if t == want:
+                yield data
+
+
+def cmd_ping(link, a):
+    seq = link.send(PING)
+    t0 = time.time()
+    while True:
+        f = link.recv()
+        if f is None:
+            sys.exit("no reply")
+        if f[0] == PONG and f[2][0] == seq:
+            print("pong: protocol v%d, %.1f ms" % (f[2][1], (time.time() - t0) * 1000))
+            return
+
+
+def cmd_flash(link, a):
+    addr, length = int(a.addr, 0), int(a.length, 0)
+    t0 = time.time()
+    got = 0
+    with open(a.out, "wb") as f:
+        for data in link.request(FLASH_READ, struct.pack("<II", addr, length), FLASH_DATA):
+            off, = struct.unpack_from("<I", data)
+            f.seek(off - addr)
+            f.write(data[4:])
+            got += len(data) - 4
+            sys.stderr.write("\r%d/%d bytes" % (got, length))
+    dt = time.time() - t0
+    print("\n%d bytes in %.2f s (%.0f B/s), %d frames lost" % (got, dt, got / dt if dt else 0, link.lost))
+
+
+def cmd_alarms(link, a):
+    link.send(ALARMS)
+    while True:
+        f = link.recv()
+        if f is None:
+            sys.exit("no reply")
+        if f[0] == ALARM_TABLE:
+            data = f[2]
+            for i in range(data[0]):
+                h, m, s, en, rep, days = data[1 + i * 6:7 + i * 6]
+                print("%d: %02d:%02d:%02d %s%s days=0x%02X" % (
+                    i, h, m, s, "on" if en else "off", " repeat" if rep else "", days))
+            return
+
+
+def write_png(path, w, h, rows):
+    """1位灰度 PNG，rows 为每行 w/8 字节，最高位在左"""
+    raw = b"".join(b"\0" + r for r in rows)
+
+    def chunk(tag, data):
+        c = tag + data
+        return struct.pack(">I", len(data)) + c + struct.pack(">I", zlib.crc32(c) & 0xFFFFFFFF)
+
+    with open(path, "wb") as f:
+        f.write(b"\x89PNG\r\n\x1a\n")
+        f.write(chunk(b"IHDR", struct.pack(">IIBBBBB", w, h, 1, 0, 0, 0, 0)))
+        f.write(chunk(b"IDAT", zlib.compress(raw)))
+        f.write(chunk(b"IEND", b""))
+
+
+def cmd_screen(link, a):
+    gram = bytearray(8 * 128)
+    for data in link.request(SCREEN, b"", SCREEN_DATA):
+        off, = struct.unpack_from("<H", data)
+        gram[off:off + len(data) - 2] = data[2:]
+    # 显存按页排列：每页8行，每字节一列，bit0在上
+    rows = []
+    for y in range(64):
+        row = bytearray(16)
+        for x in range(128):
+            if gram[(y // 8) * 128 + x] >> (y % 8) & 1:
+                row[x // 8] |= 0x80 >> (x % 8)
+        rows.append(bytes(row))
+    if a.out.lower().endswith(".pbm"):
+        with open(a.out, "wb") as f:
+            f.write(b"P4\n128 64\n" + b"".join(rows))
+    else:
+        # PNG 里 1 是白，点亮的像素显示成白色
+        write_png(a.out, 128, 64, rows)
+    print("saved", a.out)
+
+
+def cmd_sensor(link, a):
+    seq = link.send(SENSOR, struct.pack("<H", a.period))
+    n = 0
+    print("t_ms,ax,ay,az,steps")
+    try:
+        while a.count == 0 or n < a.count:
+            f = link.recv(timeout=max(2.0, a.period / 500))
+            if f is None:
+                break
+            t, _, data = f
+            if t == DONE and data[1] == seq and data[2]:
+                sys.exit("sensor stream failed: %s" % STATUS.get(data[2], data[2]))
+            if t == SENSOR_DATA:
+                print("%d,%d,%d,%d,%d" % struct.unpack("<IhhhI", data))
+                n += 1
+    except KeyboardInterrupt:
+        pass
+    link.send(SENSOR, struct.pack("<H", 0))
+    sys.stderr.write("%d samples, %d frames lost\n" % (n, link.lost))
+
+
+def main():
+    ap = argparse.ArgumentParser(description="USART1 二进制帧协议上位机")
+    ap.add_argument("-p", "--port", required=True)
+    ap.add_argument("-b", "--baud", type=int, default=115200, help="设备当前的波特率")
+    ap.add_argument("-B", "--fast", type=int, help="先协商到这个波特率，结束后切回 -b")
+    ap.add_argument("-e", "--elf", help="和固件同一次编译的 .axf/.elf，用来还原 LOG 帧")
+    sub = ap.add_subparsers(dest="cmd", required=True)
+    sub.add_parser("ping").set_defaults(fn=cmd_ping)
+    p = sub.add_parser("flash")
+    p.add_argument("addr")
+    p.add_argument("length")
+    p.add_argument("out")
+    p.set_defaults(fn=cmd_flash)
+    sub.add_parser("alarms").set_defaults(fn=cmd_alarms)
+    p = sub.add_parser("screen")
+    p.add_argument("out")
+    p.set_defaults(fn=cmd_screen)
+    p = sub.add_parser("sensor")
+    p.add_argument("period", type=int)
+    p.add_argument("-n", "--count", type=int, default=0)
+    p.set_defaults(fn=cmd_sensor)
+    a = ap.parse_args()
+    link = Link(a.port, a.baud)
+    if a.elf:
+        import log_decode
+        dec = log_decode.Decoder(log_decode.Elf(a.elf), sys.stderr)
+        link.on_log = dec.log_frame
+        link.on_lost = dec.resync
+    if a.fast:
+        try:
+            link.set_baud(a.fast)
+            sys.stderr.write("running at %d baud\n" % a.fast)
+        except (RuntimeError, TimeoutError) as e:
+            # 协商失败就用原波特率继续，只是慢一些
+            sys.stderr.write("%s\n" % e)
+    try:
+        a.fn(link, a)
+    finally:
+        if link.ser.baudrate != a.baud:
+            link.set_baud(a.baud)
+
+
+if __name__ == "__main__":
+    main()
@@ -9,135 +9,240 @@
 
 #include "uart_dma.h"
 #include "led.h"
+#include "ring.h"
+#include "cmd.h"
+#include "delay.h"
+#include "sched.h"
+#include "fmt.h"
 #include <string.h>
 #include <stdio.h>
 
 // ====================== 宏定义 ======================
 #ifndef UART_TX_BUF_SIZE
-#define UART_TX_BUF_SIZE 256  // 建议 ≥ 128，避免 printf 大量输出溢出
+#define UART_TX_BUF_SIZE 1024  // 建议 ≥ 128，避免 printf 大量输出溢出
+#endif
+
+#if !RING_SIZE_OK(UART_TX_BUF_SIZE)
+#error "UART_TX_BUF_SIZE must be a power of two"
+#endif
+
+#if !RING_SIZE_OK(UART_RX_BUF_SIZE)
+#error "UART_RX_BUF_SIZE must be a power of two"
 #endif
 
 // ====================== 全局变量 ======================
 /**
- * @brief DMA接收缓冲区
+ * @brief DMA循环接收缓冲区，DMA一直运行，不停也不重新装载
+ * @note HT/TC/IDLE 中断只发布DMA写到的位置(环形缓冲区的 head)，
+ *       拆行、解析都在主循环里从环形缓冲区读取
  */
-uint8_t rx_buffer[128] = {0};
+static uint8_t rx_buffer[UART_RX_BUF_SIZE] = {0};
+static Ring rx_ring = RING_INIT(rx_buffer, UART_RX_BUF_SIZE);
+static volatile uint32_t rx_count = 0;
+static volatile uint32_t rx_overruns = 0;   // 主循环来不及读、被DMA覆盖的次数
 
-/**
- * @brief DMA发送缓冲区（硬件DMA缓冲）
- */
-static uint8_t uart_dma_tx_buf[UART_TX_BUF_SIZE];
+void (*uart_rx_event_hook)(void) = 0;
 
 /**
- * @brief 环形发送缓冲区（非阻塞printf支持）
+ * @brief 环形发送缓冲区（非阻塞printf支持），DMA直接从这里读取
+ * @note 主循环写(生产者)，DMA中断读(消费者)，两边都不关中断
  */
 static uint8_t tx_ring_buf[UART_TX_BUF_SIZE] = {0};
-static volatile uint16_t tx_write_idx = 0;   // 生产者写
-static volatile uint16_t tx_read_idx  = 0;   // 消费者读
+static Ring tx_ring = RING_INIT(tx_ring_buf, UART_TX_BUF_SIZE);
+static volatile uint16_t tx_dma_len = 0;     // 正在发送的这一段的长度
 static volatile uint8_t  tx_busy = 0;        // DMA正在发送
 
 /**
- * @brief 命令接收缓冲区
+ * @brief printf 先攒成整行再按 printf_policy 写入环形缓冲区
  */
-static char usart_rx_buffer[64] = {0};
-static volatile uint16_t usart_rx_index = 0;
-static volatile uint8_t command_ready = 0;
-static volatile uint32_t rx_count = 0;
+static uint8_t tx_line_buf[UART_TX_LINE_MAX];
+static uint16_t tx_line_len = 0;
+static UartTxPolicy printf_policy = UART_TX_LINE;
 
-// ====================== 环形缓冲区工具函数 ======================
+static UartTxStats tx_stats;
 
 /**
- * @brief 判断环形缓冲区是否为空
+ * @brief 命令行拼装缓冲区(主循环使用)
  */
-static inline uint8_t ringbuf_is_empty(void)
-{
-    return tx_write_idx == tx_read_idx;
-}
+static char usart_rx_buffer[UART_RX_LINE_MAX] = {0};
+static uint16_t usart_rx_index = 0;
+static uint8_t command_ready = 0;
+static uint8_t rx_line_overflow = 0;     // 当前行超长，丢到行尾
+
+/**
+ * @brief 二进制帧拼装缓冲区：每帧以 0x00 开始、0x00 结束，中间交给 uart_rx_frame_hook
+ * @note 命令行文本里没有 0x00，两种数据可以在同一个串口上混用；
+ *       相邻两帧之间要有两个 0x00(上一帧的帧尾和下一帧的帧头)
+ */
+static uint8_t rx_frame_buf[UART_RX_FRAME_MAX];
+static uint16_t rx_frame_len = 0;
+static uint8_t rx_in_frame = 0;
+
+void (*uart_rx_frame_hook)(uint8_t *frame, uint16_t len) = 0;
+
+// ====================== DMA发送 ======================
 
 /**
- * @brief 判断环形缓冲区是否已满（牺牲1字节判满）
+ * @brief 启动DMA传输，直接发送环形缓冲区中从读下标开始的连续一段
+ * @note 只在 DMA2_Stream7 中断里调用，发送只有这一个消费者，不需要关中断；
+ *       数据跨过缓冲区末尾时只发到末尾，剩下的在传输完成中断里接着发
  */
-static inline uint8_t ringbuf_is_full(void)
+static void uart_start_dma_transfer(void)
 {
-    return ((tx_write_idx + 1) % UART_TX_BUF_SIZE) == tx_read_idx;
+    uint8_t *p;
+    uint16_t len;
+
+    if (tx_busy) {
+        return;
+    }
+    len = ring_peek(&tx_ring, &p);
+    if (len == 0) {
+        return;
+    }
+
+    tx_dma_len = len;
+    tx_busy = 1;
+
+    // 正常模式下上一次传输完成后EN已由硬件清零，清掉标志即可重新启动
+    DMA_ClearFlag(DMA2_Stream7, DMA_FLAG_TCIF7 | DMA_FLAG_HTIF7 | DMA_FLAG_TEIF7 |
+                                DMA_FLAG_DMEIF7 | DMA_FLAG_FEIF7);
+    DMA_MemoryTargetConfig(DMA2_Stream7, (uint32_t)p, DMA_Memory_0);
+    DMA_SetCurrDataCounter(DMA2_Stream7, len);
+    DMA_Cmd(DMA2_Stream7, ENABLE);
+    USART_DMACmd(USART1, USART_DMAReq_Tx, ENABLE);
 }
 
 /**
- * @brief 计算环形缓冲区中可读数据量
+ * @brief 通知发送中断有新数据
+ * @note 软件挂起 DMA2_Stream7 中断，由中断启动传输；DMA忙时传输完成中断会接着发
  */
-static uint16_t ringbuf_available(void)
+static inline void uart_tx_kick(void)
 {
-    uint16_t w = tx_write_idx, r = tx_read_idx;
-    return (w >= r) ? (w - r) : (UART_TX_BUF_SIZE - r + w);
+    if (!tx_busy) {
+        NVIC_SetPendingIRQ(DMA2_Stream7_IRQn);
+    }
 }
 
+// ====================== 溢出策略 ======================
+
 /**
- * @brief 计算环形缓冲区中剩余空间（最大可写入字节数）
+ * @brief 记录丢弃的数据，行数按丢掉的换行计
  */
-/*
-static uint16_t ringbuf_free_space(void)
+static void uart_tx_count_drop(const uint8_t *data, uint16_t len)
 {
-    // 总空间 = SIZE - 1（1字节用于判满）
-    return (UART_TX_BUF_SIZE - 1) - ringbuf_available();
+    tx_stats.bytes_dropped += len;
+    while (len--) {
+        if (*data++ == '\n') {
+            tx_stats.lines_dropped++;
+        }
+    }
 }
-*/
 
 /**
- * @brief 环形缓冲区写入1字节（内部调用，**调用前需关中断**）
- * @return 1 成功，0 失败（满）
+ * @brief 丢弃最旧的数据，直到空闲空间不小于 need，并丢到行尾为止
+ * @note 生产者在这里临时充当消费者：先屏蔽 DMA 中断并停下正在进行的传输，
+ *       已经发出去的部分正常释放，剩下的才能丢弃
  */
-static uint8_t ringbuf_write_byte(uint8_t byte)
+static void uart_tx_drop_oldest(uint16_t need)
 {
-    if (ringbuf_is_full()) {
-        return 0; // 满，丢弃（可改策略）
+    uint8_t *p;
+    uint16_t n, i;
+    uint8_t line_end = 0;
+    uint8_t prev = '\n';
+
+    NVIC_DisableIRQ(DMA2_Stream7_IRQn);
+    if (tx_busy) {
+        DMA_Cmd(DMA2_Stream7, DISABLE);
+        while (DMA_GetCmdStatus(DMA2_Stream7) != DISABLE);
+        USART_DMACmd(USART1, USART_DMAReq_Tx, DISABLE);
+        ring_skip(&tx_ring, tx_dma_len - DMA_GetCurrDataCounter(DMA2_Stream7));
+        tx_busy = 0;
+
+        // 停流也会置 TCIF，不清掉的话中断里会再释放一次
+        DMA_ClearFlag(DMA2_Stream7, DMA_FLAG_TCIF7 | DMA_FLAG_HTIF7 | DMA_FLAG_TEIF7 |
+                                    DMA_FLAG_DMEIF7 | DMA_FLAG_FEIF7);
+        NVIC_ClearPendingIRQ(DMA2_Stream7_IRQn);
+    }
+
+    // 先丢够空间，再丢到下一个换行，避免留下半行
+    while (!line_end && (n = ring_peek(&tx_ring, &p)) > 0) {
+        for (i = 0; i < n; i++) {
+            if (ring_free(&tx_ring) + i >= need && prev == '\n') {
+                line_end = 1;
+                break;
+            }
+            prev = p[i];
+        }
+        uart_tx_count_drop(p, i);
+        ring_skip(&tx_ring, i);
     }
-    tx_ring_buf[tx_write_idx] = byte;
-    tx_write_idx = (tx_write_idx + 1) % UART_TX_BUF_SIZE;
-    return 1;
+
+    NVIC_EnableIRQ(DMA2_Stream7_IRQn);
 }
 
 /**
- * @brief 启动DMA传输（从环形缓冲区搬运数据到DMA硬件缓冲并启动发送）
- * @note 必须在关中断或确定无竞争时调用（如 ISR 或关中断后）
+ * @brief 按策略写入环形缓冲区并启动发送
+ * @return 实际写入的字节数
  */
-static void uart_start_dma_transfer(void)
+static uint16_t uart_tx_write(const uint8_t *data, uint16_t len, UartTxPolicy policy)
 {
-    if (tx_busy || ringbuf_is_empty()) {
-        return;
-    }
+    uint16_t n, used;
+    uint32_t start;
 
-    uint16_t len = 0;
-    uint16_t r = tx_read_idx;
-    uint16_t w = tx_write_idx;
-
-    if (w > r) {
-        len = w - r;
-        memcpy(uart_dma_tx_buf, &tx_ring_buf[r], len);
-    } else if (w < r) {
-        uint16_t part1 = UART_TX_BUF_SIZE - r;
-        memcpy(uart_dma_tx_buf, &tx_ring_buf[r], part1);
-        len = part1;
-        if (w > 0) {
-            memcpy(&uart_dma_tx_buf[part1], tx_ring_buf, w);
-            len += w;
+    switch (policy) {
+    case UART_TX_DROP_OLDEST:
+        if (ring_free(&tx_ring) < len) {
+            uart_tx_drop_oldest(len);
         }
-    } else {
-        return; // empty
+        break;
+
+    case UART_TX_BLOCK:
+        start = get_systick();
+        while (ring_free(&tx_ring) < len && len <= UART_TX_BUF_SIZE) {
+            if (get_systick() - start >= UART_TX_BLOCK_TIMEOUT_MS) {
+                tx_stats.block_timeouts++;
+                break;
+            }
+            uart_tx_kick();
+        }
+        break;
+
+    case UART_TX_LINE:
+        if (ring_free(&tx_ring) < len) {
+            uart_tx_count_drop(data, len);
+            uart_tx_kick();
+            return 0;
+        }
+        break;
+
+    default:
+        break;
     }
 
-    // 更新读指针（必须在 memcpy 后）
-    tx_read_idx = (r + len) % UART_TX_BUF_SIZE;
+    // 其余情况都是写能放下的部分
+    n = ring_write(&tx_ring, data, len);
+    if (n < len) {
+        uart_tx_count_drop(data + n, len - n);
+    }
 
-    // 安全禁用DMA（先清除标志，再禁用）
-    DMA_ClearITPendingBit(DMA2_Stream7, DMA_IT_TCIF7);
-    DMA_Cmd(DMA2_Stream7, DISABLE);
-    while (DMA2_Stream7->CR & DMA_SxCR_EN); // 等待真正禁用
+    used = ring_count(&tx_ring);
+    if (used > tx_stats.high_water) {
+        tx_stats.high_water = used;
+    }
 
-    // 设置新传输长度并启动
-    DMA_SetCurrDataCounter(DMA2_Stream7, len);
-    DMA_Cmd(DMA2_Stream7, ENABLE);
-    USART_DMACmd(USART1, USART_DMAReq_Tx, ENABLE);
-    tx_busy = 1;
+    uart_tx_kick();
+    return n;
+}
+
+/**
+ * @brief 把 printf 攒下的内容按 printf_policy 写入
+ */
+static void uart_tx_flush_line(void)
+{
+    if (tx_line_len) {
+        uart_tx_write(tx_line_buf, tx_line_len, printf_policy);
+        tx_line_len = 0;
+    }
 }
 
 // ====================== 公共函数 ======================
@@ -150,35 +255,47 @@ void printf_array(uint8_t *arr, uint16_t len)
     printf("\n");
 }
 
+/**
+ * @brief 发布DMA已经写到的位置
+ * @note USART1 和 DMA2_Stream5 中断优先级相同、互不打断，对环形缓冲区来说仍是单生产者；
+ *       HT/TC 保证每半个缓冲区至少发布一次，两次发布之间不会转过一整圈
+ */
+static void uart_rx_publish(void)
+{
+    uint16_t pos = UART_RX_BUF_SIZE - DMA_GetCurrDataCounter(DMA2_Stream5);
+    uint16_t n = (uint16_t)(pos - rx_ring.head) & rx_ring.mask;
+
+    if (n == 0) {
+        return;
+    }
+    rx_count += n;
+    ring_commit(&rx_ring, n);
+    if (uart_rx_event_hook) {
+        uart_rx_event_hook();
+    }
+}
+
 void USART1_IRQHandler(void)
 {
     if (USART_GetITStatus(USART1, USART_IT_IDLE) == SET) {
         volatile uint16_t temp;
         temp = USART1->SR;
         temp = USART1->DR;
+        (void)temp;
 
-        DMA_Cmd(DMA2_Stream5, DISABLE);
-        uint16_t recv_len = sizeof(rx_buffer) - DMA_GetCurrDataCounter(DMA2_Stream5);
-        if (recv_len == 0) recv_len = sizeof(rx_buffer);
-
-        for (uint16_t i = 0; i < recv_len; i++) {
-            uint8_t ch = rx_buffer[i];
-            rx_count++;
-
-            if (ch == '\r' || ch == '\n') {
-                if (usart_rx_index > 0) {
-                    usart_rx_buffer[usart_rx_index] = '\0';
-                    command_ready = 1;
-                    usart_rx_index = 0;
-                }
-            } else if (usart_rx_index < sizeof(usart_rx_buffer) - 1) {
-                usart_rx_buffer[usart_rx_index++] = ch;
-            }
-        }
+        uart_rx_publish();
+    }
+}
 
-        DMA_SetCurrDataCounter(DMA2_Stream5, sizeof(rx_buffer));
-        DMA_Cmd(DMA2_Stream5, ENABLE);
+void DMA2_Stream5_IRQHandler(void)
+{
+    if (DMA_GetITStatus(DMA2_Stream5, DMA_IT_HTIF5) != RESET) {
+        DMA_ClearITPendingBit(DMA2_Stream5, DMA_IT_HTIF5);
     }
+    if (DMA_GetITStatus(DMA2_Stream5, DMA_IT_TCIF5) != RESET) {
+        DMA_ClearITPendingBit(DMA2_Stream5, DMA_IT_TCIF5);
+    }
+    uart_rx_publish();
 }
 
 void DMA2_Stream7_IRQHandler(void)
@@ -186,17 +303,15 @@ void DMA2_Stream7_IRQHandler(void)
     if (DMA_GetITStatus(DMA2_Stream7, DMA_IT_TCIF7) != RESET) {
         DMA_ClearITPendingBit(DMA2_Stream7, DMA_IT_TCIF7);
         
-        DMA_Cmd(DMA2_Stream7, DISABLE);
         USART_DMACmd(USART1, USART_DMAReq_Tx, DISABLE);
-        tx_busy = 0;
 
-        // 关中断保护：防止写入与读取冲突
-        __disable_irq();
-        if (!ringbuf_is_empty()) {
-            uart_start_dma_transfer();
-        }
-        __enable_irq();
+        // 这一段发完才释放它占用的缓冲区
+        ring_skip(&tx_ring, tx_dma_len);
+        tx_busy = 0;
     }
+
+    // 接着发剩下的(包括跨过缓冲区末尾的部分)；uart_tx_kick() 挂起的中断也走这里
+    uart_start_dma_transfer();
 }
 
 static void usart1_init(void)
@@ -218,7 +333,7 @@ static void usart1_init(void)
     GPIO_PinAFConfig(GPIOA, GPIO_PinSource9, GPIO_AF_USART1);
     GPIO_PinAFConfig(GPIOA, GPIO_PinSource10, GPIO_AF_USART1);
 
-    USART_InitStruct.USART_BaudRate = 115200;
+    USART_InitStruct.USART_BaudRate = UART_BAUD_DEFAULT;
     USART_InitStruct.USART_WordLength = USART_WordLength_8b;
     USART_InitStruct.USART_StopBits = USART_StopBits_1;
     USART_InitStruct.USART_Parity = USART_Parity_No;
@@ -237,9 +352,137 @@ static void usart1_init(void)
     USART_Cmd(USART1, ENABLE);
 }
 
+// ====================== 波特率 ======================
+
+/// 协商状态：先等应答发完再切换，切换后等主机确认，超时切回原来的波特率
+enum { BAUD_IDLE = 0, BAUD_DRAIN, BAUD_WAIT };
+
+static uint32_t uart_baud = UART_BAUD_DEFAULT;
+static uint32_t baud_target = 0;
+static uint32_t baud_prev = 0;
+static uint32_t baud_deadline = 0;
+static uint8_t baud_state = BAUD_IDLE;
+static uint8_t baud_task_id = SCHED_INVALID;
+
+// 算出 BRR 对应的分频值；做不到或误差超过 UART_BAUD_ERR_PERMILLE 返回1
+static uint8_t uart_baud_div(uint32_t baud, uint32_t *div)
+{
+    RCC_ClocksTypeDef clocks;
+    uint32_t actual, err;
+
+    if (baud == 0) {
+        return 1;
+    }
+    // 16倍和8倍过采样下 BRR 对应的分频值都是 PCLK2/波特率，差别只在小数位数
+    RCC_GetClocksFreq(&clocks);
+    *div = (clocks.PCLK2_Frequency + baud / 2) / baud;
+    if (*div < 8 || *div > 0xFFFF) {
+        return 1;
+    }
+    actual = clocks.PCLK2_Frequency / *div;
+    err = actual > baud ? actual - baud : baud - actual;
+    return (uint64_t)err * 1000 > (uint64_t)baud * UART_BAUD_ERR_PERMILLE;
+}
+
+uint8_t uart_set_baud(uint32_t baud)
+{
+    uint32_t div;
+
+    if (uart_baud_div(baud, &div)) {
+        return 1;
+    }
+
+    USART_Cmd(USART1, DISABLE);
+    if (div < 16) {
+        // 分频不到16只能用8倍过采样(最高 PCLK2/8)，抗噪能力差一些，所以只在需要时用
+        USART_OverSampling8Cmd(USART1, ENABLE);
+        USART1->BRR = (uint16_t)(((div & ~7u) << 1) | (div & 7u));
+    } else {
+        USART_OverSampling8Cmd(USART1, DISABLE);
+        USART1->BRR = (uint16_t)div;
+    }
+    USART_Cmd(USART1, ENABLE);
+    uart_baud = baud;
+
+    // 切换过程中收到的半行/半帧是乱码，丢掉
+    usart_rx_index = 0;
+    rx_line_overflow = 0;
+    rx_in_frame = 0;
+    rx_frame_len = 0;
+    return 0;
+}
+
+uint32_t uart_get_baud(void)
+{
+    return uart_baud;
+}
+
+static void uart_baud_stop(void)
+{
+    Sched_Cancel(baud_task_id);
+    baud_task_id = SCHED_INVALID;
+    baud_state = BAUD_IDLE;
+}
+
+static void uart_baud_task(void)
+{
+    if (baud_state == BAUD_DRAIN) {
+        if (uart_tx_idle()) {
+            // 应答已经按原波特率完整发出，现在切换
+            uart_set_baud(baud_target);
+            baud_state = BAUD_WAIT;
+            baud_deadline = get_systick() + UART_BAUD_CONFIRM_MS;
+        } else if ((int32_t)(get_systick() - baud_deadline) >= 0) {
+            // 发送一直停不下来，不切换；主机收不到确认应答会自己切回去
+            uart_baud_stop();
+            printf("baud: tx busy, staying at %lu\r\n", (unsigned long)uart_baud);
+        }
+    } else if (baud_state == BAUD_WAIT) {
+        if ((int32_t)(get_systick() - baud_deadline) >= 0) {
+            uart_baud_stop();
+            uart_set_baud(baud_prev);
+            printf("baud: not confirmed, back to %lu\r\n", (unsigned long)uart_baud);
+        }
+    }
+}
+
+uint8_t uart_baud_begin(uint32_t baud)
+{
+    uint32_t div;
+
+    if (baud_state == BAUD_WAIT || uart_baud_div(baud, &div)) {
+        return 1;
+    }
+
+    baud_prev = uart_baud;
+    baud_target = baud;
+    baud_state = BAUD_DRAIN;
+    baud_deadline = get_systick() + UART_BAUD_CONFIRM_MS;
+    if (baud_task_id == SCHED_INVALID) {
+        baud_task_id = Sched_Add_Periodic(uart_baud_task, UART_BAUD_POLL_MS);
+        if (baud_task_id == SCHED_INVALID) {
+            baud_state = BAUD_IDLE;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+uint8_t uart_baud_confirm(uint32_t baud)
+{
+    if (baud != uart_baud || baud_state == BAUD_DRAIN) {
+        return 1;
+    }
+    if (baud_state == BAUD_WAIT) {
+        uart_baud_stop();
+    }
+    return 0;
+}
+
 void usart1_dma_rx_init(void)
 {
     DMA_InitTypeDef DMA_InitStruct;
+    NVIC_InitTypeDef NVIC_InitStruct;
     RCC_AHB1PeriphClockCmd(RCC_AHB1Periph_DMA2, ENABLE);
     usart1_init();
 
@@ -258,6 +501,16 @@ void usart1_dma_rx_init(void)
     DMA_InitStruct.DMA_FIFOMode = DMA_FIFOMode_Disable;
     DMA_Init(DMA2_Stream5, &DMA_InitStruct);
 
+    // 半满/全满各发布一次，长数据流不必等 IDLE
+    DMA_ITConfig(DMA2_Stream5, DMA_IT_HT | DMA_IT_TC, ENABLE);
+
+    // 和 USART1 中断同一抢占优先级，两个发布者不会互相打断
+    NVIC_InitStruct.NVIC_IRQChannel = DMA2_Stream5_IRQn;
+    NVIC_InitStruct.NVIC_IRQChannelPreemptionPriority = 1;
+    NVIC_InitStruct.NVIC_IRQChannelSubPriority = 3;
+    NVIC_InitStruct.NVIC_IRQChannelCmd = ENABLE;
+    NVIC_Init(&NVIC_InitStruct);
+
     DMA_Cmd(DMA2_Stream5, ENABLE);
     USART_DMACmd(USART1, USART_DMAReq_Rx, ENABLE);
 }
@@ -270,7 +523,7 @@ void usart1_dma_tx_init(void)
     DMA_StructInit(&DMA_InitStruct);
     DMA_InitStruct.DMA_Channel = DMA_Channel_4;
     DMA_InitStruct.DMA_PeripheralBaseAddr = (uint32_t)&USART1->DR;
-    DMA_InitStruct.DMA_Memory0BaseAddr = (uint32_t)uart_dma_tx_buf;
+    DMA_InitStruct.DMA_Memory0BaseAddr = (uint32_t)tx_ring_buf;
     DMA_InitStruct.DMA_DIR = DMA_DIR_MemoryToPeripheral;
     DMA_InitStruct.DMA_BufferSize = 0;
     DMA_InitStruct.DMA_PeripheralInc = DMA_PeripheralInc_Disable;
@@ -295,20 +548,21 @@ void usart1_dma_tx_init(void)
 
 void Usart1_Send_DMA(uint8_t *data, uint16_t len)
 {
-    __disable_irq();
-    for (uint16_t i = 0; i < len; i++) {
-        // 不死等：若满则丢弃（或可加超时）
-        if (!ringbuf_write_byte(data[i])) {
-            // 可选：记录丢包统计
-        }
-    }
-    __enable_irq();
+    // 不死等：放不下的部分丢弃
+    uart_tx_write(data, len, UART_TX_DROP_NEWEST);
+}
 
-    if (!tx_busy) {
-        __disable_irq();
-        uart_start_dma_transfer();
-        __enable_irq();
-    }
+uint16_t Usart1_Send_Policy(const uint8_t *data, uint16_t len, UartTxPolicy policy)
+{
+    // 先把 printf 攒的半行送出去，保持先后顺序
+    uart_tx_flush_line();
+    return uart_tx_write(data, len, policy);
+}
+
+void uart_set_printf_policy(UartTxPolicy policy)
+{
+    uart_tx_flush_line();
+    printf_policy = policy;
 }
 
 void Usart1_Send_String(char *string)
@@ -328,88 +582,236 @@ uint32_t get_usart_rx_count(void)
     return rx_count;
 }
 
+uint16_t uart_rx_available(void)
+{
+    uint16_t n = ring_count(&rx_ring);
+
+    // 积压超过一整圈说明最旧的数据已被DMA覆盖，跳到还完整的部分
+    if (n > UART_RX_BUF_SIZE) {
+        ring_skip(&rx_ring, n - UART_RX_BUF_SIZE);
+        rx_overruns++;
+        n = UART_RX_BUF_SIZE;
+    }
+    return n;
+}
+
+uint16_t uart_rx_read(uint8_t *buf, uint16_t len)
+{
+    uart_rx_available();
+    return ring_read(&rx_ring, buf, len);
+}
+
+uint32_t get_usart_rx_overruns(void)
+{
+    return rx_overruns;
+}
+
+/**
+ * @brief 从接收环形缓冲区拼一行命令，拼好后停下等取走
+ */
+static void uart_rx_poll_line(void)
+{
+    uint8_t *p;
+    uint16_t n, i;
+
+    while (!command_ready && uart_rx_available()) {
+        n = ring_peek(&rx_ring, &p);
+        for (i = 0; i < n && !command_ready; i++) {
+            uint8_t ch = p[i];
+
+            if (ch == 0x00) {
+                // 帧定界符：帧外遇到是帧头，帧内遇到是帧尾(空帧当作帧头)
+                if (rx_in_frame && rx_frame_len > 0) {
+                    if (rx_frame_len <= sizeof(rx_frame_buf) && uart_rx_frame_hook) {
+                        uart_rx_frame_hook(rx_frame_buf, rx_frame_len);
+                    }
+                    rx_in_frame = 0;
+                } else {
+                    rx_in_frame = 1;
+                    usart_rx_index = 0;
+                }
+                rx_frame_len = 0;
+            } else if (rx_in_frame) {
+                // 超长的帧只计长度，结束时整帧丢弃
+                if (rx_frame_len < sizeof(rx_frame_buf)) {
+                    rx_frame_buf[rx_frame_len] = ch;
+                }
+                if (rx_frame_len <= sizeof(rx_frame_buf)) {
+                    rx_frame_len++;
+                }
+            } else if (ch == '\r' || ch == '\n') {
+                if (usart_rx_index > 0 && !rx_line_overflow) {
+                    usart_rx_buffer[usart_rx_index] = '\0';
+                    command_ready = 1;
+                }
+                usart_rx_index = 0;
+                rx_line_overflow = 0;
+            } else if (usart_rx_index < sizeof(usart_rx_buffer) - 1) {
+                usart_rx_buffer[usart_rx_index++] = ch;
+            } else {
+                // 超长的行整行丢弃，不把截断的命令当真执行
+                rx_line_overflow = 1;
+            }
+        }
+        ring_skip(&rx_ring, i);
+    }
+}
+
 uint8_t is_command_ready(void)
 {
+    uart_rx_poll_line();
     return command_ready;
 }
 
 uint8_t Usart1_Receive_String(char *buffer, uint16_t size)
 {
+    uart_rx_poll_line();
     if (command_ready && buffer && size > 0) {
         uint16_t len = strlen(usart_rx_buffer);
         if (len < size) {
-            strcpy(buffer, usart_rx_buffer);
+            memcpy(buffer, usart_rx_buffer, len + 1);
             command_ready = 0;
-            // 更高效：只清已用部分
-            memset(usart_rx_buffer, 0, len + 1);
             return 1;
         }
     }
     return 0;
 }
 
+// ====================== 串口命令 ======================
+
+// led <0-3|all> <on|off|toggle>
+static void cmd_led(uint8_t argc, char *argv[])
+{
+    uint32_t n = 0;
+    uint8_t all;
+
+    if (argc < 3) {
+        printf("usage: led <0-3|all> <on|off|toggle>\r\n");
+        return;
+    }
+    all = strcmp(argv[1], "all") == 0;
+    if (!all && (Cmd_Arg_U32(argv[1], &n) || n > 3)) {
+        printf("bad led %s\r\n", argv[1]);
+        return;
+    }
+
+    if (strcmp(argv[2], "on") == 0) {
+        all ? LED_Set_All(0) : LED_Set(n, 0);
+    } else if (strcmp(argv[2], "off") == 0) {
+        all ? LED_Set_All(1) : LED_Set(n, 1);
+    } else if (strcmp(argv[2], "toggle") == 0 && !all) {
+        LED_Toggle(n);
+    } else {
+        printf("bad state %s\r\n", argv[2]);
+        return;
+    }
+    if (all) {
+        printf("ALL LEDS %s\r\n", argv[2][1] == 'n' ? "ON" : "OFF");
+    } else {
+        printf("LED%lu %s\r\n", (unsigned long)n,
+               argv[2][0] == 't' ? "toggled" : argv[2][1] == 'n' ? "ON" : "OFF");
+    }
+}
+
+// 旧写法 led0 on / all off，argv[0] 里带着编号
+static void cmd_led_legacy(uint8_t argc, char *argv[])
+{
+    char num[2] = { argv[0][3], '\0' };
+    char *args[3] = { "led", num, argc > 1 ? argv[1] : "" };
+
+    if (argv[0][0] == 'a') {
+        args[1] = "all";
+    }
+    cmd_led(3, args);
+}
+
+// 旧写法 0c~3c：翻转LED
+static void cmd_led_toggle(uint8_t argc, char *argv[])
+{
+    char num[2] = { argv[0][0], '\0' };
+    char *args[3] = { "led", num, "toggle" };
+
+    (void)argc;
+    cmd_led(3, args);
+}
+
+static void cmd_help(uint8_t argc, char *argv[])
+{
+    (void)argc;
+    (void)argv;
+    Cmd_Help();
+}
+
+static void cmd_txstat(uint8_t argc, char *argv[])
+{
+    UartTxStats st;
+
+    if (argc > 1 && strcmp(argv[1], "reset") == 0) {
+        uart_reset_tx_stats();
+        printf("txstat reset\r\n");
+        return;
+    }
+    uart_get_tx_stats(&st);
+    printf("tx buf %u/%u, high water %u\r\n",
+           uart_get_tx_buf_usage(), UART_TX_BUF_SIZE, st.high_water);
+    printf("dropped %lu bytes, %lu lines, %lu block timeouts\r\n",
+           (unsigned long)st.bytes_dropped, (unsigned long)st.lines_dropped,
+           (unsigned long)st.block_timeouts);
+}
+
+// baud [rate|ok]：切换后在新波特率下发 "baud ok" 确认，否则 UART_BAUD_CONFIRM_MS 后切回
+static void cmd_baud(uint8_t argc, char *argv[])
+{
+    uint32_t baud;
+
+    if (argc < 2) {
+        printf("baud %lu\r\n", (unsigned long)uart_get_baud());
+        return;
+    }
+    if (strcmp(argv[1], "ok") == 0) {
+        if (uart_baud_confirm(uart_get_baud())) {
+            printf("baud: nothing to confirm\r\n");
+        } else {
+            printf("baud %lu ok\r\n", (unsigned long)uart_get_baud());
+        }
+        return;
+    }
+    if (Cmd_Arg_U32(argv[1], &baud) || uart_baud_begin(baud)) {
+        printf("baud: %s not supported\r\n", argv[1]);
+        return;
+    }
+    printf("baud: switching to %lu, send 'baud ok' within %u ms\r\n",
+           (unsigned long)baud, UART_BAUD_CONFIRM_MS);
+}
 
-//对收到的指令判别
+static const Cmd uart_cmds[] = {
+    { "baud",   cmd_baud,       "baud [rate|ok] - Show/switch USART1 baud rate" },
+    { "help",   cmd_help,       "help - List commands" },
+    { "led",    cmd_led,        "led <0-3|all> <on|off|toggle> - Control LEDs" },
+    { "led0",   cmd_led_legacy, NULL },
+    { "led1",   cmd_led_legacy, NULL },
+    { "led2",   cmd_led_legacy, NULL },
+    { "led3",   cmd_led_legacy, NULL },
+    { "all",    cmd_led_legacy, NULL },
+    { "0c",     cmd_led_toggle, NULL },
+    { "1c",     cmd_led_toggle, NULL },
+    { "2c",     cmd_led_toggle, NULL },
+    { "3c",     cmd_led_toggle, NULL },
+    { "txstat", cmd_txstat,     "txstat [reset] - Show/clear UART TX drop statistics" },
+};
+
+//对收到的指令判别，命令由各模块通过 Cmd_Register() 登记
+//一次把已收到的命令全部执行完，粘贴多行脚本时不必每50ms才执行一行
 void Process_Usart_Command(void)
 {
-    char cmd[64];
-    if (Usart1_Receive_String(cmd, sizeof(cmd))) {
+    char cmd[UART_RX_LINE_MAX];
+    while (Usart1_Receive_String(cmd, sizeof(cmd))) {
         for (int i = 0; cmd[i]; i++) {
             if (cmd[i] >= 'A' && cmd[i] <= 'Z')
                 cmd[i] += 32;
         }
 
-        if (strcmp(cmd, "led0 on") == 0) {
-            LED0 = 0;
-            printf("LED0 ON\r\n");
-        } else if (strcmp(cmd, "led0 off") == 0) {
-            LED0 = 1;
-            printf("LED0 OFF\r\n");
-        } else if (strcmp(cmd, "led1 on") == 0) {
-            LED1 = 0;
-            printf("LED1 ON\r\n");
-        } else if (strcmp(cmd, "led1 off") == 0) {
-            LED1 = 1;
-            printf("LED1 OFF\r\n");
-        } else if (strcmp(cmd, "led2 on") == 0) {
-            LED2 = 0;
-            printf("LED2 ON\r\n");
-        } else if (strcmp(cmd, "led2 off") == 0) {
-            LED2 = 1;
-            printf("LED2 OFF\r\n");
-        } else if (strcmp(cmd, "led3 on") == 0) {
-            LED3 = 0;
-            printf("LED3 ON\r\n");
-        } else if (strcmp(cmd, "led3 off") == 0) {
-            LED3 = 1;
-            printf("LED3 OFF\r\n");
-        } else if (strcmp(cmd, "all on") == 0) {
-            LED0 = LED1 = LED2 = LED3 = 0;
-            printf("ALL LEDS ON\r\n");
-        } else if (strcmp(cmd, "all off") == 0) {
-            LED0 = LED1 = LED2 = LED3 = 1;
-            printf("ALL LEDS OFF\r\n");
-        } else if (strcmp(cmd, "help") == 0) {
-            printf("Commands:\r\n"
-                   "led0/1/2/3 on/off - Control individual LED\r\n"
-                   "all on/off - Control all LEDs\r\n"
-                   "0c/1c/2c/3c - Toggle LED state\r\n");
-        } else if (strcmp(cmd, "0c") == 0) {
-            LED0 = !LED0;
-            printf("LED0 toggled\r\n");
-        } else if (strcmp(cmd, "1c") == 0) {
-            LED1 = !LED1;
-            printf("LED1 toggled\r\n");
-        } else if (strcmp(cmd, "2c") == 0) {
-            LED2 = !LED2;
-            printf("LED2 toggled\r\n");
-        } else if (strcmp(cmd, "3c") == 0) {
-            LED3 = !LED3;
-            printf("LED3 toggled\r\n");
-        } else if (strcmp(cmd, "get time") == 0) {
-            
-           RTC_Date_Get();
-        } else {
+        if (Cmd_Exec(cmd)) {
             printf("Unknown command. Type 'help'\r\n");
         }
     }
@@ -419,47 +821,84 @@ void debug_init(void)
 {
     usart1_dma_rx_init();
     usart1_dma_tx_init();
+    Cmd_Register(uart_cmds, CMD_COUNT(uart_cmds));
 }
 
-int fputc(int ch, FILE *f)
+// printf 和 uart_printf 的每个字符都从这里进行缓冲
+static void uart_putc(void *ctx, char ch)
 {
-    uint8_t byte = (uint8_t)ch;
-
+    (void)ctx;
     // 自动补 \r（常见于串口终端）
-    if (byte == '\n') {
-        __disable_irq();
-        ringbuf_write_byte('\r');
-        __enable_irq();
+    if (ch == '\n' && tx_line_len + 2 > UART_TX_LINE_MAX) {
+        uart_tx_flush_line();
     }
-
-    __disable_irq();
-    uint8_t ok = ringbuf_write_byte(byte);
-    __enable_irq();
-
-    if (!ok) {
-        // 可选：记录发送失败
-        return -1;
+    if (ch == '\n') {
+        tx_line_buf[tx_line_len++] = '\r';
     }
+    tx_line_buf[tx_line_len++] = (uint8_t)ch;
 
-    if (!tx_busy) {
-        __disable_irq();
-        uart_start_dma_transfer();
-        __enable_irq();
+    // 满一行(或攒满)才写入，整行按同一个策略处理
+    if (ch == '\n' || tx_line_len >= UART_TX_LINE_MAX) {
+        uart_tx_flush_line();
     }
+}
 
+int fputc(int ch, FILE *f)
+{
+    (void)f;
+    uart_putc(0, (char)ch);
     return ch;
 }
 
+int uart_vprintf(const char *fmt, va_list ap)
+{
+    return Fmt_Format(uart_putc, 0, fmt, ap);
+}
+
+int uart_printf(const char *fmt, ...)
+{
+    va_list ap;
+    int n;
+
+    va_start(ap, fmt);
+    n = uart_vprintf(fmt, ap);
+    va_end(ap);
+    return n;
+}
+
 void uart_tx_task(void)
 {
-    if (!tx_busy && !ringbuf_is_empty()) {
-        __disable_irq();
-        uart_start_dma_transfer();
-        __enable_irq();
+    // 不带换行的提示符之类也要送出去
+    uart_tx_flush_line();
+    if (!ring_is_empty(&tx_ring)) {
+        uart_tx_kick();
     }
 }
 
 uint16_t uart_get_tx_buf_usage(void)
 {
-    return ringbuf_available();
+    return ring_count(&tx_ring);
+}
+
+uint16_t uart_tx_free(void)
+{
+    return ring_free(&tx_ring);
+}
+
+void uart_get_tx_stats(UartTxStats *stats)
+{
+    *stats = tx_stats;
+}
+
+void uart_reset_tx_stats(void)
+{
+    memset(&tx_stats, 0, sizeof(tx_stats));
+    tx_stats.high_water = ring_count(&tx_ring);
+}
+
+uint8_t uart_tx_idle(void)
+{
+    // DMA传输完成后最后一个字节还在移位寄存器里，要等 TC 置位
+    return !tx_busy && tx_line_len == 0 && ring_is_empty(&tx_ring) &&
+           USART_GetFlagStatus(USART1, USART_FLAG_TC) != RESET;
 }
@@ -16,14 +16,77 @@ extern "C" {
 
 #include "stm32f4xx.h"
 #include <stdio.h>
+#include <stdarg.h>
 #include "rtc_date.h"
 // =============================================================================
 // 配置宏（可在外层定义覆盖，默认值合理）
 // =============================================================================
 #ifndef UART_TX_BUF_SIZE
-#define UART_TX_BUF_SIZE    256   ///< 环形发送缓冲区大小（建议 ≥ 128），注意：实际可用空间为 UART_TX_BUF_SIZE - 1
+#define UART_TX_BUF_SIZE    1024  ///< 环形发送缓冲区大小（2的幂，建议 ≥ 128）；二进制批量传输按线速发送需要能放下几帧
 #endif
 
+#ifndef UART_RX_BUF_SIZE
+#define UART_RX_BUF_SIZE    1024  ///< DMA循环接收缓冲区大小（2的幂），主循环两次读取之间最多能积压这么多
+#endif
+
+#ifndef UART_RX_LINE_MAX
+#define UART_RX_LINE_MAX    128   ///< 一行命令的最大长度，超长的行整行丢弃
+#endif
+
+#ifndef UART_RX_FRAME_MAX
+#define UART_RX_FRAME_MAX   192   ///< 接收二进制帧(0x00定界)的最大长度，超长的帧丢弃
+#endif
+
+#ifndef UART_TX_LINE_MAX
+#define UART_TX_LINE_MAX    128   ///< 整行模式下 printf 攒一行的缓冲区大小，超长的行按这个长度分段
+#endif
+
+#ifndef UART_TX_BLOCK_TIMEOUT_MS
+#define UART_TX_BLOCK_TIMEOUT_MS  20  ///< 阻塞策略最多等待的时间(ms)，超时后按丢弃最新处理
+#endif
+
+#ifndef UART_BAUD_DEFAULT
+#define UART_BAUD_DEFAULT   115200  ///< 上电时的波特率，主机工具默认也用这个
+#endif
+
+#ifndef UART_BAUD_ERR_PERMILLE
+#define UART_BAUD_ERR_PERMILLE  20  ///< 允许的波特率误差(千分之几)，超过的波特率不接受
+#endif
+
+#ifndef UART_BAUD_CONFIRM_MS
+#define UART_BAUD_CONFIRM_MS    1000    ///< 切换波特率后等主机确认的时间，超时切回原波特率
+#endif
+
+#ifndef UART_BAUD_POLL_MS
+#define UART_BAUD_POLL_MS   10      ///< 协商期间检查发送是否完成/是否超时的周期(ms)
+#endif
+
+#ifndef UART_PRINTF_FMT
+#define UART_PRINTF_FMT     1   ///< 1: 包含本文件的模块里 printf 换成 uart_printf，不再链接库里的浮点格式化
+#endif
+
+/**
+ * @brief 发送缓冲区满时的处理策略
+ */
+typedef enum
+{
+    UART_TX_DROP_NEWEST = 0,    ///< 写能放下的部分，其余丢弃(原来的行为)
+    UART_TX_DROP_OLDEST,        ///< 丢弃缓冲区里最旧的整行腾出空间，新数据总能写入
+    UART_TX_BLOCK,              ///< 等待DMA腾出空间，最多 UART_TX_BLOCK_TIMEOUT_MS
+    UART_TX_LINE,               ///< 整条放得下才写，否则整条丢弃
+} UartTxPolicy;
+
+/**
+ * @brief 发送统计，用来根据实际数据确定 UART_TX_BUF_SIZE
+ */
+typedef struct
+{
+    uint32_t bytes_dropped;     ///< 丢弃的字节数
+    uint32_t lines_dropped;     ///< 丢弃或被截断的行数
+    uint32_t block_timeouts;    ///< 阻塞策略等待超时次数
+    uint16_t high_water;        ///< 缓冲区最高占用(字节)
+} UartTxStats;
+
 // =============================================================================
 // 公共函数声明
 // =============================================================================
@@ -35,7 +98,7 @@ extern "C" {
 void debug_init(void);
 
 /**
- * @brief 初始化USART1 DMA接收（IDLE中断 + 循环DMA）
+ * @brief 初始化USART1 DMA接收（循环DMA一直运行，HT/TC/IDLE中断发布写位置）
  */
 void usart1_dma_rx_init(void);
 
@@ -51,6 +114,22 @@ void usart1_dma_tx_init(void);
  */
 void Usart1_Send_DMA(uint8_t *data, uint16_t len);
 
+/**
+ * @brief 按指定策略发送数据（非阻塞，UART_TX_BLOCK 除外）
+ * @param data   待发送数据
+ * @param len    数据长度（字节）
+ * @param policy 缓冲区放不下时的处理策略
+ * @return 实际写入缓冲区的字节数
+ * @note 只能在主循环(线程)中调用，不能在中断里调用
+ */
+uint16_t Usart1_Send_Policy(const uint8_t *data, uint16_t len, UartTxPolicy policy);
+
+/**
+ * @brief 设置 printf 使用的策略（默认 UART_TX_LINE）
+ * @note UART_TX_LINE 下 printf 先攒到换行再整行写入，不带换行的尾巴由 uart_tx_task() 送出
+ */
+void uart_set_printf_policy(UartTxPolicy policy);
+
 /**
  * @brief 通过串口发送字符串（推荐直接使用 printf）
  * @param string 以 '\0' 结尾的字符串
@@ -64,6 +143,36 @@ void Usart1_Send_String(char *string);
  */
 void Usart1_send_bytes(uint8_t *data, uint16_t len);
 
+/**
+ * @brief 收到数据时在中断里调用(HT/TC/IDLE)，可用来唤醒处理任务
+ */
+extern void (*uart_rx_event_hook)(void);
+
+/**
+ * @brief 收到一个 0x00 定界的二进制帧时调用(主循环中，解析命令行时顺带拆出)
+ * @param frame 帧内容(不含定界符)，回调里可以原地修改
+ * @param len   帧长度
+ */
+extern void (*uart_rx_frame_hook)(uint8_t *frame, uint16_t len);
+
+/**
+ * @brief 接收环形缓冲区中未读的字节数
+ * @note 只在主循环中调用；积压超过 UART_RX_BUF_SIZE 时最旧的数据已被覆盖，这里会跳过并计入溢出次数
+ */
+uint16_t uart_rx_available(void);
+
+/**
+ * @brief 读出接收到的原始字节（二进制数据流用）
+ * @return 实际读出的字节数
+ * @note 和命令行解析共用同一个缓冲区，二者不要同时使用
+ */
+uint16_t uart_rx_read(uint8_t *buf, uint16_t len);
+
+/**
+ * @brief 接收溢出(数据被DMA覆盖)的次数
+ */
+uint32_t get_usart_rx_overruns(void);
+
 /**
  * @brief 检查是否有完整命令就绪（以 \r 或 \n 结尾）
  * @return 1: 有命令待处理；0: 无命令
@@ -109,6 +218,59 @@ void uart_tx_task(void);
  */
 uint16_t uart_get_tx_buf_usage(void);
 
+/**
+ * @brief 发送环形缓冲区剩余空间（字节数）
+ */
+uint16_t uart_tx_free(void);
+
+/**
+ * @brief 读取发送统计
+ * @param stats 输出
+ */
+void uart_get_tx_stats(UartTxStats *stats);
+
+/**
+ * @brief 清零发送统计，最高占用从当前占用重新开始
+ */
+void uart_reset_tx_stats(void);
+
+/**
+ * @brief 发送是否完全结束（缓冲区空、DMA空闲且最后一个字节已移出）
+ * @return 1: 空闲，可以关闭串口时钟；0: 仍在发送
+ */
+uint8_t uart_tx_idle(void);
+
+/**
+ * @brief 立即修改 USART1 波特率
+ * @details BRR 按 PCLK2(84MHz)计算，分频不到16时改用8倍过采样，最高约 PCLK2/8。
+ *          常用的 921600、2M、3M、4M 误差都在 0.2% 以内。
+ * @return 0: 成功；1: 做不到或误差超过 UART_BAUD_ERR_PERMILLE，波特率不变
+ * @note 正在发送的字节会变成乱码，调用前先等 uart_tx_idle()；一般用 uart_baud_begin() 协商
+ */
+uint8_t uart_set_baud(uint32_t baud);
+
+/**
+ * @brief 当前波特率
+ */
+uint32_t uart_get_baud(void);
+
+/**
+ * @brief 开始协商切换波特率
+ * @details 调用者先按原波特率发出应答，发送缓冲区清空后切换；
+ *          主机切换后在新波特率下发确认，设备收到后调用 uart_baud_confirm() 回应，
+ *          这一来一回就是握手。UART_BAUD_CONFIRM_MS 内没有确认就切回原波特率，
+ *          线路上的设置不对(比如主机的串口芯片不支持)也不会失联。
+ * @return 0: 已开始；1: 做不到这个波特率，或上一次切换还在等确认
+ * @note 只能在主循环中调用
+ */
+uint8_t uart_baud_begin(uint32_t baud);
+
+/**
+ * @brief 确认切换
+ * @return 0: 正在等 baud 的确认(此后不再切回)，或本来就是 baud 且没有协商在进行；1: 其他情况
+ */
+uint8_t uart_baud_confirm(uint32_t baud);
+
 // =============================================================================
 // 标准库 printf 重定向支持（无需用户调用）
 // =============================================================================
@@ -118,10 +280,25 @@ uint16_t uart_get_tx_buf_usage(void);
  */
 int fputc(int ch, FILE *f);
 
+/**
+ * @brief 格式化输出到 USART1，不经过库里的 printf
+ * @details 用 fmt.c 的整数格式化，字符直接进 printf 的行缓冲，和 printf 走同一个发送策略。
+ *          支持的格式见 fmt.h(%f 为定点，不支持 %e %g)。
+ * @return 输出的字符数
+ * @note 带 format 属性，printf/log_i/log_e 映射过来的调用也由编译器检查参数类型
+ */
+int uart_printf(const char *fmt, ...) __attribute__((format(printf, 1, 2)));
+int uart_vprintf(const char *fmt, va_list ap);
+
+#if UART_PRINTF_FMT
+#define printf uart_printf
+#endif
+
 // =============================================================================
 // 中断服务函数声明（由启动文件调用，用户无需手动调用）
 // =============================================================================
 void USART1_IRQHandler(void);
+void DMA2_Stream5_IRQHandler(void);
 void DMA2_Stream7_IRQHandler(void);
 
 #ifdef __cplusplus
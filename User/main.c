@@ -3,14 +3,19 @@
 #include "oled_print.h"
 #include "uart_dma.h"
 #include "soft_i2c.h"
-#include "logo.h"
+#include "oled_assets.h"
 #include "ui.h"
+#include "sched.h"
+#include "power.h"
+#include "prof.h"
+#include "proto.h"
+#include "log.h"
+#include "screen.h"
 #include "ui/alarm_all.h"
 #include "rtc_date.h" // ????RTC????
 #include "MPU6050.h"
 #include "MPU6050/eMPL/inv_mpu_dmp_motion_driver.h"
 #include "simple_pedometer.h"
-#include <stdlib.h> // ????abs????????
 // ????????
 #define options_NUM 7
 
@@ -30,50 +35,30 @@ static const char *get_weekday_name(u8 weekday)
 }
 
 // ????????
-const unsigned char *options[] =
+const OLED_Image *options[] =
 		{
-				gImage_stopwatch,
-				gImage_setting,
-				gImage_TandH,
-				gImage_flashlight,
-				gImage_bell,
-				gImage_step,
-				gImage_test
+				&img_stopwatch,
+				&img_setting,
+				&img_TandH,
+				&img_flashlight,
+				&img_bell,
+				&img_step,
+				&img_test
 
 };
 
-u8 enter_select(u8 selected)
-{
-	switch (selected)
-	{
-	case 0:
-		stopwatch();
-		break;
-	case 1:
-		setting();
-		break;
-	case 2:
-		TandH();
-
-		break;
-	case 3:
-		flashlight();
-		break;
-	case 4:
-		alarm_menu();
-		break;
+// 菜单各项对应的界面，NULL 表示仍是阻塞式的旧页面
+static const Screen *const option_screens[options_NUM] =
+		{
+				&screen_stopwatch,
+				&screen_setting,
+				&screen_TandH,
+				&screen_flashlight,
+				&screen_alarm_menu,
+				&screen_step,
+				0};
 
-	case 5:
-		step(); // ????????
-		break;
-		case 6:
-		testlist();
-		break;
-	default:
-		break;
-	}
-	return selected;
-}
+static u8 menu_selected = 0;
 
 void menu_Refresh(u8 selected)
 {
@@ -89,79 +74,201 @@ void menu_Refresh(u8 selected)
 
 	u8 right = ((selected + 1) % options_NUM);
 
-	OLED_ShowPicture(0, 16, 32, 32, options[left], 1);
-	OLED_ShowPicture(48, 16, 32, 32, options[selected], 0);
-	OLED_ShowPicture(96, 16, 32, 32, options[right], 1);
+	OLED_ShowImage(0, 16, options[left], 1);
+	OLED_ShowImage(48, 16, options[selected], 0);
+	OLED_ShowImage(96, 16, options[right], 1);
 	OLED_Refresh();
 }
-// ?????????????????????????��??��???
-u8 menu(u8 cho)
-{
 
-	delay_ms(10);
-	u8 flag_RE = 1;
-	u8 selected = cho;
+static void menu_enter(void)
+{
+	OLED_Clear();
+	menu_Refresh(menu_selected);
+}
 
-	u8 key;
-	while (1)
+static void menu_key(u8 key)
+{
+	switch (key)
 	{
-		delay_ms(10);
-
-		// 全局闹钟处理 - 在菜单界面也能处理闹钟
-		if (Alarm_GlobalHandler())
+	case KEY0_PRES:
+		if (menu_selected == 0)
 		{
-			continue; // 如果正在处理闹钟提醒，跳过菜单循环的其他部分
+			menu_selected = options_NUM - 1;
 		}
-
-		if (flag_RE)
+		else
 		{
-			OLED_Clear();
-			menu_Refresh(selected);
-
-			flag_RE = 0;
+			menu_selected--;
 		}
+		menu_Refresh(menu_selected);
+		break;
+	case KEY1_PRES:
+		menu_selected++;
+		menu_selected = menu_selected % options_NUM;
+		menu_Refresh(menu_selected);
+		break;
+	case KEY2_PRES:
+		OLED_Clear();
+		printf("out menu\r\n");
+		Screen_Pop();
+		break;
+	case KEY3_PRES:
+		if (option_screens[menu_selected])
+		{
+			Screen_Push(option_screens[menu_selected]);
+		}
+		else
+		{
+			testlist();
+			menu_enter();
+		}
+		break;
+	default:
+		break;
+	}
+}
+
+static const Screen screen_menu = {
+		menu_enter, 0, menu_key, 0, 0};
+
+// 表盘：日期、32像素时间和步数
+static void watch_enter(void)
+{
+	OLED_Clear();
+}
+
+static void watch_update(void)
+{
+	PROF_BEGIN(PROF_WATCH_UPDATE);
+	RTC_Date_Get();
+	OLED_Printf_Line(0, "%02d/%02d/%02d     %s",
+
+									 g_RTC_Date.RTC_Year + 2000,
+									 g_RTC_Date.RTC_Month,
+									 g_RTC_Date.RTC_Date,
+									 get_weekday_name(g_RTC_Date.RTC_WeekDay));
+	// 显示时间 32像素
+
+	OLED_Printf_Line_32(1, " %02d:%02d:%02d",
+											g_RTC_Time.RTC_Hours,
+											g_RTC_Time.RTC_Minutes,
+											g_RTC_Time.RTC_Seconds);
+
+	OLED_Printf_Line(3, "step : %lu", g_step_count);
+	PROF_END(PROF_WATCH_UPDATE);
+}
+
+static void watch_key(u8 key)
+{
+	switch (key)
+	{
+	case KEY3_PRES:
+		printf("cd menu\r\n");
+		Screen_Push(&screen_menu);
+		break;
+
+	// case KEY2_PRES:
+	// 	// 强制触发闹钟测试 (用于调试)
+	// 	printf("Manual alarm test triggered\r\n");
+	// 	Alarm_ForceTrigger();
+	// 	break;
+
+	default:
+		break;
+	}
+}
+
+// 表盘允许空闲时进入STOP模式
+static const Screen screen_watch = {
+		watch_enter, watch_update, watch_key, 0, 250, 1};
 
-		if ((key = KEY_Get()) != 0)
+// 闹钟任务：检查闹钟，有提醒时压入提醒界面
+static void alarm_task(void)
+{
+	// 备用闹钟检查 - 防止中断失效
+	PROF_BEGIN(PROF_ALARM_CHECK);
+	Alarm_Check();
+	PROF_END(PROF_ALARM_CHECK);
+
+	// 获取当前时间用于自动测试
+	RTC_Date_Get(); // 确保获取最新的RTC时间
+
+	// 只有真正到达00:00:00-00:00:30范围内才触发测试闹钟
+	if (g_RTC_Time.RTC_Hours == 0 && g_RTC_Time.RTC_Minutes == 0 &&
+			g_RTC_Time.RTC_Seconds >= 0 && g_RTC_Time.RTC_Seconds <= 30 &&
+			!alarm_alert_active)
+	{
+		// 确保真的到了00:00:00之后才触发（避免RTC时间同步问题）
+		static uint8_t trigger_flag = 0;
+		if (g_RTC_Time.RTC_Seconds == 0 || trigger_flag)
 		{
-			switch (key)
+			if (!trigger_flag)
 			{
-			case KEY0_PRES:
-				if (selected == 0)
-				{
-					selected = options_NUM - 1; // 0?????????
-				}
-				else
-				{
-					selected--;
-				}
-				menu_Refresh(selected);
-
-				break;
-			case KEY1_PRES:
-				selected++;
-				selected = selected % options_NUM;
-				menu_Refresh(selected);
-				break;
-			case KEY2_PRES:
-				OLED_Clear();
-				return selected;
-
-			case KEY3_PRES:
-				flag_RE = 1;
-				selected = enter_select(selected); // ???????????????
-				break;
-
-			default:
-				break;
+				printf("Auto midnight alarm test triggered at %02d:%02d:%02d\r\n",
+							 g_RTC_Time.RTC_Hours, g_RTC_Time.RTC_Minutes, g_RTC_Time.RTC_Seconds);
+				trigger_flag = 1;
+				Alarm_ForceTrigger();
 			}
 		}
 	}
+
+	if (alarm_alert_active && Screen_Current() != &screen_alarm)
+	{
+		Screen_Push(&screen_alarm);
+	}
+}
+
+// IMU任务：MPU6050 数据就绪中断攒够 MPU_INT_BATCH 个样本后唤醒，周期执行只是兜底
+// 把FIFO读空放进样本环，计步和匿名上位机上报各自从环里取
+// 任务晚执行只会让一次读得多些，不丢样本也不改变采样间隔
+static uint8_t imu_task_id = SCHED_INVALID;
+static u16 pedometer_tail;
+
+static void imu_wake(void)
+{
+	Sched_Wake(imu_task_id);
+}
+
+static void imu_task(void)
+{
+	MPU_Accel_Sample buf[MPU_FIFO_BURST_MAX];
+	u16 n;
+
+	// DMP片上计步时MCU只读步数；DMP_LP 下FIFO没有样本
+	simple_pedometer_dmp_poll();
+	if (simple_pedometer_engine() == STEP_ENGINE_DMP_LP)
+		return;
+
+	PROF_BEGIN(PROF_MPU_ACCEL);
+	MPU_Fifo_Poll();
+	PROF_END(PROF_MPU_ACCEL);
+	PROF_BEGIN(PROF_PEDOMETER);
+	while ((n = MPU_Ring_Read(&pedometer_tail, buf, MPU_FIFO_BURST_MAX)) != 0)
+		simple_pedometer_feed(buf, n);
+	PROF_END(PROF_PEDOMETER);
+	MPU_Niming_Poll();
+}
+
+// 串口命令任务：收到数据时由接收中断唤醒，周期执行只是兜底
+static uint8_t command_task_id = SCHED_INVALID;
+
+static void uart_rx_wake(void)
+{
+	Sched_Wake(command_task_id);
+}
+
+// 显示任务：把各界面改过的显存统一刷到屏上
+static void display_task(void)
+{
+	PROF_BEGIN(PROF_OLED_REFRESH);
+	OLED_Refresh_Dirty();
+	PROF_END(PROF_OLED_REFRESH);
 }
 
 int main()
 {
 
 	
+	SysTick_Init();
 	debug_init();
 	printf("debug init OK:");
 	printf("------------------------------------------------------>>\r\n");
@@ -169,13 +276,16 @@ KEY_Init();
 printf("key init OK\r\n");
 	OLED_Init();
 
-	OLED_ShowPicture(32, 0, 64, 64, gImage_bg, 1);
+	OLED_ShowImage(32, 0, &img_bg, 1);
 	// 初始化RTC
 	RTC_Date_Init();
 
 	// 初始化闹钟系统
 	Alarms_Init();
 
+	// RTC唤醒定时器，表盘空闲时用于从STOP模式唤醒
+	Power_Init();
+
 	
 	OLED_Refresh(); // ????
  printf("\r\n");
@@ -201,128 +311,38 @@ printf("key init OK\r\n");
 	// ????????
 	simple_pedometer_init();
 
-	// ????????????DMP????????????????
-
-	u8 key;
-	u8 cho = 0;
-	unsigned long last_count = 0;
-
-	// ???????????
-	static unsigned long loop_counter = 0;
 	OLED_Clear();
 
 	// RTC_SetTime_Manual(23, 59, 57);
+	Prof_Init();
+	Log_Init();
+
+	// 周期尽量取同一个数的倍数，几个任务在同一次唤醒里一起执行
+	Sched_Init();
+	Sched_Add_Periodic(alarm_task, 250);
+	if (simple_pedometer_engine() == STEP_ENGINE_DMP_LP)
+	{
+		imu_task_id = Sched_Add_Periodic(imu_task, STEP_DMP_POLL_MS);
+	}
+	else
+	{
+		imu_task_id = Sched_Add_Periodic(imu_task, MPU_POLL_MS);
+		mpu_data_hook = imu_wake;
+	}
+	Sched_Add_Periodic(uart_tx_task, 100); // DMA完成中断会自己续发，这里只是兜底
+	command_task_id = Sched_Add_Periodic(Process_Usart_Command, 50);
+	uart_rx_event_hook = uart_rx_wake;
+	Proto_Init(); // 二进制帧和命令行共用串口，帧由命令任务拆出后分发
+	Sched_Add_Periodic(display_task, 100);
+	Sched_Add_Periodic(Power_Report_Task, POWER_REPORT_PERIOD);
+	Screen_Init(&screen_watch);
+
 	printf("\r\n");
 	printf("<<----------------------------------------------system init OK!\r\n");
-	// ?????
+	// 主循环只跑调度器，没有任务到期时休眠
 	while (1)
 	{
-		// 全局闹钟处理 - 在任何界面都能处理闹钟
-		if (Alarm_GlobalHandler())
-		{
-			delay_ms(100); // 给闹钟显示留出时间
-			continue;			 // 如果正在处理闹钟提醒，跳过主循环的其他部分
-		}
-
-		// 备用闹钟检查 - 防止中断失效
-		Alarm_Check();
-		
-		// 获取当前时间用于自动测试
-		RTC_Date_Get(); // 确保获取最新的RTC时间
-		
-		// 只有真正到达00:00:00-00:00:30范围内才触发测试闹钟
-		if (g_RTC_Time.RTC_Hours == 0 && g_RTC_Time.RTC_Minutes == 0 && 
-		    g_RTC_Time.RTC_Seconds >= 0 && g_RTC_Time.RTC_Seconds <= 30 &&
-		    !alarm_alert_active) {
-			// 确保真的到了00:00:00之后才触发（避免RTC时间同步问题）
-			static uint8_t trigger_flag = 0;
-			if (g_RTC_Time.RTC_Seconds == 0 || trigger_flag) {
-				if (!trigger_flag) {
-					printf("Auto midnight alarm test triggered at %02d:%02d:%02d\r\n", 
-					       g_RTC_Time.RTC_Hours, g_RTC_Time.RTC_Minutes, g_RTC_Time.RTC_Seconds);
-					trigger_flag = 1;
-					Alarm_ForceTrigger();
-				}
-			}
-		}
-
-		// ??RTC??
-		RTC_Date_Get();
-		OLED_Printf_Line(0, "%02d/%02d/%02d     %s",
-
-										 g_RTC_Date.RTC_Year + 2000,
-										 g_RTC_Date.RTC_Month,
-										 g_RTC_Date.RTC_Date,
-										 get_weekday_name(g_RTC_Date.RTC_WeekDay));
-		// 显示时间 32像素
-
-		OLED_Printf_Line_32(1, " %02d:%02d:%02d",
-												g_RTC_Time.RTC_Hours,
-												g_RTC_Time.RTC_Minutes,
-												g_RTC_Time.RTC_Seconds);
-
-		// ???????????
-		short ax, ay, az;
-		MPU_Get_Accelerometer(&ax, &ay, &az);
-
-		// ???????
-		loop_counter++;
-
-		// ?????????????????????
-		simple_pedometer_update(ax, ay, az);
-		unsigned long count = g_step_count;
-
-		// ??????
-		if (count != last_count)
-		{
-			// printf("!!! STEP DETECTED: %ld -> %ld !!!\r\n", last_count, count);
-			last_count = count;
-		}
-
-		// ??????
-		static short last_ax = 0, last_ay = 0, last_az = 0;
-		long accel_diff = abs(ax - last_ax) + abs(ay - last_ay) + abs(az - last_az);
-		last_ax = ax;
-		last_ay = ay;
-		last_az = az;
-
-		if (accel_diff > 5000) // ????????
-		{
-			// printf("Movement: diff=%ld\r\n", accel_diff);
-		}
-
-		// ????????
-		// if (loop_counter % 10 == 0)
-		// {
-		// 	printf("Step: %ld\r\n", count);
-		// }
-
-		// printf("Current step: %ld\r\n", count);
-
-		OLED_Printf_Line(3, "step : %lu", count); // ????
-																							// ????
-		OLED_Refresh_Dirty();
-		delay_ms(150); // ???????????
-
-		if ((key = KEY_Get()) != 0)
-		{
-			switch (key)
-			{
-			case KEY3_PRES:
-				printf("cd menu\r\n");
-				cho = menu(cho);
-				printf("out menu\r\n");
-				break;
-
-			// case KEY2_PRES:
-			// 	// 强制触发闹钟测试 (用于调试)
-			// 	printf("Manual alarm test triggered\r\n");
-			// 	Alarm_ForceTrigger();
-			// 	break;
-
-			default:
-				break;
-			}
-		}
+		Sched_Run();
+		Sched_Idle();
 	}
 }
@@ -1,135 +1,154 @@
 #include "simple_pedometer.h"
-#include "math.h"
-#include <stdlib.h>
+#include "code/step_detect.h"
+#include "code/imu_block.h"
+#include "code/delay.h"
 #include "ui/step.h"  // 包含步数存储函数
+#define LOG_MODULE  LOG_MOD_PEDO
+#include "code/log.h"
+#include "code/cmd.h"
+#include <stdio.h>
+#include <string.h>
+
+// 流水线的滤波器系数按采样率整定，FIFO采样率必须和它一致
+#if MPU_FIFO_RATE != STEP_FS
+#error "MPU_FIFO_RATE must equal STEP_FS"
+#endif
 
 // 全局步数变量
 unsigned long g_step_count = 0;
 
-// 计步器状态结构体
-typedef struct {
-    short last_acceleration;        // 上一次的合加速度
-    short peak_threshold;           // 峰值阈值
-    short noise_threshold;          // 噪声阈值
-    short min_step_interval;        // 最小步间隔（毫秒）
-    unsigned long last_step_time;   // 上次步数检测时间
-    short step_state;               // 步数检测状态（0-等待波峰，1-等待波谷）
-} SimplePedometer;
+// 定点计步流水线的状态
+static Step_Detect detector;
+
+// 实际使用的引擎，DMP初始化失败时退回MCU
+static u8 step_engine = STEP_ENGINE;
+// MCU流水线自己数的步数，DMP引擎下用来和DMP对比
+static unsigned long mcu_steps = 0;
+// 上次读到的DMP步数，按增量累加到 g_step_count
+static unsigned long dmp_last = 0;
+// 复位时的DMP步数，对比从同一时刻开始
+static unsigned long dmp_base = 0;
 
-// 全局计步器实例
-static SimplePedometer pedometer;
+static void simple_pedometer_cmd_init(void);
 
 /**
  * @brief 初始化简单计步器
  */
 void simple_pedometer_init(void)
 {
-    // 初始化参数
     g_step_count = 0;
-    pedometer.last_acceleration = 0;
-    // 降低阈值以提高灵敏度
-    pedometer.peak_threshold = 8000;      // 降低峰值阈值
-    pedometer.noise_threshold = 2000;     // 降低噪声阈值
-    pedometer.min_step_interval = 100;    // 缩短最小步间隔到100毫秒
-    pedometer.last_step_time = 0;
-    pedometer.step_state = 0;             // 初始状态：等待波峰
-    
-    printf("Simple pedometer initialized with high sensitivity\r\n");
+    Step_Init(&detector);
+
+    LOG_I("Simple pedometer initialized, %d Hz pipeline\r\n", STEP_FS);
     
     // 加载保存的步数数据
     Steps_Load();
+
+    if (step_engine != STEP_ENGINE_MCU) {
+        // DMP重新初始化传感器；失败时 MPU_Dmp_Pedometer_Start 已恢复寄存器方式
+        if (MPU_Dmp_Pedometer_Start(step_engine == STEP_ENGINE_DMP)) {
+            LOG_W("DMP pedometer unavailable, using MCU engine\r\n");
+            step_engine = STEP_ENGINE_MCU;
+        }
+        dmp_last = dmp_base = 0;
+    }
+
+    simple_pedometer_cmd_init();
 }
 
 /**
- * @brief 计算三轴加速度的合加速度
- * @param ax X轴加速度
- * @param ay Y轴加速度
- * @param az Z轴加速度
- * @return 合加速度值
+ * @brief 累加步数，每跨过100步保存一次
  */
-static short calculate_magnitude(short ax, short ay, short az)
+static void add_steps(unsigned long n)
 {
-    // 计算三轴加速度的合加速度 (sqrt(ax^2 + ay^2 + az^2))
-    // 为避免浮点运算，我们使用近似算法
-    long magnitude_sq = (long)ax * ax + (long)ay * ay + (long)az * az;
-    
-    // 简单的整数平方根近似算法
-    if (magnitude_sq <= 0) return 0;
-    
-    short magnitude = 0;
-    short low = 0;
-    short high = 0x7FFF; // 32767
-    
-    // 二分查找法求平方根
-    while (high - low > 1) {
-        short mid = (low + high) / 2;
-        long sq = (long)mid * mid;
-        if (sq <= magnitude_sq) {
-            low = mid;
-        } else {
-            high = mid;
+    unsigned long before = g_step_count;
+
+    g_step_count += n;
+    if (g_step_count / 100 != before / 100) {
+        Steps_Save();
+    }
+}
+
+// 一个样本的三轴平方和送入流水线，新计的步数按引擎累加
+static unsigned long pedometer_step(uint32_t sq, unsigned long t_ms)
+{
+    uint8_t n = Step_Update_Sq(&detector, sq, t_ms);
+
+    if (n) {
+        mcu_steps += n;
+        if (step_engine == STEP_ENGINE_MCU) {
+            add_steps(n);
         }
+        LOG_D("Step detected! Total steps: %lu\r\n", g_step_count);
     }
-    
-    magnitude = low;
-    return magnitude;
+    return g_step_count;
 }
 
 /**
- * @brief 更新计步器状态并检测步数
+ * @brief 送入一个加速度样本
  * @param ax X轴加速度
  * @param ay Y轴加速度
  * @param az Z轴加速度
+ * @param t_ms 采样时刻（毫秒），按 STEP_FS 等间隔
  * @return 当前步数
  */
-unsigned long simple_pedometer_update(short ax, short ay, short az)
+unsigned long simple_pedometer_update(short ax, short ay, short az, unsigned long t_ms)
 {
-    // 计算合加速度
-    short magnitude = calculate_magnitude(ax, ay, az);
-    
-    // 获取当前时间（简化处理，使用固定间隔）
-    static unsigned long current_time = 0;
-    current_time += 100; // 假设每100ms调用一次
-    
-    // 简单的峰值检测算法
-    short diff = magnitude - pedometer.last_acceleration;
-    
-    // 状态机检测步数
-    if (pedometer.step_state == 0) {
-        // 等待波峰状态
-        if (diff < -pedometer.noise_threshold && 
-            magnitude < pedometer.last_acceleration - pedometer.noise_threshold) {
-            // 检测到波峰
-            if (pedometer.last_acceleration > pedometer.peak_threshold) {
-                // 波峰足够大
-                pedometer.step_state = 1; // 转换到等待波谷状态
-            }
-        }
-    } else {
-        // 等待波谷状态
-        if (diff > pedometer.noise_threshold && 
-            magnitude > pedometer.last_acceleration + pedometer.noise_threshold) {
-            // 检测到波谷
-            // 检查时间间隔，避免重复计数
-            if (current_time - pedometer.last_step_time > pedometer.min_step_interval) {
-                // 计为一步
-                g_step_count++;
-                pedometer.last_step_time = current_time;
-                printf("Step detected! Total steps: %lu\r\n", g_step_count);
-                
-                // 每100步或达到特定步数时保存一次
-                if (g_step_count % 100 == 0) {
-                    Steps_Save();
-                }
-            }
-            pedometer.step_state = 0; // 回到等待波峰状态
-        }
+    uint32_t sq = (uint32_t)((int32_t)ax * ax) + (uint32_t)((int32_t)ay * ay) + (uint32_t)((int32_t)az * az);
+
+    return pedometer_step(sq, t_ms);
+}
+
+/**
+ * @brief 送入FIFO读出的加速度样本
+ * @param s 样本，按采样时间先后排列
+ * @param n 样本数，不超过 MPU_FIFO_BURST_MAX
+ * @note 拆成 x/y/z 三个数组，整块算平方和(Cortex-M4 上用 SIMD)，再逐个样本送入流水线
+ */
+void simple_pedometer_feed(const MPU_Accel_Sample *s, u16 n)
+{
+    int16_t x[MPU_FIFO_BURST_MAX], y[MPU_FIFO_BURST_MAX], z[MPU_FIFO_BURST_MAX];
+    uint32_t sq[MPU_FIFO_BURST_MAX];
+    u16 i;
+
+    if (n > MPU_FIFO_BURST_MAX) {
+        n = MPU_FIFO_BURST_MAX;
     }
-    
-    // 更新上一次的加速度值
-    pedometer.last_acceleration = magnitude;
-    
-    return g_step_count;
+    for (i = 0; i < n; i++) {
+        x[i] = s[i].ax;
+        y[i] = s[i].ay;
+        z[i] = s[i].az;
+    }
+    Imu_Block_SumSq(x, y, z, sq, n);
+    for (i = 0; i < n; i++) {
+        pedometer_step(sq[i], s[i].t_ms);
+    }
+}
+
+/**
+ * @brief 读DMP的步数，把新增的步数累加到 g_step_count
+ * @note 只在DMP引擎下有效
+ */
+void simple_pedometer_dmp_poll(void)
+{
+    unsigned long count;
+
+    if (step_engine == STEP_ENGINE_MCU || dmp_get_pedometer_step_count_wrap(&count)) {
+        return;
+    }
+    if (count != dmp_last) {
+        add_steps(count - dmp_last);
+        dmp_last = count;
+        LOG_D("DMP steps: %lu, MCU steps: %lu\r\n", count, mcu_steps);
+    }
+}
+
+/**
+ * @brief 当前使用的计步引擎 STEP_ENGINE_xxx
+ */
+u8 simple_pedometer_engine(void)
+{
+    return step_engine;
 }
 
 /**
@@ -147,11 +166,47 @@ unsigned long simple_pedometer_get_steps(void)
 void simple_pedometer_reset(void)
 {
     g_step_count = 0;
-    pedometer.last_acceleration = 0;
-    pedometer.last_step_time = 0;
-    pedometer.step_state = 0;
-    printf("Simple pedometer reset\r\n");
+    mcu_steps = 0;
+    dmp_base = dmp_last;
+    Step_Init(&detector);
+    LOG_I("Simple pedometer reset\r\n");
     
     // 重置后立即保存
     Steps_Save();
 }
+
+/**
+ * @brief 串口命令 steps [reset|save]
+ */
+static void cmd_steps(uint8_t argc, char *argv[])
+{
+    if (argc > 1 && strcmp(argv[1], "reset") == 0) {
+        simple_pedometer_reset();
+    } else if (argc > 1 && strcmp(argv[1], "save") == 0) {
+        Steps_Save();
+    } else if (argc > 1) {
+        printf("usage: steps [reset|save]\r\n");
+        return;
+    }
+    printf("steps: %lu\r\n", g_step_count);
+    if (step_engine != STEP_ENGINE_DMP_LP) {
+        printf("cadence: %u/min stride: %u mm distance: %lu m\r\n",
+               Step_Cadence(&detector, get_systick()), detector.stride_mm,
+               (unsigned long)(detector.distance_mm / 1000));
+    }
+    // DMP引擎下并排给出两种算法从上次复位以来的计数
+    if (step_engine == STEP_ENGINE_DMP) {
+        printf("mcu: %lu dmp: %lu\r\n", mcu_steps, dmp_last - dmp_base);
+    } else if (step_engine == STEP_ENGINE_DMP_LP) {
+        printf("dmp: %lu\r\n", dmp_last - dmp_base);
+    }
+}
+
+static const Cmd pedometer_cmds[] = {
+    { "steps", cmd_steps, "steps [reset|save] - Show/reset/save step count" },
+};
+
+static void simple_pedometer_cmd_init(void)
+{
+    Cmd_Register(pedometer_cmds, CMD_COUNT(pedometer_cmds));
+}
@@ -2,14 +2,31 @@
 #define __SIMPLE_PEDOMETER_H
 
 #include "sys.h"
+#include "MPU6050.h"
+
+// 计步引擎
+#define STEP_ENGINE_MCU     0   // MCU上的定点计步流水线(code/step_detect.c)
+#define STEP_ENGINE_DMP     1   // MPU6050 DMP片上计步；DMP照常输出原始加速度，MCU的流水线同时运行，用来对比
+#define STEP_ENGINE_DMP_LP  2   // DMP片上计步；FIFO不输出，MCU每 STEP_DMP_POLL_MS 读一次步数，其余时间睡眠
+
+#ifndef STEP_ENGINE
+#define STEP_ENGINE         STEP_ENGINE_MCU
+#endif
+
+#ifndef STEP_DMP_POLL_MS
+#define STEP_DMP_POLL_MS    5000    // STEP_ENGINE_DMP_LP 读DMP步数的周期(ms)
+#endif
 
 // 全局步数变量
 extern unsigned long g_step_count;
 
 // 函数声明
 void simple_pedometer_init(void);
-unsigned long simple_pedometer_update(short ax, short ay, short az);
+unsigned long simple_pedometer_update(short ax, short ay, short az, unsigned long t_ms);
+void simple_pedometer_feed(const MPU_Accel_Sample *s, u16 n);
 void simple_pedometer_reset(void);
 unsigned long simple_pedometer_get_steps(void);
+u8 simple_pedometer_engine(void);
+void simple_pedometer_dmp_poll(void);
 
 #endif
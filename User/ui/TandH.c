@@ -1,57 +1,47 @@
-
 #include "TandH.h"
-#include "ui/alarm_all.h"
 
+static void TandH_enter(void)
+{
+  DHT11_Init();
+  OLED_Clear();
+}
 
-void TandH()
+// DHT11 两次读取至少间隔1秒，这里每3秒读一次
+static void TandH_update(void)
 {
-debug_init();
-  OLED_Init();
-	DHT11_Init();
-  KEY_Init();	
-  SysTick_Init();	 // 初始化滴时器
-  DHT11_Data_TypeDef dhtdata; 
+  DHT11_Data_TypeDef dhtdata;
+  int result = Read_DHT11(&dhtdata);
 
-  u8 key;
- 
-  while (1)
+  if (result == 0)
   {
-    // 全局闹钟处理 - 在温湿度界面也能处理闹钟
-    if (Alarm_GlobalHandler()) {
-        delay_ms(10);
-        continue; // 如果正在处理闹钟提醒，跳过温湿度循环的其他部分
-    }
-    
-    delay_ms(10);
-    if ((key =KEY_Get())!=0)
-    {
-      if (key == KEY2_PRES)
-      {
-        printf("exit TandH\r\n");
-        return;
-      }
-      
-    }
-    
-    int result = 0;
-    result = Read_DHT11(&dhtdata);
-
-				if (result == 0)
-        {
-          OLED_Clear_Line(3);
-          OLED_Printf_Line(2, "T:%d.%dC H:%d.%d%%",
-													 dhtdata.temp_int, dhtdata.temp_deci,
-													 dhtdata.humi_int, dhtdata.humi_deci);
-                           	
-        }else
-        {
-          OLED_Clear_Line(2);
-          OLED_Printf_Line(2, "DHT11 Error!");
-					OLED_Printf_Line(3, "Code: %d", result);
+    OLED_Clear_Line(3);
+    OLED_Printf_Line(2, "T:%d.%dC H:%d.%d%%",
+                     dhtdata.temp_int, dhtdata.temp_deci,
+                     dhtdata.humi_int, dhtdata.humi_deci);
+  }
+  else
+  {
+    OLED_Clear_Line(2);
+    OLED_Printf_Line(2, "DHT11 Error!");
+    OLED_Printf_Line(3, "Code: %d", result);
+  }
+  OLED_Refresh_Dirty();
+}
 
-        }
-	OLED_Refresh_Dirty();
-    delay_ms(3000);
+static void TandH_key(u8 key)
+{
+  if (key == KEY2_PRES)
+  {
+    printf("exit TandH\r\n");
+    Screen_Pop();
   }
-  
+}
+
+const Screen screen_TandH = {
+  TandH_enter, TandH_update, TandH_key, 0, 3000
+};
+
+void TandH()
+{
+  Screen_Run(&screen_TandH);
 }
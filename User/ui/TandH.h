@@ -11,8 +11,11 @@
 #include "debug.h"
 #include "delay.h"
 #include "dht11.h"
+#include "screen.h"
 
 
+extern const Screen screen_TandH;
+
 void TandH(void);
 
 
@@ -3,10 +3,14 @@
 #include "oled.h"
 #include "oled_print.h"
 #include "key.h"
-#include "logo.h"
+#include "oled_assets.h"
 #include "code/led.h"
 #include "code/delay.h"
 #include "code/spi.h"
+#define LOG_MODULE  LOG_MOD_ALARM
+#include "code/log.h"
+#include "code/cmd.h"
+#include "screen.h"
 #include "stm32f4xx_rtc.h"
 #include "stm32f4xx_pwr.h"
 #include <string.h>
@@ -40,6 +44,7 @@ static void Alarm_SetRTCAlarm(void);
 static void Alarms_Load(void);
 static void Display_Alarm_Alert(Alarm_TypeDef* alarm);
 static void Update_Alarm_Alert_Display(Alarm_TypeDef* alarm);
+static void Alarm_Cmd_Init(void);
 
 // 全局函数声明（在头文件中已有，但这里重复声明以避免编译器警告）
 extern uint32_t get_systick(void);
@@ -58,6 +63,8 @@ void Alarms_Init(void)
     
     // 加载已保存的闹钟（函数内部会处理SPI初始化和W25Q128检测）
     Alarms_Load();
+
+    Alarm_Cmd_Init();
 }
 
 /**
@@ -74,7 +81,7 @@ static void Alarm_RTC_Config(void)
     // 暂时不配置RTC闹钟中断，改用纯软件检查
     // 因为硬件闹钟可能干扰RTC时间更新
     
-    printf("RTC Alarm config initialized (software mode)\r\n");
+    LOG_I("RTC Alarm config initialized (software mode)\r\n");
 }
 
 // 闹钟数据在W25Q128中的存储地址
@@ -89,12 +96,12 @@ void Alarms_Save(void)
     uint16_t buffer_size = 0;
     uint32_t write_addr = ALARM_DATA_BASE_ADDR;
     
-    printf("Saving %d alarms to W25Q128 Flash\r\n", g_alarm_count);
+    LOG_D("Saving %d alarms to W25Q128 Flash\r\n", g_alarm_count);
     
     // 检查W25Q128是否存在
     uint32_t flash_id = W25Q128_ReadID();
     if (flash_id != W25X_JEDECID) {
-        printf("W25Q128 not available, skipping alarm save\r\n");
+        LOG_W("W25Q128 not available, skipping alarm save\r\n");
         return;
     }
     
@@ -113,7 +120,7 @@ void Alarms_Save(void)
     // 写入W25Q128 Flash
     W25Q128_BufferWrite(buffer, write_addr, buffer_size);
     
-    printf("Successfully saved %d alarms (%d bytes) to W25Q128\r\n", g_alarm_count, buffer_size);
+    LOG_D("Successfully saved %d alarms (%d bytes) to W25Q128\r\n", g_alarm_count, buffer_size);
 }
 
 /**
@@ -131,22 +138,22 @@ void Alarms_Load(void)
     uint16_t buffer_size = 2;
     uint32_t read_addr = ALARM_DATA_BASE_ADDR;
     
-    printf("Loading alarms from W25Q128 Flash\r\n");
+    LOG_D("Loading alarms from W25Q128 Flash\r\n");
     
     // 尝试初始化SPI接口
-    printf("Initializing SPI1 for W25Q128...\r\n");
+    LOG_D("Initializing SPI1 for W25Q128...\r\n");
     SPI1_Init();
     
     // 检查W25Q128是否存在
     uint32_t flash_id = W25Q128_ReadID();
     if (flash_id != W25X_JEDECID) {
-        printf("W25Q128 not available, skipping alarm load\r\n");
+        LOG_W("W25Q128 not available, skipping alarm load\r\n");
         g_alarm_count = 0;
         memset(g_alarms, 0, sizeof(g_alarms));
         return;
     }
     
-    printf("W25Q128 Flash detected successfully (ID: 0x%06X)\r\n", flash_id);
+    LOG_D("W25Q128 Flash detected successfully (ID: 0x%06X)\r\n", flash_id);
     
     // 从W25Q128 Flash读取数据
     W25Q128_ReadData(buffer, read_addr, buffer_size);
@@ -156,7 +163,7 @@ void Alarms_Load(void)
     
     // 检查数据有效性
     if (g_alarm_count > MAX_ALARMS) {
-        printf("Invalid alarm count %d, resetting to 0\r\n", g_alarm_count);
+        LOG_W("Invalid alarm count %d, resetting to 0\r\n", g_alarm_count);
         g_alarm_count = 0;
         memset(g_alarms, 0, sizeof(g_alarms));
         return;
@@ -170,7 +177,7 @@ void Alarms_Load(void)
         // 验证读取的数据是否合理（简单的边界检查）
         for (uint8_t i = 0; i < g_alarm_count; i++) {
             if (g_alarms[i].hour > 23 || g_alarms[i].minute > 59 || g_alarms[i].second > 59) {
-                printf("Invalid alarm data at index %d, resetting alarms\r\n", i);
+                LOG_W("Invalid alarm data at index %d, resetting alarms\r\n", i);
                 g_alarm_count = 0;
                 memset(g_alarms, 0, sizeof(g_alarms));
                 return;
@@ -178,11 +185,11 @@ void Alarms_Load(void)
         }
     }
     
-    printf("Successfully loaded %d alarms from W25Q128\r\n", g_alarm_count);
+    LOG_I("Successfully loaded %d alarms from W25Q128\r\n", g_alarm_count);
     
     // 显示加载的闹钟信息（调试用）
     for (uint8_t i = 0; i < g_alarm_count; i++) {
-        printf("Alarm %d: %02d:%02d:%02d, enabled=%d, repeat=%d\r\n", 
+        LOG_D("Alarm %d: %02d:%02d:%02d, enabled=%d, repeat=%d\r\n", 
                i, g_alarms[i].hour, g_alarms[i].minute, g_alarms[i].second, 
                g_alarms[i].enabled, g_alarms[i].repeat);
     }
@@ -309,7 +316,7 @@ void Alarm_Check(void)
             g_alarms[i].second == currentTime.RTC_Seconds) {
             
             // 触发闹钟
-            printf("Alarm triggered! Time: %02d:%02d:%02d, Index: %d\n", 
+            LOG_I("Alarm triggered! Time: %02d:%02d:%02d, Index: %d\n", 
                    currentTime.RTC_Hours, currentTime.RTC_Minutes, currentTime.RTC_Seconds, i);
             
             // 点亮LED2
@@ -342,7 +349,7 @@ void Alarm_SetRTCAlarm(void)
     
     for (uint8_t i = 0; i < g_alarm_count; i++) {
         if (g_alarms[i].enabled) {
-            printf("Software alarm set for %02d:%02d:%02d\r\n", 
+            LOG_I("Software alarm set for %02d:%02d:%02d\r\n", 
                    g_alarms[i].hour, g_alarms[i].minute, g_alarms[i].second);
         }
     }
@@ -353,19 +360,19 @@ void Alarm_SetRTCAlarm(void)
  */
 void Display_Alarm_Alert(Alarm_TypeDef* alarm)
 {
-    printf("=== Display_Alarm_Alert called ===\r\n");
+    LOG_D("=== Display_Alarm_Alert called ===\r\n");
     
     OLED_Clear(); // 完全清除屏幕，而不是只清除几行
     
     // 显示闹钟图标
-    OLED_ShowPicture(48, 0, 32, 32, gImage_bell, 0);
+    OLED_ShowImage(48, 0, &img_bell, 0);
     
     // 显示提醒文字
     OLED_Printf_Line(0, "    ALARM!");
     OLED_Printf_Line(2, "  %02d:%02d:%02d", alarm->hour, alarm->minute, alarm->second);
     OLED_Printf_Line(3, "Press KEY3 to stop");
     
-    printf("Displaying alarm alert for %02d:%02d:%02d\r\n", 
+    LOG_D("Displaying alarm alert for %02d:%02d:%02d\r\n", 
            alarm->hour, alarm->minute, alarm->second);
     
     OLED_Refresh();
@@ -374,7 +381,7 @@ void Display_Alarm_Alert(Alarm_TypeDef* alarm)
     delay_ms(10);
     OLED_Refresh_Dirty();
     
-    printf("=== Alarm display completed ===\r\n");
+    LOG_D("=== Alarm display completed ===\r\n");
 }
 
 /**
@@ -410,7 +417,7 @@ void Update_Alarm_Alert_Display(Alarm_TypeDef* alarm)
  */
 void Alarm_ForceTrigger(void)
 {
-    printf("Force triggering alarm test...\r\n");
+    LOG_I("Force triggering alarm test...\r\n");
     
     // 点亮LED2
     LED_Set(2, 0);  
@@ -425,7 +432,7 @@ void Alarm_ForceTrigger(void)
         .enabled = 1, .repeat = 0, .daysOfWeek = 0
     };
     Display_Alarm_Alert(&test_alarm);
-    printf("Test alarm display activated\r\n");
+    LOG_D("Test alarm display activated\r\n");
     
     // 强制刷新显示
     delay_ms(10);
@@ -444,31 +451,31 @@ uint8_t Alarm_GlobalHandler(void)
         // 更新闹钟提醒显示
         if (g_triggered_alarm_index != 0xFF && g_triggered_alarm_index < g_alarm_count) {
             Update_Alarm_Alert_Display(&g_alarms[g_triggered_alarm_index]);
-            printf("Updating alarm display for index %d\r\n", g_triggered_alarm_index);
+            LOG_D("Updating alarm display for index %d\r\n", g_triggered_alarm_index);
         } else if (g_triggered_alarm_index == 0xFF) {
             // 这是测试闹钟，创建默认显示
             static Alarm_TypeDef test_alarm = {
                 .hour = 0, .minute = 0, .second = 0,
                 .enabled = 1, .repeat = 0, .daysOfWeek = 0
             };
-            printf("Updating test alarm display\r\n");
+            LOG_D("Updating test alarm display\r\n");
             Display_Alarm_Alert(&test_alarm);
         }
         
         // 处理闹钟提醒界面的按键输入
         uint8_t key = KEY_Get();
         if (key == KEY3_PRES) {
-            printf("KEY3 pressed - dismissing alarm\r\n");
+            LOG_D("KEY3 pressed - dismissing alarm\r\n");
             // 关闭LED2
             LED_Set(2, 1);  // 熄灭LED2
             alarm_alert_active = 0;  // 退出提醒状态
             g_triggered_alarm_index = 0xFF; // 重置触发索引
             
             OLED_Clear(); // 清除显示，返回原界面
-            printf("Alarm dismissed, returning to normal mode\r\n");
+            LOG_I("Alarm dismissed, returning to normal mode\r\n");
             return 0; // 闹钟处理完毕
         } else if (key != 0) {
-            printf("Other key pressed: %d\r\n", key);
+            LOG_D("Other key pressed: %d\r\n", key);
         }
         
         return 1; // 仍在处理闹钟提醒
@@ -476,3 +483,104 @@ uint8_t Alarm_GlobalHandler(void)
     
     return 0; // 无闹钟提醒
 }
+
+/**
+ * @brief 当前提醒对应的闹钟，测试闹钟返回默认的 00:00:00
+ */
+static Alarm_TypeDef* Alarm_Alert_Target(void)
+{
+    static Alarm_TypeDef test_alarm = {
+        .hour = 0, .minute = 0, .second = 0,
+        .enabled = 1, .repeat = 0, .daysOfWeek = 0
+    };
+    if (g_triggered_alarm_index != 0xFF && g_triggered_alarm_index < g_alarm_count) {
+        return &g_alarms[g_triggered_alarm_index];
+    }
+    return &test_alarm;
+}
+
+static void alarm_alert_enter(void)
+{
+    Display_Alarm_Alert(Alarm_Alert_Target());
+}
+
+static void alarm_alert_key(uint8_t key)
+{
+    // 只有KEY3可以关闭闹钟提醒
+    if (key != KEY3_PRES) {
+        LOG_D("Other key pressed: %d\r\n", key);
+        return;
+    }
+    LOG_D("KEY3 pressed - dismissing alarm\r\n");
+    LED_Set(2, 1);  // 熄灭LED2
+    alarm_alert_active = 0;  // 退出提醒状态
+    g_triggered_alarm_index = 0xFF; // 重置触发索引
+
+    OLED_Clear(); // 清除显示，返回原界面
+    LOG_I("Alarm dismissed, returning to normal mode\r\n");
+    Screen_Pop();
+}
+
+/**
+ * @brief 闹钟提醒界面
+ * 由主循环的闹钟任务在 alarm_alert_active 置位时压入，KEY3 关闭后弹出回到原界面
+ */
+const Screen screen_alarm = {
+    alarm_alert_enter, 0, alarm_alert_key, 0, 0
+};
+
+/**
+ * @brief 串口命令 alarm
+ * alarm                       列出闹钟
+ * alarm add <hh> <mm> <ss> [repeat]
+ * alarm del|on|off <n>
+ * alarm test                  立即触发测试闹钟
+ */
+static void cmd_alarm(uint8_t argc, char *argv[])
+{
+    uint32_t v[4] = {0};
+    const char *sub = argc > 1 ? argv[1] : "";
+
+    if (argc == 1) {
+        printf("%d alarm(s)\r\n", g_alarm_count);
+        for (uint8_t i = 0; i < g_alarm_count; i++) {
+            printf("%d: %02d:%02d:%02d %s%s\r\n", i,
+                   g_alarms[i].hour, g_alarms[i].minute, g_alarms[i].second,
+                   g_alarms[i].enabled ? "on" : "off",
+                   g_alarms[i].repeat ? " repeat" : "");
+        }
+    } else if (strcmp(sub, "test") == 0) {
+        Alarm_ForceTrigger();
+    } else if (strcmp(sub, "add") == 0 && argc >= 5 &&
+               !Cmd_Arg_U32(argv[2], &v[0]) && !Cmd_Arg_U32(argv[3], &v[1]) &&
+               !Cmd_Arg_U32(argv[4], &v[2]) && (argc < 6 || !Cmd_Arg_U32(argv[5], &v[3])) &&
+               v[0] <= 23 && v[1] <= 59 && v[2] <= 59) {
+        Alarm_TypeDef alarm = {0};
+        alarm.hour = v[0];
+        alarm.minute = v[1];
+        alarm.second = v[2];
+        alarm.enabled = 1;
+        alarm.repeat = v[3] ? 1 : 0;
+        printf(Alarm_Add(&alarm) ? "alarm table full\r\n" : "alarm added\r\n");
+    } else if (argc >= 3 && !Cmd_Arg_U32(argv[2], &v[0]) && v[0] < g_alarm_count &&
+               (strcmp(sub, "del") == 0 || strcmp(sub, "on") == 0 || strcmp(sub, "off") == 0)) {
+        if (sub[0] == 'd')
+            Alarm_Delete(v[0]);
+        else if (sub[1] == 'n')
+            Alarm_Enable(v[0]);
+        else
+            Alarm_Disable(v[0]);
+        printf("alarm %lu %s\r\n", (unsigned long)v[0], sub);
+    } else {
+        printf("usage: alarm [add <hh> <mm> <ss> [repeat] | del|on|off <n> | test]\r\n");
+    }
+}
+
+static const Cmd alarm_cmds[] = {
+    { "alarm", cmd_alarm, "alarm [add|del|on|off|test] - List/edit alarms" },
+};
+
+static void Alarm_Cmd_Init(void)
+{
+    Cmd_Register(alarm_cmds, CMD_COUNT(alarm_cmds));
+}
@@ -3,6 +3,7 @@
 
 #include "stm32f4xx.h"
 #include "rtc_date.h"
+#include "screen.h"
 
 // 最大闹钟数量
 #define MAX_ALARMS 10
@@ -41,9 +42,12 @@ void Display_Alarm_Alert(Alarm_TypeDef* alarm);
 uint8_t Handle_Alarm_Alert_Keys(void);
 void Update_Alarm_Alert_Display(Alarm_TypeDef* alarm);
 
-// 全局闹钟处理函数(没有实现)
+// 全局闹钟处理函数，供仍是阻塞式的页面在自己的循环里调用
 uint8_t Alarm_GlobalHandler(void);
 
+// 闹钟提醒界面
+extern const Screen screen_alarm;
+
 // 测试函数
 void Alarm_ForceTrigger(void);
 
@@ -1,15 +1,14 @@
 #include "alarm_menu.h"
-#include "ui/alarm_all.h"
 #include <stdio.h>
 
 // 分页显示相关宏定义
 #define ALARM_SHOWING_NUM 4
 
 // 选项的图标
-const unsigned char *alarm_menu_options[] =
+const OLED_Image *alarm_menu_options[] =
     {
-        gImage_add,      // 新建闹钟图标
-        gImage_list      // 闹钟列表图标
+        &img_add,      // 新建闹钟图标
+        &img_list      // 闹钟列表图标
 };
 
 // 分页显示相关变量
@@ -37,8 +36,8 @@ void alarm_menu_Ref(u8 selected)
 {
     u8 right = ((selected + 1) % alarm_menu_options_NUM);
 
-    OLED_ShowPicture(48, 16, 32, 32, alarm_menu_options[selected], 0);
-    OLED_ShowPicture(96, 16, 32, 32, alarm_menu_options[right], 1);
+    OLED_ShowImage(48, 16, alarm_menu_options[selected], 0);
+    OLED_ShowImage(96, 16, alarm_menu_options[right], 1);
     OLED_Refresh();
 }
 
@@ -401,63 +400,58 @@ void alarm_list(void)
     }
 }
 
-void alarm_menu()
+static u8 alarm_menu_selected = 0;
+
+static void alarm_menu_enter(void)
 {
-    u8 flag_RE = 1;
-    u8 key;
-    u8 selected = 2;
-    delay_ms(10);
-    while (1)
+    OLED_Clear();
+    alarm_menu_Ref(alarm_menu_selected);
+}
+
+static void alarm_menu_key(u8 key)
+{
+    switch (key)
     {
-        // 全局闹钟处理 - 在闹钟菜单界面也能处理闹钟
-        if (Alarm_GlobalHandler()) {
-            delay_ms(10);
-            continue; // 如果正在处理闹钟提醒，跳过闹钟菜单循环的其他部分
-        }
-        
-        delay_ms(10);
-        if (flag_RE)
+    case KEY0_PRES:
+        if (alarm_menu_selected == 0)
         {
-            OLED_Clear();
-            alarm_menu_Ref(selected);
-            flag_RE = 0;
+            alarm_menu_selected = alarm_menu_options_NUM - 1; // 0→最后一项
         }
-        
-        if ((key = KEY_Get()) != 0)
+        else
         {
-            switch (key)
-            {
-            case KEY0_PRES:
-                if (selected == 0)
-                {
-                    selected = alarm_menu_options_NUM - 1; // 0→最后一项
-                }
-                else
-                {
-                    selected--;
-                }
-                alarm_menu_Ref(selected);
-                break;
-                
-            case KEY1_PRES:
-                selected++;
-                selected = selected % alarm_menu_options_NUM;
-                alarm_menu_Ref(selected);
-                break;
-                
-            case KEY2_PRES:
-                OLED_Clear();
-                return;
-                
-            case KEY3_PRES:
-                flag_RE = 1;
-                OLED_Clear();
-                alarm_menu_Enter_select(selected); // 进入所选择的菜单项
-                break;
-
-            default:
-                break;
-            }
+            alarm_menu_selected--;
         }
+        alarm_menu_Ref(alarm_menu_selected);
+        break;
+
+    case KEY1_PRES:
+        alarm_menu_selected++;
+        alarm_menu_selected = alarm_menu_selected % alarm_menu_options_NUM;
+        alarm_menu_Ref(alarm_menu_selected);
+        break;
+
+    case KEY2_PRES:
+        OLED_Clear();
+        Screen_Pop();
+        break;
+
+    case KEY3_PRES:
+        // 子页面仍是阻塞式的，返回后重绘本界面
+        OLED_Clear();
+        alarm_menu_Enter_select(alarm_menu_selected); // 进入所选择的菜单项
+        alarm_menu_enter();
+        break;
+
+    default:
+        break;
     }
 }
+
+const Screen screen_alarm_menu = {
+    alarm_menu_enter, 0, alarm_menu_key, 0, 0
+};
+
+void alarm_menu()
+{
+    Screen_Run(&screen_alarm_menu);
+}
@@ -4,11 +4,14 @@
 #include "oled.h"
 #include "oled_print.h"
 #include "key.h"
-#include "logo.h"
+#include "oled_assets.h"
 #include "alarm_all.h"
+#include "screen.h"
 
 #define alarm_menu_options_NUM 2
 
+extern const Screen screen_alarm_menu;
+
 void alarm_menu(void);
 
 // 新增函数声明
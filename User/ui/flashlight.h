@@ -6,9 +6,12 @@
 #include "delay.h"
 #include "oled.h"
 #include "oled_print.h"
-#include "logo.h"
+#include "oled_assets.h"
+#include "screen.h"
 
 
+extern const Screen screen_flashlight;
+
 void flashlight(void);
 
 
@@ -0,0 +1,130 @@
+#include "screen.h"
+#include "sched.h"
+#include "key.h"
+#include "power.h"
+
+static const Screen *screen_stack[SCREEN_STACK_DEPTH];
+static uint8_t screen_depth = 0;
+static uint8_t screen_update_id = SCHED_INVALID;
+static uint8_t screen_key_id = SCHED_INVALID;
+
+// 周期调用当前界面的 update
+static void Screen_Update_Task(void)
+{
+    const Screen *s = Screen_Current();
+    if (s && s->update)
+        s->update();
+}
+
+// 扫描按键并交给当前界面
+static void Screen_Key_Task(void)
+{
+    const Screen *s = Screen_Current();
+    uint8_t key = KEY_Get();
+    if (key && s && s->key)
+        s->key(key);
+}
+
+// 按键中断回调：让按键任务马上执行
+static void Screen_Key_Wake(void)
+{
+    Sched_Wake(screen_key_id);
+}
+
+// 进入栈顶界面：重绘并按它的周期重新安排 update
+static void Screen_Enter_Top(void)
+{
+    const Screen *s = Screen_Current();
+
+    Sched_Cancel(screen_update_id);
+    screen_update_id = SCHED_INVALID;
+    Power_Allow_Stop(s ? s->low_power : 0);
+    if (!s)
+        return;
+    if (s->enter)
+        s->enter();
+    if (s->update)
+    {
+        s->update();
+        if (s->period)
+            screen_update_id = Sched_Add_Periodic(Screen_Update_Task, s->period);
+    }
+}
+
+// 按键扫描任务在第一次压入界面时添加
+static void Screen_Start_Key(void)
+{
+    if (screen_key_id == SCHED_INVALID)
+    {
+        screen_key_id = Sched_Add_Periodic(Screen_Key_Task, SCREEN_KEY_PERIOD);
+        key_event_hook = Screen_Key_Wake;
+    }
+}
+
+void Screen_Init(const Screen *first)
+{
+    screen_depth = 0;
+    Screen_Push(first);
+}
+
+const Screen *Screen_Current(void)
+{
+    return screen_depth ? screen_stack[screen_depth - 1] : 0;
+}
+
+uint8_t Screen_Depth(void)
+{
+    return screen_depth;
+}
+
+// 进入子界面，返回时上一界面的 enter 会再次调用
+void Screen_Push(const Screen *s)
+{
+    if (!s || screen_depth >= SCREEN_STACK_DEPTH)
+        return;
+    Screen_Start_Key();
+    screen_stack[screen_depth++] = s;
+    Screen_Enter_Top();
+}
+
+// 退出当前界面，回到上一界面
+void Screen_Pop(void)
+{
+    const Screen *s = Screen_Current();
+    if (!s)
+        return;
+    if (s->exit)
+        s->exit();
+    screen_depth--;
+    Screen_Enter_Top();
+}
+
+// 用新界面替换当前界面
+void Screen_Switch(const Screen *s)
+{
+    const Screen *old = Screen_Current();
+    if (!s)
+        return;
+    if (!old)
+    {
+        Screen_Push(s);
+        return;
+    }
+    if (old->exit)
+        old->exit();
+    screen_stack[screen_depth - 1] = s;
+    Screen_Enter_Top();
+}
+
+void Screen_Run(const Screen *s)
+{
+    uint8_t depth = screen_depth;
+    Screen_Push(s);
+    if (Sched_In_Task())
+        return;
+    while (screen_depth > depth)
+    {
+        Sched_Run();
+        Sched_Idle();
+    }
+}
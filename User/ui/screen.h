@@ -0,0 +1,39 @@
+#ifndef _SCREEN_H_
+#define _SCREEN_H_
+
+#include "stm32f4xx.h"
+
+// 界面栈深度
+#define SCREEN_STACK_DEPTH  6
+
+// 按键任务的兜底周期(ms)，平时由按键中断通过 key_event_hook 立即唤醒
+#define SCREEN_KEY_PERIOD   1000
+
+/**
+ * @brief 界面对象
+ * @note 各钩子都可以为NULL；钩子里不要长时间阻塞，其他任务要等它返回才能运行
+ */
+typedef struct
+{
+    void (*enter)(void);        // 进入(或从子界面返回)时调用，负责整屏重绘
+    void (*update)(void);       // 每 period 毫秒调用一次，进入后立即调用一次
+    void (*key)(uint8_t key);   // 有按键时调用，参数为 KEYx_PRES
+    void (*exit)(void);         // 离开(被弹出)时调用
+    uint16_t period;            // update 周期(ms)，0 表示只在进入时调用
+    uint8_t low_power;          // 1: 停留在该界面时允许空闲进入STOP模式
+} Screen;
+
+void Screen_Init(const Screen *first);
+void Screen_Push(const Screen *s);
+void Screen_Pop(void);
+void Screen_Switch(const Screen *s);
+const Screen *Screen_Current(void);
+uint8_t Screen_Depth(void);
+
+// 兼容旧的阻塞式调用：压入界面并在这里跑调度器，直到该界面被弹出
+// 只能在主循环里(如 main_final.c 的菜单)调用；在任务或界面钩子里调用时，
+// 调用它的任务(例如按键任务)在嵌套的调度里不会再执行，界面永远弹不出来，
+// 所以这时只压入界面就返回，和 Screen_Push() 一样
+void Screen_Run(const Screen *s);
+
+#endif
@@ -339,10 +339,10 @@ void Process_Set_Date(void)
 
 
 // 选项的图标
-const unsigned char *set_options[] =
+const OLED_Image *set_options[] =
     {
-        gImage_clock,
-        gImage_calendar
+        &img_clock,
+        &img_calendar
 
 };
 void set_Enter_select(u8 selected)
@@ -364,67 +364,60 @@ void setting_Ref(u8 selected)
 {
   u8 right = ((selected + 1) % set_options_NUM);
 
-  OLED_ShowPicture(48, 16, 32, 32, set_options[selected], 0);
-  OLED_ShowPicture(96, 16, 32, 32, set_options[right], 1);
+  OLED_ShowImage(48, 16, set_options[selected], 0);
+  OLED_ShowImage(96, 16, set_options[right], 1);
   OLED_Refresh();
 }
 
-void setting()
+static u8 setting_selected = 0;
+
+static void setting_enter(void)
 {
-    delay_ms(10);
-  u8 flag_RE=1;
-  u8 key;
-  u8 selected= 0;
- 
-  while (1)
+  OLED_Clear();
+  setting_Ref(setting_selected);
+}
+
+static void setting_key(u8 key)
+{
+  switch (key)
   {
-    // 全局闹钟处理 - 在设置界面也能处理闹钟
-    if (Alarm_GlobalHandler()) {
-        delay_ms(10);
-        continue; // 如果正在处理闹钟提醒，跳过设置循环的其他部分
-    }
-    
-    delay_ms(10);
-    if (flag_RE)
+  case KEY0_PRES:
+    if (setting_selected == 0)
     {
-       OLED_Clear();
-       setting_Ref(selected);
-       flag_RE=0;
+      setting_selected = set_options_NUM - 1; // 0→最后一项
     }
-    
-    if ((key = KEY_Get())!=0)
+    else
     {
-      switch (key)
-      {
-      case KEY0_PRES:
-        if (selected == 0)
-        {
-          selected = set_options_NUM - 1; // 0→最后一项
-        }
-        else
-        {
-          selected--;
-        }
-        setting_Ref(selected);
+      setting_selected--;
+    }
+    setting_Ref(setting_selected);
+    break;
+  case KEY1_PRES:
+    setting_selected++;
+    setting_selected = setting_selected % set_options_NUM;
+    setting_Ref(setting_selected);
+    break;
+  case KEY2_PRES:
+    OLED_Clear();
+    Screen_Pop();
+    break;
 
-        break;
-      case KEY1_PRES:
-        selected++;
-        selected = selected % set_options_NUM;
-        setting_Ref(selected);
-        break;
-      case KEY2_PRES:
-        OLED_Clear();
-        return ;
-       
-      case KEY3_PRES:
-      flag_RE=1;
-        set_Enter_select(selected); // 进入所选择的菜单项
-        break;
+  case KEY3_PRES:
+    // 时间/日期设置页仍是阻塞式的，返回后重绘本界面
+    set_Enter_select(setting_selected); // 进入所选择的菜单项
+    setting_enter();
+    break;
 
-      default:
-        break;
-      }
-    }
+  default:
+    break;
   }
 }
+
+const Screen screen_setting = {
+  setting_enter, 0, setting_key, 0, 0
+};
+
+void setting()
+{
+  Screen_Run(&screen_setting);
+}
@@ -5,9 +5,12 @@
 #include "oled_print.h"
 #include "key.h"
 #include "rtc_date.h"
-#include "logo.h"
+#include "oled_assets.h"
+#include "screen.h"
 //选项的个数
 #define set_options_NUM 2
+extern const Screen screen_setting;
+
 void setting(void);
 
 
@@ -1,12 +1,11 @@
 #include "step.h"
-#include "ui/alarm_all.h"
 #include "oled.h"
 #include "oled_print.h"
-#include "MPU6050.h"
-#include "MPU6050/eMPL/inv_mpu_dmp_motion_driver.h"
 #include "key.h"
 #include "simple_pedometer.h"
 #include "code/spi.h"
+#define LOG_MODULE  LOG_MOD_STEP
+#include "code/log.h"
 
 // 步数数据在W25Q128中的存储地址
 #define STEP_DATA_BASE_ADDR     0x001000   // 从4KB偏移开始，避免与闹钟数据冲突
@@ -47,12 +46,12 @@ void Steps_Save(void)
     StepData_TypeDef step_data;
     uint32_t write_addr = STEP_DATA_BASE_ADDR;
     
-    printf("Saving step data to W25Q128 Flash\r\n");
+    LOG_D("Saving step data to W25Q128 Flash\r\n");
     
     // 检查W25Q128是否存在
     uint32_t flash_id = W25Q128_ReadID();
     if (flash_id != W25X_JEDECID) {
-        printf("W25Q128 not available, skipping step save\r\n");
+        LOG_W("W25Q128 not available, skipping step save\r\n");
         return;
     }
     
@@ -71,7 +70,7 @@ void Steps_Save(void)
     // 写入步数数据
     W25Q128_BufferWrite(data_ptr, write_addr, sizeof(StepData_TypeDef));
     
-    printf("Successfully saved step data: %lu steps, checksum=0x%04X\r\n", 
+    LOG_D("Successfully saved step data: %lu steps, checksum=0x%04X\r\n", 
            step_data.step_count, step_data.checksum);
 }
 
@@ -83,12 +82,12 @@ void Steps_Load(void)
     StepData_TypeDef step_data;
     uint32_t read_addr = STEP_DATA_BASE_ADDR;
     
-    printf("Loading step data from W25Q128 Flash\r\n");
+    LOG_D("Loading step data from W25Q128 Flash\r\n");
     
     // 检查W25Q128是否存在
     uint32_t flash_id = W25Q128_ReadID();
     if (flash_id != W25X_JEDECID) {
-        printf("W25Q128 not available, using default step count (0)\r\n");
+        LOG_W("W25Q128 not available, using default step count (0)\r\n");
         g_step_count = 0;
         return;
     }
@@ -103,83 +102,86 @@ void Steps_Load(void)
     if (step_data.checksum == calculated_checksum) {
         // 校验通过，使用保存的数据
         g_step_count = step_data.step_count;
-        printf("Successfully loaded step data: %lu steps (valid checksum)\r\n", g_step_count);
-        printf("Last update time: %lu seconds ago\r\n", step_data.last_update_time);
+        LOG_I("Successfully loaded step data: %lu steps (valid checksum)\r\n", g_step_count);
+        LOG_D("Last update time: %lu seconds ago\r\n", step_data.last_update_time);
     } else {
         // 校验失败，使用默认值
-        printf("Step data checksum mismatch (stored: 0x%04X, calculated: 0x%04X)\r\n", 
+        LOG_W("Step data checksum mismatch (stored: 0x%04X, calculated: 0x%04X)\r\n", 
                step_data.checksum, calculated_checksum);
-        printf("Using default step count (0)\r\n");
+        LOG_W("Using default step count (0)\r\n");
         g_step_count = 0;
     }
 }
 
-void step(void)
+static unsigned long step_last_count;
+static uint32_t step_msg_until;     // 重置提示显示到这个时间(ms)，0 表示没有提示
+
+static void step_enter(void)
 {
-    delay_ms(10);
     OLED_Clear();
     OLED_Printf_Line(0, "Step Counter");
     OLED_Printf_Line(1, "KEY0-Reset KEY2-Back");
-    OLED_Printf_Line(2, "Steps: %lu", g_step_count);
     OLED_Printf_Line(3, "Time: 0s");
     OLED_Refresh();
-    
-    // 不再初始化计步器，保持使用全局计数值
-    
-    unsigned long last_count = g_step_count;
-    
-    while(1)
+
+    // 不再初始化计步器，保持使用全局计数值，采样由主循环的计步任务完成
+    step_last_count = g_step_count;
+    step_msg_until = 0;
+}
+
+static void step_update(void)
+{
+    unsigned long count = g_step_count;
+
+    if (step_msg_until)
+    {
+        if ((int32_t)(get_systick() - step_msg_until) < 0)
+            return;
+        step_msg_until = 0;
+    }
+
+    OLED_Printf_Line(2, "Steps: %lu", count);
+    OLED_Printf_Line(3, "Simple mode");
+    OLED_Refresh_Dirty();
+
+    // 检查步数变化
+    if(count != step_last_count)
     {
-        // 全局闹钟处理 - 在计步器界面也能处理闹钟
-        if (Alarm_GlobalHandler()) {
-            continue; // 如果正在处理闹钟提醒，跳过计步器循环的其他部分
-        }
-        
-        // 读取加速度数据
-        short ax, ay, az;
-        MPU_Get_Accelerometer(&ax, &ay, &az);
-        
-        // 使用简单计步器更新步数
-        unsigned long count = simple_pedometer_update(ax, ay, az);
-        
-        OLED_Printf_Line(2, "Steps: %lu", count);
-        OLED_Printf_Line(3, "Simple mode");
-        OLED_Refresh_Dirty();
-        
-        // 检查步数变化
-        if(count != last_count)
-        {
-            printf("!!! STEP DETECTED: %ld -> %ld !!!\r\n", last_count, count);
-            last_count = count;
-        }
-        
-        // 检查按键
-        u8 key = KEY_Get();
-        if(key != 0) 
-        {
-            switch(key)
-            {
-                case KEY0_PRES: // 短按KEY0重置步数
-                    simple_pedometer_reset();
-                    OLED_Printf_Line(2, "step reset!");
-                    OLED_Printf_Line(3, "time reset!");
-                    OLED_Refresh();
-                    delay_ms(1000);
-                    OLED_Printf_Line(2, "Steps: %lu", g_step_count);
-                    OLED_Printf_Line(3, "Simple mode");
-                    OLED_Refresh();
-                    last_count = g_step_count;
-                    break;
-                    
-                case KEY2_PRES: // 按KEY2返回菜单页面
-                    OLED_Clear();
-                    return;
-                    
-                default:
-                    break;
-            }
-        }
-        
-        delay_ms(50); // 每50ms更新一次显示，提高响应速度
+        LOG_D("!!! STEP DETECTED: %ld -> %ld !!!\r\n", step_last_count, count);
+        step_last_count = count;
     }
 }
+
+static void step_key(u8 key)
+{
+    switch(key)
+    {
+        case KEY0_PRES: // 短按KEY0重置步数，提示显示1秒
+            simple_pedometer_reset();
+            OLED_Printf_Line(2, "step reset!");
+            OLED_Printf_Line(3, "time reset!");
+            OLED_Refresh();
+            step_last_count = g_step_count;
+            step_msg_until = get_systick() + 1000;
+            if (step_msg_until == 0)
+                step_msg_until = 1;
+            break;
+
+        case KEY2_PRES: // 按KEY2返回菜单页面
+            OLED_Clear();
+            Screen_Pop();
+            break;
+
+        default:
+            break;
+    }
+}
+
+const Screen screen_step = {
+    step_enter, step_update, step_key, 0, 50
+};
+
+void step(void)
+{
+    Screen_Run(&screen_step);
+}
@@ -2,6 +2,9 @@
 #define __STEP_H
 
 #include "sys.h"
+#include "screen.h"
+
+extern const Screen screen_step;
 
 void step(void);
 
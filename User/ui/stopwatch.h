@@ -5,6 +5,7 @@
 #include "key.h"
 #include "code/timer_general.h"
 #include "oled_print.h"
+#include "screen.h"
 
 // 秒表状态结构体
 typedef struct {
@@ -17,6 +18,8 @@ typedef struct {
 // 更新间隔定义(ms)
 #define STOPWATCH_UPDATE_INTERVAL 100     // 秒表更新间隔
 
+extern const Screen screen_stopwatch;
+
 void stopwatch(void);
 void Display_Stopwatch(StopwatchState* state);
 
@@ -1,4 +1,6 @@
 #include "testlist.h"
+#define LOG_MODULE  LOG_MOD_TEST
+#include "log.h"
 #define SHOWING_NUM 4
 
 char *test_opt[] = {
@@ -25,12 +27,12 @@ void SPI_test()
   u32 id = W25Q128_ReadID();
   if (id == W25X_JEDECID)
   {
-    printf("读到的ID正确:%#x\n", id);
+    LOG_I("读到的ID正确:%#x\n", id);
     OLED_Printf_Line(2, "OK:%#x\n", id);
   }
   else
   {
-    printf("读到的ID失败:%#x\n", id);
+    LOG_E("读到的ID失败:%#x\n", id);
       OLED_Printf_Line(2, "ERR:%#x\n", id);
   }
   OLED_Refresh_Dirty();